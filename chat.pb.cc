@@ -14,352 +14,904 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncomingMessageResponse_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NewUserRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SendMessageRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UpdateStatusRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_User_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UserListRequest_chat_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_chat_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UserListResponse_chat_2eproto;
-namespace chat {
-class UserDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<User> _instance;
-} _User_default_instance_;
-class NewUserRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NewUserRequest> _instance;
-} _NewUserRequest_default_instance_;
-class SendMessageRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SendMessageRequest> _instance;
-} _SendMessageRequest_default_instance_;
-class IncomingMessageResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<IncomingMessageResponse> _instance;
-} _IncomingMessageResponse_default_instance_;
-class UserListRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UserListRequest> _instance;
-} _UserListRequest_default_instance_;
-class UserListResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UserListResponse> _instance;
-} _UserListResponse_default_instance_;
-class UpdateStatusRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UpdateStatusRequest> _instance;
-} _UpdateStatusRequest_default_instance_;
-class RequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Request> _instance;
-  const ::chat::NewUserRequest* register_user_;
-  const ::chat::SendMessageRequest* send_message_;
-  const ::chat::UpdateStatusRequest* update_status_;
-  const ::chat::UserListRequest* get_users_;
-  const ::chat::User* unregister_user_;
-} _Request_default_instance_;
-class ResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Response> _instance;
-  const ::chat::UserListResponse* user_list_;
-  const ::chat::IncomingMessageResponse* incoming_message_;
-} _Response_default_instance_;
-}  // namespace chat
-static void InitDefaultsscc_info_IncomingMessageResponse_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_IncomingMessageResponse_default_instance_;
-    new (ptr) ::chat::IncomingMessageResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::IncomingMessageResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncomingMessageResponse_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_IncomingMessageResponse_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_NewUserRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_NewUserRequest_default_instance_;
-    new (ptr) ::chat::NewUserRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::NewUserRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NewUserRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NewUserRequest_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_Request_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_Request_default_instance_;
-    new (ptr) ::chat::Request();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::Request::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Request_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Request_chat_2eproto}, {
-      &scc_info_NewUserRequest_chat_2eproto.base,
-      &scc_info_SendMessageRequest_chat_2eproto.base,
-      &scc_info_UpdateStatusRequest_chat_2eproto.base,
-      &scc_info_UserListRequest_chat_2eproto.base,
-      &scc_info_User_chat_2eproto.base,}};
-
-static void InitDefaultsscc_info_Response_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_Response_default_instance_;
-    new (ptr) ::chat::Response();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::Response::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Response_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Response_chat_2eproto}, {
-      &scc_info_UserListResponse_chat_2eproto.base,
-      &scc_info_IncomingMessageResponse_chat_2eproto.base,}};
-
-static void InitDefaultsscc_info_SendMessageRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_SendMessageRequest_default_instance_;
-    new (ptr) ::chat::SendMessageRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::SendMessageRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SendMessageRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_SendMessageRequest_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_UpdateStatusRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_UpdateStatusRequest_default_instance_;
-    new (ptr) ::chat::UpdateStatusRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::UpdateStatusRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UpdateStatusRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_UpdateStatusRequest_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_User_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_User_default_instance_;
-    new (ptr) ::chat::User();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::User::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_User_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_User_chat_2eproto}, {}};
-
-static void InitDefaultsscc_info_UserListRequest_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_UserListRequest_default_instance_;
-    new (ptr) ::chat::UserListRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::UserListRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UserListRequest_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_UserListRequest_chat_2eproto}, {}};
 
-static void InitDefaultsscc_info_UserListResponse_chat_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::chat::_UserListResponse_default_instance_;
-    new (ptr) ::chat::UserListResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::chat::UserListResponse::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UserListResponse_chat_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_UserListResponse_chat_2eproto}, {
-      &scc_info_User_chat_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_chat_2eproto[9];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_chat_2eproto[5];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_chat_2eproto = nullptr;
+namespace chat {
+PROTOBUF_CONSTEXPR User::User(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserDefaultTypeInternal() {}
+  union {
+    User _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserDefaultTypeInternal _User_default_instance_;
+PROTOBUF_CONSTEXPR NewUserRequest::NewUserRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.codecs_)*/{}
+  , /*decltype(_impl_._codecs_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ack_mode_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NewUserRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NewUserRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NewUserRequestDefaultTypeInternal() {}
+  union {
+    NewUserRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+PROTOBUF_CONSTEXPR SendMessageRequest::SendMessageRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendMessageRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendMessageRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendMessageRequestDefaultTypeInternal() {}
+  union {
+    SendMessageRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+PROTOBUF_CONSTEXPR IncomingMessageResponse::IncomingMessageResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IncomingMessageResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncomingMessageResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncomingMessageResponseDefaultTypeInternal() {}
+  union {
+    IncomingMessageResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
+PROTOBUF_CONSTEXPR ChannelRequest::ChannelRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChannelRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChannelRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChannelRequestDefaultTypeInternal() {}
+  union {
+    ChannelRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
+PROTOBUF_CONSTEXPR AckRequest::AckRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_ids_)*/{}
+  , /*decltype(_impl_._message_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AckRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AckRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AckRequestDefaultTypeInternal() {}
+  union {
+    AckRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AckRequestDefaultTypeInternal _AckRequest_default_instance_;
+PROTOBUF_CONSTEXPR DeliveryReceipt::DeliveryReceipt(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.delivered_through_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeliveryReceiptDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeliveryReceiptDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeliveryReceiptDefaultTypeInternal() {}
+  union {
+    DeliveryReceipt _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeliveryReceiptDefaultTypeInternal _DeliveryReceipt_default_instance_;
+PROTOBUF_CONSTEXPR UserListRequest::UserListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filter_status_)*/false
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.limit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserListRequestDefaultTypeInternal() {}
+  union {
+    UserListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
+PROTOBUF_CONSTEXPR UserListResponse::UserListResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.users_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserListResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserListResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserListResponseDefaultTypeInternal() {}
+  union {
+    UserListResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
+PROTOBUF_CONSTEXPR PresenceSubscribeRequest::PresenceSubscribeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.unsubscribe_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceSubscribeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceSubscribeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceSubscribeRequestDefaultTypeInternal() {}
+  union {
+    PresenceSubscribeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceSubscribeRequestDefaultTypeInternal _PresenceSubscribeRequest_default_instance_;
+PROTOBUF_CONSTEXPR PresenceDelta::PresenceDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.event_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceDeltaDefaultTypeInternal() {}
+  union {
+    PresenceDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceDeltaDefaultTypeInternal _PresenceDelta_default_instance_;
+PROTOBUF_CONSTEXPR PresenceUpdate::PresenceUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.deltas_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.snapshot_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceUpdateDefaultTypeInternal() {}
+  union {
+    PresenceUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
+PROTOBUF_CONSTEXPR TransferStart::TransferStart(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferStartDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferStartDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferStartDefaultTypeInternal() {}
+  union {
+    TransferStart _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferStartDefaultTypeInternal _TransferStart_default_instance_;
+PROTOBUF_CONSTEXPR TransferChunk::TransferChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.sequence_)*/0u
+  , /*decltype(_impl_.last_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferChunkDefaultTypeInternal() {}
+  union {
+    TransferChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferChunkDefaultTypeInternal _TransferChunk_default_instance_;
+PROTOBUF_CONSTEXPR TransferCredit::TransferCredit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.transfer_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.chunks_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferCreditDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferCreditDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferCreditDefaultTypeInternal() {}
+  union {
+    TransferCredit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferCreditDefaultTypeInternal _TransferCredit_default_instance_;
+PROTOBUF_CONSTEXPR ServerShutdown::ServerShutdown(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.reconnect_after_ms_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerShutdownDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerShutdownDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerShutdownDefaultTypeInternal() {}
+  union {
+    ServerShutdown _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerShutdownDefaultTypeInternal _ServerShutdown_default_instance_;
+PROTOBUF_CONSTEXPR UpgradeSession::UpgradeSession(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.channels_)*/{}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.peer_node_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.codec_)*/0
+  , /*decltype(_impl_.ack_mode_)*/false
+  , /*decltype(_impl_.presence_)*/false
+  , /*decltype(_impl_.shared_memory_)*/false
+  , /*decltype(_impl_.pending_input_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpgradeSessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpgradeSessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpgradeSessionDefaultTypeInternal() {}
+  union {
+    UpgradeSession _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpgradeSessionDefaultTypeInternal _UpgradeSession_default_instance_;
+PROTOBUF_CONSTEXPR UpgradeDone::UpgradeDone(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.registry_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.incarnation_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpgradeDoneDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpgradeDoneDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpgradeDoneDefaultTypeInternal() {}
+  union {
+    UpgradeDone _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpgradeDoneDefaultTypeInternal _UpgradeDone_default_instance_;
+PROTOBUF_CONSTEXPR UpgradeRecord::UpgradeRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.record_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct UpgradeRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpgradeRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpgradeRecordDefaultTypeInternal() {}
+  union {
+    UpgradeRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpgradeRecordDefaultTypeInternal _UpgradeRecord_default_instance_;
+PROTOBUF_CONSTEXPR PresenceEntry::PresenceEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.node_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.removed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceEntryDefaultTypeInternal() {}
+  union {
+    PresenceEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceEntryDefaultTypeInternal _PresenceEntry_default_instance_;
+PROTOBUF_CONSTEXPR NodeVersion::NodeVersion(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.node_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.incarnation_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.replace_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeVersionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeVersionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeVersionDefaultTypeInternal() {}
+  union {
+    NodeVersion _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeVersionDefaultTypeInternal _NodeVersion_default_instance_;
+PROTOBUF_CONSTEXPR ForwardedMessage::ForwardedMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ForwardedMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ForwardedMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ForwardedMessageDefaultTypeInternal() {}
+  union {
+    ForwardedMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ForwardedMessageDefaultTypeInternal _ForwardedMessage_default_instance_;
+PROTOBUF_CONSTEXPR PeerBatch::PeerBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.presence_)*/{}
+  , /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.digest_)*/{}
+  , /*decltype(_impl_.node_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.secret_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clock_)*/nullptr
+  , /*decltype(_impl_.snapshot_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PeerBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PeerBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PeerBatchDefaultTypeInternal() {}
+  union {
+    PeerBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PeerBatchDefaultTypeInternal _PeerBatch_default_instance_;
+PROTOBUF_CONSTEXPR GossipUpdate::GossipUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.node_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GossipUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GossipUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GossipUpdateDefaultTypeInternal() {}
+  union {
+    GossipUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GossipUpdateDefaultTypeInternal _GossipUpdate_default_instance_;
+PROTOBUF_CONSTEXPR UpdateStatusRequest::UpdateStatusRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.new_status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateStatusRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateStatusRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateStatusRequestDefaultTypeInternal() {}
+  union {
+    UpdateStatusRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.payload_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.redirect_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_.message_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.codec_)*/0
+  , /*decltype(_impl_.result_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+}  // namespace chat
+static ::_pb::Metadata file_level_metadata_chat_2eproto[27];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_chat_2eproto[7];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_chat_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_chat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_chat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::User, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::User, username_),
-  PROTOBUF_FIELD_OFFSET(::chat::User, status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.status_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, username_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.ack_mode_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.codecs_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, recipient_),
-  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, content_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.channel_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, sender_),
-  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, content_),
-  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.channel_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ChannelRequest, _impl_.channel_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::AckRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::AckRequest, _impl_.message_ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::DeliveryReceipt, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::DeliveryReceipt, _impl_.delivered_through_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, username_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.cursor_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.filter_status_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.limit_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, users_),
-  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.users_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.next_cursor_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceSubscribeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceSubscribeRequest, _impl_.unsubscribe_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _impl_.event_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _impl_.user_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceDelta, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.snapshot_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.deltas_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.transfer_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.total_size_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferStart, _impl_.type_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::TransferChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::TransferChunk, _impl_.transfer_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferChunk, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferChunk, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferChunk, _impl_.last_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::TransferCredit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::TransferCredit, _impl_.transfer_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::TransferCredit, _impl_.chunks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerShutdown, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerShutdown, _impl_.reconnect_after_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.ack_mode_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.codec_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.presence_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.channels_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.pending_input_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.peer_node_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeSession, _impl_.shared_memory_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeDone, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeDone, _impl_.registry_version_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeDone, _impl_.incarnation_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeRecord, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::UpgradeRecord, _impl_.record_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEntry, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEntry, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEntry, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEntry, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEntry, _impl_.removed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::NodeVersion, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::NodeVersion, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::chat::NodeVersion, _impl_.incarnation_),
+  PROTOBUF_FIELD_OFFSET(::chat::NodeVersion, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::NodeVersion, _impl_.replace_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ForwardedMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ForwardedMessage, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::ForwardedMessage, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::chat::ForwardedMessage, _impl_.content_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.snapshot_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.presence_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.clock_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.digest_),
+  PROTOBUF_FIELD_OFFSET(::chat::PeerBatch, _impl_.secret_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::GossipUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::GossipUpdate, _impl_.node_),
+  PROTOBUF_FIELD_OFFSET(::chat::GossipUpdate, _impl_.entries_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, username_),
-  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, new_status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _impl_.new_status_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::Request, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::chat::Request, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::Request, operation_),
-  offsetof(::chat::RequestDefaultTypeInternal, register_user_),
-  offsetof(::chat::RequestDefaultTypeInternal, send_message_),
-  offsetof(::chat::RequestDefaultTypeInternal, update_status_),
-  offsetof(::chat::RequestDefaultTypeInternal, get_users_),
-  offsetof(::chat::RequestDefaultTypeInternal, unregister_user_),
-  PROTOBUF_FIELD_OFFSET(::chat::Request, payload_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.operation_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.payload_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::chat::Response, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::chat::Response, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::chat::Response, operation_),
-  PROTOBUF_FIELD_OFFSET(::chat::Response, status_code_),
-  PROTOBUF_FIELD_OFFSET(::chat::Response, message_),
-  offsetof(::chat::ResponseDefaultTypeInternal, user_list_),
-  offsetof(::chat::ResponseDefaultTypeInternal, incoming_message_),
-  PROTOBUF_FIELD_OFFSET(::chat::Response, result_),
-};
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::chat::User)},
-  { 7, -1, sizeof(::chat::NewUserRequest)},
-  { 13, -1, sizeof(::chat::SendMessageRequest)},
-  { 20, -1, sizeof(::chat::IncomingMessageResponse)},
-  { 28, -1, sizeof(::chat::UserListRequest)},
-  { 34, -1, sizeof(::chat::UserListResponse)},
-  { 41, -1, sizeof(::chat::UpdateStatusRequest)},
-  { 48, -1, sizeof(::chat::Request)},
-  { 60, -1, sizeof(::chat::Response)},
-};
-
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_User_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_NewUserRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_SendMessageRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_IncomingMessageResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_UserListRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_UserListResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_UpdateStatusRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_Request_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::chat::_Response_default_instance_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.message_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.codec_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.redirect_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.result_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::chat::User)},
+  { 8, -1, -1, sizeof(::chat::NewUserRequest)},
+  { 17, -1, -1, sizeof(::chat::SendMessageRequest)},
+  { 26, -1, -1, sizeof(::chat::IncomingMessageResponse)},
+  { 37, -1, -1, sizeof(::chat::ChannelRequest)},
+  { 44, -1, -1, sizeof(::chat::AckRequest)},
+  { 51, -1, -1, sizeof(::chat::DeliveryReceipt)},
+  { 58, -1, -1, sizeof(::chat::UserListRequest)},
+  { 70, -1, -1, sizeof(::chat::UserListResponse)},
+  { 79, -1, -1, sizeof(::chat::PresenceSubscribeRequest)},
+  { 86, -1, -1, sizeof(::chat::PresenceDelta)},
+  { 95, -1, -1, sizeof(::chat::PresenceUpdate)},
+  { 104, -1, -1, sizeof(::chat::TransferStart)},
+  { 117, -1, -1, sizeof(::chat::TransferChunk)},
+  { 127, -1, -1, sizeof(::chat::TransferCredit)},
+  { 135, -1, -1, sizeof(::chat::ServerShutdown)},
+  { 142, -1, -1, sizeof(::chat::UpgradeSession)},
+  { 158, -1, -1, sizeof(::chat::UpgradeDone)},
+  { 166, -1, -1, sizeof(::chat::UpgradeRecord)},
+  { 177, -1, -1, sizeof(::chat::PresenceEntry)},
+  { 188, -1, -1, sizeof(::chat::NodeVersion)},
+  { 198, -1, -1, sizeof(::chat::ForwardedMessage)},
+  { 207, -1, -1, sizeof(::chat::PeerBatch)},
+  { 220, -1, -1, sizeof(::chat::GossipUpdate)},
+  { 228, -1, -1, sizeof(::chat::UpdateStatusRequest)},
+  { 236, -1, -1, sizeof(::chat::Request)},
+  { 255, -1, -1, sizeof(::chat::Response)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::chat::_User_default_instance_._instance,
+  &::chat::_NewUserRequest_default_instance_._instance,
+  &::chat::_SendMessageRequest_default_instance_._instance,
+  &::chat::_IncomingMessageResponse_default_instance_._instance,
+  &::chat::_ChannelRequest_default_instance_._instance,
+  &::chat::_AckRequest_default_instance_._instance,
+  &::chat::_DeliveryReceipt_default_instance_._instance,
+  &::chat::_UserListRequest_default_instance_._instance,
+  &::chat::_UserListResponse_default_instance_._instance,
+  &::chat::_PresenceSubscribeRequest_default_instance_._instance,
+  &::chat::_PresenceDelta_default_instance_._instance,
+  &::chat::_PresenceUpdate_default_instance_._instance,
+  &::chat::_TransferStart_default_instance_._instance,
+  &::chat::_TransferChunk_default_instance_._instance,
+  &::chat::_TransferCredit_default_instance_._instance,
+  &::chat::_ServerShutdown_default_instance_._instance,
+  &::chat::_UpgradeSession_default_instance_._instance,
+  &::chat::_UpgradeDone_default_instance_._instance,
+  &::chat::_UpgradeRecord_default_instance_._instance,
+  &::chat::_PresenceEntry_default_instance_._instance,
+  &::chat::_NodeVersion_default_instance_._instance,
+  &::chat::_ForwardedMessage_default_instance_._instance,
+  &::chat::_PeerBatch_default_instance_._instance,
+  &::chat::_GossipUpdate_default_instance_._instance,
+  &::chat::_UpdateStatusRequest_default_instance_._instance,
+  &::chat::_Request_default_instance_._instance,
+  &::chat::_Response_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_chat_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\nchat.proto\022\004chat\":\n\004User\022\020\n\010username\030\001"
-  " \001(\t\022 \n\006status\030\002 \001(\0162\020.chat.UserStatus\"\""
-  "\n\016NewUserRequest\022\020\n\010username\030\001 \001(\t\"8\n\022Se"
-  "ndMessageRequest\022\021\n\trecipient\030\001 \001(\t\022\017\n\007c"
-  "ontent\030\002 \001(\t\"[\n\027IncomingMessageResponse\022"
-  "\016\n\006sender\030\001 \001(\t\022\017\n\007content\030\002 \001(\t\022\037\n\004type"
-  "\030\003 \001(\0162\021.chat.MessageType\"#\n\017UserListReq"
-  "uest\022\020\n\010username\030\001 \001(\t\"O\n\020UserListRespon"
-  "se\022\031\n\005users\030\001 \003(\0132\n.chat.User\022 \n\004type\030\002 "
-  "\001(\0162\022.chat.UserListType\"M\n\023UpdateStatusR"
-  "equest\022\020\n\010username\030\001 \001(\t\022$\n\nnew_status\030\002"
-  " \001(\0162\020.chat.UserStatus\"\240\002\n\007Request\022\"\n\top"
-  "eration\030\001 \001(\0162\017.chat.Operation\022-\n\rregist"
-  "er_user\030\002 \001(\0132\024.chat.NewUserRequestH\000\0220\n"
-  "\014send_message\030\003 \001(\0132\030.chat.SendMessageRe"
-  "questH\000\0222\n\rupdate_status\030\004 \001(\0132\031.chat.Up"
-  "dateStatusRequestH\000\022*\n\tget_users\030\005 \001(\0132\025"
-  ".chat.UserListRequestH\000\022%\n\017unregister_us"
-  "er\030\006 \001(\0132\n.chat.UserH\000B\t\n\007payload\"\330\001\n\010Re"
-  "sponse\022\"\n\toperation\030\001 \001(\0162\017.chat.Operati"
-  "on\022%\n\013status_code\030\002 \001(\0162\020.chat.StatusCod"
-  "e\022\017\n\007message\030\003 \001(\t\022+\n\tuser_list\030\004 \001(\0132\026."
-  "chat.UserListResponseH\000\0229\n\020incoming_mess"
-  "age\030\005 \001(\0132\035.chat.IncomingMessageResponse"
-  "H\000B\010\n\006result*/\n\nUserStatus\022\n\n\006ONLINE\020\000\022\010"
-  "\n\004BUSY\020\001\022\013\n\007OFFLINE\020\002*(\n\013MessageType\022\r\n\t"
-  "BROADCAST\020\000\022\n\n\006DIRECT\020\001*#\n\014UserListType\022"
-  "\007\n\003ALL\020\000\022\n\n\006SINGLE\020\001*}\n\tOperation\022\021\n\rREG"
-  "ISTER_USER\020\000\022\020\n\014SEND_MESSAGE\020\001\022\021\n\rUPDATE"
-  "_STATUS\020\002\022\r\n\tGET_USERS\020\003\022\023\n\017UNREGISTER_U"
-  "SER\020\004\022\024\n\020INCOMING_MESSAGE\020\005*W\n\nStatusCod"
-  "e\022\022\n\016UNKNOWN_STATUS\020\000\022\007\n\002OK\020\310\001\022\020\n\013BAD_RE"
-  "QUEST\020\220\003\022\032\n\025INTERNAL_SERVER_ERROR\020\364\003b\006pr"
-  "oto3"
+  " \001(\t\022 \n\006status\030\002 \001(\0162\020.chat.UserStatus\"Q"
+  "\n\016NewUserRequest\022\020\n\010username\030\001 \001(\t\022\020\n\010ac"
+  "k_mode\030\002 \001(\010\022\033\n\006codecs\030\003 \003(\0162\013.chat.Code"
+  "c\"I\n\022SendMessageRequest\022\021\n\trecipient\030\001 \001"
+  "(\t\022\017\n\007content\030\002 \001(\t\022\017\n\007channel\030\003 \001(\t\"\200\001\n"
+  "\027IncomingMessageResponse\022\016\n\006sender\030\001 \001(\t"
+  "\022\017\n\007content\030\002 \001(\t\022\037\n\004type\030\003 \001(\0162\021.chat.M"
+  "essageType\022\022\n\nmessage_id\030\004 \001(\004\022\017\n\007channe"
+  "l\030\005 \001(\t\"!\n\016ChannelRequest\022\017\n\007channel\030\001 \001"
+  "(\t\"!\n\nAckRequest\022\023\n\013message_ids\030\001 \003(\004\",\n"
+  "\017DeliveryReceipt\022\031\n\021delivered_through\030\001 "
+  "\001(\004\"\213\001\n\017UserListRequest\022\020\n\010username\030\001 \001("
+  "\t\022\016\n\006cursor\030\002 \001(\t\022\016\n\006prefix\030\003 \001(\t\022\025\n\rfil"
+  "ter_status\030\004 \001(\010\022 \n\006status\030\005 \001(\0162\020.chat."
+  "UserStatus\022\r\n\005limit\030\006 \001(\r\"d\n\020UserListRes"
+  "ponse\022\031\n\005users\030\001 \003(\0132\n.chat.User\022 \n\004type"
+  "\030\002 \001(\0162\022.chat.UserListType\022\023\n\013next_curso"
+  "r\030\003 \001(\t\"/\n\030PresenceSubscribeRequest\022\023\n\013u"
+  "nsubscribe\030\001 \001(\010\"^\n\rPresenceDelta\022\"\n\005eve"
+  "nt\030\001 \001(\0162\023.chat.PresenceEvent\022\030\n\004user\030\002 "
+  "\001(\0132\n.chat.User\022\017\n\007version\030\003 \001(\004\"X\n\016Pres"
+  "enceUpdate\022\017\n\007version\030\001 \001(\004\022\020\n\010snapshot\030"
+  "\002 \001(\010\022#\n\006deltas\030\003 \003(\0132\023.chat.PresenceDel"
+  "ta\"\233\001\n\rTransferStart\022\023\n\013transfer_id\030\001 \001("
+  "\004\022\021\n\trecipient\030\002 \001(\t\022\017\n\007channel\030\003 \001(\t\022\014\n"
+  "\004name\030\004 \001(\t\022\022\n\ntotal_size\030\005 \001(\004\022\016\n\006sende"
+  "r\030\006 \001(\t\022\037\n\004type\030\007 \001(\0162\021.chat.MessageType"
+  "\"R\n\rTransferChunk\022\023\n\013transfer_id\030\001 \001(\004\022\020"
+  "\n\010sequence\030\002 \001(\r\022\014\n\004data\030\003 \001(\014\022\014\n\004last\030\004"
+  " \001(\010\"5\n\016TransferCredit\022\023\n\013transfer_id\030\001 "
+  "\001(\004\022\016\n\006chunks\030\002 \001(\r\",\n\016ServerShutdown\022\032\n"
+  "\022reconnect_after_ms\030\001 \001(\r\"\343\001\n\016UpgradeSes"
+  "sion\022\020\n\010username\030\001 \001(\t\022 \n\006status\030\002 \001(\0162\020"
+  ".chat.UserStatus\022\020\n\010ack_mode\030\003 \001(\010\022\032\n\005co"
+  "dec\030\004 \001(\0162\013.chat.Codec\022\020\n\010presence\030\005 \001(\010"
+  "\022\020\n\010channels\030\006 \003(\t\022\025\n\rpending_input\030\007 \001("
+  "\r\022\n\n\002ip\030\010 \001(\t\022\021\n\tpeer_node\030\t \001(\t\022\025\n\rshar"
+  "ed_memory\030\n \001(\010\"<\n\013UpgradeDone\022\030\n\020regist"
+  "ry_version\030\001 \001(\004\022\023\n\013incarnation\030\002 \001(\004\"\214\001"
+  "\n\rUpgradeRecord\022\022\n\010listener\030\001 \001(\010H\000\022\'\n\007s"
+  "ession\030\002 \001(\0132\024.chat.UpgradeSessionH\000\022!\n\004"
+  "done\030\003 \001(\0132\021.chat.UpgradeDoneH\000\022\021\n\007reque"
+  "st\030\004 \001(\010H\000B\010\n\006record\"s\n\rPresenceEntry\022\020\n"
+  "\010username\030\001 \001(\t\022\014\n\004node\030\002 \001(\t\022 \n\006status\030"
+  "\003 \001(\0162\020.chat.UserStatus\022\017\n\007version\030\004 \001(\004"
+  "\022\017\n\007removed\030\005 \001(\010\"R\n\013NodeVersion\022\014\n\004node"
+  "\030\001 \001(\t\022\023\n\013incarnation\030\002 \001(\004\022\017\n\007version\030\003"
+  " \001(\004\022\017\n\007replace\030\004 \001(\010\"F\n\020ForwardedMessag"
+  "e\022\021\n\trecipient\030\001 \001(\t\022\016\n\006sender\030\002 \001(\t\022\017\n\007"
+  "content\030\003 \001(\t\"\321\001\n\tPeerBatch\022\014\n\004node\030\001 \001("
+  "\t\022\020\n\010snapshot\030\002 \001(\010\022%\n\010presence\030\003 \003(\0132\023."
+  "chat.PresenceEntry\022(\n\010messages\030\004 \003(\0132\026.c"
+  "hat.ForwardedMessage\022 \n\005clock\030\005 \001(\0132\021.ch"
+  "at.NodeVersion\022!\n\006digest\030\006 \003(\0132\021.chat.No"
+  "deVersion\022\016\n\006secret\030\007 \001(\t\"U\n\014GossipUpdat"
+  "e\022\037\n\004node\030\001 \001(\0132\021.chat.NodeVersion\022$\n\007en"
+  "tries\030\002 \003(\0132\023.chat.PresenceEntry\"M\n\023Upda"
+  "teStatusRequest\022\020\n\010username\030\001 \001(\t\022$\n\nnew"
+  "_status\030\002 \001(\0162\020.chat.UserStatus\"\255\004\n\007Requ"
+  "est\022\"\n\toperation\030\001 \001(\0162\017.chat.Operation\022"
+  "-\n\rregister_user\030\002 \001(\0132\024.chat.NewUserReq"
+  "uestH\000\0220\n\014send_message\030\003 \001(\0132\030.chat.Send"
+  "MessageRequestH\000\0222\n\rupdate_status\030\004 \001(\0132"
+  "\031.chat.UpdateStatusRequestH\000\022*\n\tget_user"
+  "s\030\005 \001(\0132\025.chat.UserListRequestH\000\022%\n\017unre"
+  "gister_user\030\006 \001(\0132\n.chat.UserH\000\022\037\n\003ack\030\007"
+  " \001(\0132\020.chat.AckRequestH\000\022\'\n\007channel\030\010 \001("
+  "\0132\024.chat.ChannelRequestH\000\022<\n\022subscribe_p"
+  "resence\030\t \001(\0132\036.chat.PresenceSubscribeRe"
+  "questH\000\022-\n\016transfer_start\030\n \001(\0132\023.chat.T"
+  "ransferStartH\000\022-\n\016transfer_chunk\030\013 \001(\0132\023"
+  ".chat.TransferChunkH\000\022%\n\npeer_batch\030\014 \001("
+  "\0132\017.chat.PeerBatchH\000B\t\n\007payload\"\335\004\n\010Resp"
+  "onse\022\"\n\toperation\030\001 \001(\0162\017.chat.Operation"
+  "\022%\n\013status_code\030\002 \001(\0162\020.chat.StatusCode\022"
+  "\017\n\007message\030\003 \001(\t\022+\n\tuser_list\030\004 \001(\0132\026.ch"
+  "at.UserListResponseH\000\0229\n\020incoming_messag"
+  "e\030\005 \001(\0132\035.chat.IncomingMessageResponseH\000"
+  "\0221\n\020delivery_receipt\030\006 \001(\0132\025.chat.Delive"
+  "ryReceiptH\000\022(\n\010presence\030\010 \001(\0132\024.chat.Pre"
+  "senceUpdateH\000\022-\n\016transfer_start\030\n \001(\0132\023."
+  "chat.TransferStartH\000\022-\n\016transfer_chunk\030\013"
+  " \001(\0132\023.chat.TransferChunkH\000\022/\n\017transfer_"
+  "credit\030\014 \001(\0132\024.chat.TransferCreditH\000\022/\n\017"
+  "server_shutdown\030\r \001(\0132\024.chat.ServerShutd"
+  "ownH\000\022$\n\006gossip\030\017 \001(\0132\022.chat.GossipUpdat"
+  "eH\000\022\022\n\nmessage_id\030\007 \001(\004\022\032\n\005codec\030\t \001(\0162\013"
+  ".chat.Codec\022\020\n\010redirect\030\016 \001(\tB\010\n\006result*"
+  "/\n\nUserStatus\022\n\n\006ONLINE\020\000\022\010\n\004BUSY\020\001\022\013\n\007O"
+  "FFLINE\020\002*.\n\005Codec\022\022\n\016NO_COMPRESSION\020\000\022\007\n"
+  "\003LZ4\020\001\022\010\n\004ZSTD\020\002*5\n\013MessageType\022\r\n\tBROAD"
+  "CAST\020\000\022\n\n\006DIRECT\020\001\022\013\n\007CHANNEL\020\002*#\n\014UserL"
+  "istType\022\007\n\003ALL\020\000\022\n\n\006SINGLE\020\001*C\n\rPresence"
+  "Event\022\017\n\013USER_JOINED\020\000\022\r\n\tUSER_LEFT\020\001\022\022\n"
+  "\016STATUS_CHANGED\020\002*\230\003\n\tOperation\022\021\n\rREGIS"
+  "TER_USER\020\000\022\020\n\014SEND_MESSAGE\020\001\022\021\n\rUPDATE_S"
+  "TATUS\020\002\022\r\n\tGET_USERS\020\003\022\023\n\017UNREGISTER_USE"
+  "R\020\004\022\024\n\020INCOMING_MESSAGE\020\005\022\020\n\014ACK_MESSAGE"
+  "S\020\006\022\024\n\020DELIVERY_RECEIPT\020\007\022\022\n\016CREATE_CHAN"
+  "NEL\020\010\022\020\n\014JOIN_CHANNEL\020\t\022\021\n\rLEAVE_CHANNEL"
+  "\020\n\022\026\n\022SUBSCRIBE_PRESENCE\020\013\022\023\n\017PRESENCE_U"
+  "PDATE\020\014\022\022\n\016TRANSFER_START\020\r\022\022\n\016TRANSFER_"
+  "CHUNK\020\016\022\023\n\017TRANSFER_CREDIT\020\017\022\023\n\017SERVER_S"
+  "HUTDOWN\020\020\022\016\n\nPEER_BATCH\020\021\022\021\n\rSESSION_MOV"
+  "ED\020\022\022\026\n\022OPEN_SHARED_MEMORY\020\023*\220\001\n\nStatusC"
+  "ode\022\022\n\016UNKNOWN_STATUS\020\000\022\007\n\002OK\020\310\001\022\020\n\013BAD_"
+  "REQUEST\020\220\003\022\n\n\005MOVED\020\263\002\022\021\n\014RATE_LIMITED\020\255"
+  "\003\022\032\n\025INTERNAL_SERVER_ERROR\020\364\003\022\030\n\023SERVICE"
+  "_UNAVAILABLE\020\367\003B\003\370\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_chat_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_chat_2eproto_sccs[9] = {
-  &scc_info_IncomingMessageResponse_chat_2eproto.base,
-  &scc_info_NewUserRequest_chat_2eproto.base,
-  &scc_info_Request_chat_2eproto.base,
-  &scc_info_Response_chat_2eproto.base,
-  &scc_info_SendMessageRequest_chat_2eproto.base,
-  &scc_info_UpdateStatusRequest_chat_2eproto.base,
-  &scc_info_User_chat_2eproto.base,
-  &scc_info_UserListRequest_chat_2eproto.base,
-  &scc_info_UserListResponse_chat_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_chat_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chat_2eproto = {
-  false, false, descriptor_table_protodef_chat_2eproto, "chat.proto", 1324,
-  &descriptor_table_chat_2eproto_once, descriptor_table_chat_2eproto_sccs, descriptor_table_chat_2eproto_deps, 9, 0,
-  schemas, file_default_instances, TableStruct_chat_2eproto::offsets,
-  file_level_metadata_chat_2eproto, 9, file_level_enum_descriptors_chat_2eproto, file_level_service_descriptors_chat_2eproto,
+static ::_pbi::once_flag descriptor_table_chat_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_chat_2eproto = {
+    false, false, 4388, descriptor_table_protodef_chat_2eproto,
+    "chat.proto",
+    &descriptor_table_chat_2eproto_once, nullptr, 0, 27,
+    schemas, file_default_instances, TableStruct_chat_2eproto::offsets,
+    file_level_metadata_chat_2eproto, file_level_enum_descriptors_chat_2eproto,
+    file_level_service_descriptors_chat_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_chat_2eproto_getter() {
+  return &descriptor_table_chat_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_chat_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_chat_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_chat_2eproto(&descriptor_table_chat_2eproto);
 namespace chat {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserStatus_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
@@ -376,14 +928,30 @@ bool UserStatus_IsValid(int value) {
   }
 }
 
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Codec_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
   return file_level_enum_descriptors_chat_2eproto[1];
 }
+bool Codec_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[2];
+}
 bool MessageType_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
+    case 2:
       return true;
     default:
       return false;
@@ -392,7 +960,7 @@ bool MessageType_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserListType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
-  return file_level_enum_descriptors_chat_2eproto[2];
+  return file_level_enum_descriptors_chat_2eproto[3];
 }
 bool UserListType_IsValid(int value) {
   switch (value) {
@@ -404,9 +972,24 @@ bool UserListType_IsValid(int value) {
   }
 }
 
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PresenceEvent_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[4];
+}
+bool PresenceEvent_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
-  return file_level_enum_descriptors_chat_2eproto[3];
+  return file_level_enum_descriptors_chat_2eproto[5];
 }
 bool Operation_IsValid(int value) {
   switch (value) {
@@ -416,6 +999,20 @@ bool Operation_IsValid(int value) {
     case 3:
     case 4:
     case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
       return true;
     default:
       return false;
@@ -424,14 +1021,17 @@ bool Operation_IsValid(int value) {
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
-  return file_level_enum_descriptors_chat_2eproto[4];
+  return file_level_enum_descriptors_chat_2eproto[6];
 }
 bool StatusCode_IsValid(int value) {
   switch (value) {
     case 0:
     case 200:
+    case 307:
     case 400:
+    case 429:
     case 500:
+    case 503:
       return true;
     default:
       return false;
@@ -441,128 +1041,137 @@ bool StatusCode_IsValid(int value) {
 
 // ===================================================================
 
-void User::InitAsDefaultInstance() {
-}
 class User::_Internal {
  public:
 };
 
-User::User(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+User::User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.User)
 }
 User::User(const User& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  User* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
-  status_ = from.status_;
+  _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:chat.User)
 }
 
-void User::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_User_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  status_ = 0;
+inline void User::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 User::~User() {
   // @@protoc_insertion_point(destructor:chat.User)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void User::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void User::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
 }
 
-void User::ArenaDtor(void* object) {
-  User* _this = reinterpret_cast< User* >(object);
-  (void)_this;
-}
-void User::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void User::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const User& User::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_User_chat_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void User::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.User)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  status_ = 0;
+  _impl_.username_.ClearToEmpty();
+  _impl_.status_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* User::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* User::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.User.username"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.User.username"));
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UserStatus status = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_status(static_cast<::chat::UserStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* User::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* User::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.User)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -572,14 +1181,14 @@ failure:
   }
 
   // .chat.UserStatus status = 2;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_status(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.User)
@@ -590,67 +1199,48 @@ size_t User::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.User)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
   // .chat.UserStatus status = 2;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void User::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.User)
-  GOOGLE_DCHECK_NE(&from, this);
-  const User* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<User>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.User)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.User)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData User::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    User::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*User::GetClassData() const { return &_class_data_; }
 
-void User::MergeFrom(const User& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.User)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void User::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<User*>(&to_msg);
+  auto& from = static_cast<const User&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.User)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.status() != 0) {
-    _internal_set_status(from._internal_status());
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
-}
-
-void User::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.User)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void User::CopyFrom(const User& from) {
@@ -666,129 +1256,172 @@ bool User::IsInitialized() const {
 
 void User::InternalSwap(User* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(status_, other->status_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata User::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void NewUserRequest::InitAsDefaultInstance() {
-}
 class NewUserRequest::_Internal {
  public:
 };
 
-NewUserRequest::NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NewUserRequest::NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.NewUserRequest)
 }
 NewUserRequest::NewUserRequest(const NewUserRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NewUserRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.codecs_){from._impl_.codecs_}
+    , /*decltype(_impl_._codecs_cached_byte_size_)*/{0}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ack_mode_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.ack_mode_ = from._impl_.ack_mode_;
   // @@protoc_insertion_point(copy_constructor:chat.NewUserRequest)
 }
 
-void NewUserRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_NewUserRequest_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void NewUserRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.codecs_){arena}
+    , /*decltype(_impl_._codecs_cached_byte_size_)*/{0}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ack_mode_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 NewUserRequest::~NewUserRequest() {
   // @@protoc_insertion_point(destructor:chat.NewUserRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NewUserRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void NewUserRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.codecs_.~RepeatedField();
+  _impl_.username_.Destroy();
 }
 
-void NewUserRequest::ArenaDtor(void* object) {
-  NewUserRequest* _this = reinterpret_cast< NewUserRequest* >(object);
-  (void)_this;
-}
-void NewUserRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NewUserRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const NewUserRequest& NewUserRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NewUserRequest_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void NewUserRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.NewUserRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.codecs_.Clear();
+  _impl_.username_.ClearToEmpty();
+  _impl_.ack_mode_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NewUserRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NewUserRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string username = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.NewUserRequest.username"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.NewUserRequest.username"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // bool ack_mode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.ack_mode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.Codec codecs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(_internal_mutable_codecs(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_add_codecs(static_cast<::chat::Codec>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NewUserRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NewUserRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.NewUserRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -797,8 +1430,23 @@ failure:
         1, this->_internal_username(), target);
   }
 
+  // bool ack_mode = 2;
+  if (this->_internal_ack_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_ack_mode(), target);
+  }
+
+  // repeated .chat.Codec codecs = 3;
+  {
+    int byte_size = _impl_._codecs_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          3, _impl_.codecs_, byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.NewUserRequest)
@@ -809,58 +1457,65 @@ size_t NewUserRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.NewUserRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .chat.Codec codecs = 3;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_codecs_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_codecs(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._codecs_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool ack_mode = 2;
+  if (this->_internal_ack_mode() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void NewUserRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.NewUserRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NewUserRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NewUserRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.NewUserRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.NewUserRequest)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NewUserRequest::MergeFrom(const NewUserRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.NewUserRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NewUserRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NewUserRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NewUserRequest::GetClassData() const { return &_class_data_; }
+
+
+void NewUserRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NewUserRequest*>(&to_msg);
+  auto& from = static_cast<const NewUserRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.NewUserRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  _this->_impl_.codecs_.MergeFrom(from._impl_.codecs_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-}
-
-void NewUserRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.NewUserRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_ack_mode() != 0) {
+    _this->_internal_set_ack_mode(from._internal_ack_mode());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NewUserRequest::CopyFrom(const NewUserRequest& from) {
@@ -876,145 +1531,195 @@ bool NewUserRequest::IsInitialized() const {
 
 void NewUserRequest::InternalSwap(NewUserRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.codecs_.InternalSwap(&other->_impl_.codecs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.ack_mode_, other->_impl_.ack_mode_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NewUserRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void SendMessageRequest::InitAsDefaultInstance() {
-}
 class SendMessageRequest::_Internal {
  public:
 };
 
-SendMessageRequest::SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SendMessageRequest::SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.SendMessageRequest)
 }
 SendMessageRequest::SendMessageRequest(const SendMessageRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendMessageRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.channel_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  recipient_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_recipient().empty()) {
-    recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_recipient(),
-      GetArena());
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
   }
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_content().empty()) {
-    content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_content(),
-      GetArena());
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_channel().empty()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:chat.SendMessageRequest)
 }
 
-void SendMessageRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SendMessageRequest_chat_2eproto.base);
-  recipient_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SendMessageRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.channel_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SendMessageRequest::~SendMessageRequest() {
   // @@protoc_insertion_point(destructor:chat.SendMessageRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SendMessageRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  recipient_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SendMessageRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recipient_.Destroy();
+  _impl_.content_.Destroy();
+  _impl_.channel_.Destroy();
 }
 
-void SendMessageRequest::ArenaDtor(void* object) {
-  SendMessageRequest* _this = reinterpret_cast< SendMessageRequest* >(object);
-  (void)_this;
-}
-void SendMessageRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void SendMessageRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const SendMessageRequest& SendMessageRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SendMessageRequest_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SendMessageRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.SendMessageRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  recipient_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.recipient_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.channel_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SendMessageRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SendMessageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string recipient = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_recipient();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.SendMessageRequest.recipient"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.recipient"));
+        } else
+          goto handle_unusual;
         continue;
       // string content = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.SendMessageRequest.content"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.content"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // string channel = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.channel"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SendMessageRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* SendMessageRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.SendMessageRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string recipient = 1;
-  if (this->recipient().size() > 0) {
+  if (!this->_internal_recipient().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1024,7 +1729,7 @@ failure:
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1033,8 +1738,18 @@ failure:
         2, this->_internal_content(), target);
   }
 
+  // string channel = 3;
+  if (!this->_internal_channel().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.SendMessageRequest.channel");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_channel(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.SendMessageRequest)
@@ -1045,68 +1760,59 @@ size_t SendMessageRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.SendMessageRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string recipient = 1;
-  if (this->recipient().size() > 0) {
+  if (!this->_internal_recipient().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_recipient());
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_content());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // string channel = 3;
+  if (!this->_internal_channel().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void SendMessageRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.SendMessageRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SendMessageRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SendMessageRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.SendMessageRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.SendMessageRequest)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SendMessageRequest::MergeFrom(const SendMessageRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendMessageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendMessageRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendMessageRequest::GetClassData() const { return &_class_data_; }
+
+
+void SendMessageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendMessageRequest*>(&to_msg);
+  auto& from = static_cast<const SendMessageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.recipient().size() > 0) {
-    _internal_set_recipient(from._internal_recipient());
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
   }
-  if (from.content().size() > 0) {
-    _internal_set_content(from._internal_content());
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
   }
-}
-
-void SendMessageRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.SendMessageRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_channel().empty()) {
+    _this->_internal_set_channel(from._internal_channel());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SendMessageRequest::CopyFrom(const SendMessageRequest& from) {
@@ -1122,157 +1828,228 @@ bool SendMessageRequest::IsInitialized() const {
 
 void SendMessageRequest::InternalSwap(SendMessageRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  recipient_.Swap(&other->recipient_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.Swap(&other->content_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SendMessageRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void IncomingMessageResponse::InitAsDefaultInstance() {
-}
 class IncomingMessageResponse::_Internal {
  public:
 };
 
-IncomingMessageResponse::IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+IncomingMessageResponse::IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.IncomingMessageResponse)
 }
 IncomingMessageResponse::IncomingMessageResponse(const IncomingMessageResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncomingMessageResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  sender_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_sender().empty()) {
-    sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_sender(),
-      GetArena());
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
   }
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_content().empty()) {
-    content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_content(),
-      GetArena());
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
   }
-  type_ = from.type_;
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_channel().empty()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.message_id_, &from._impl_.message_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.message_id_)) + sizeof(_impl_.type_));
   // @@protoc_insertion_point(copy_constructor:chat.IncomingMessageResponse)
 }
 
-void IncomingMessageResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_IncomingMessageResponse_chat_2eproto.base);
-  sender_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_ = 0;
+inline void IncomingMessageResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.message_id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 IncomingMessageResponse::~IncomingMessageResponse() {
   // @@protoc_insertion_point(destructor:chat.IncomingMessageResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void IncomingMessageResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  sender_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void IncomingMessageResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sender_.Destroy();
+  _impl_.content_.Destroy();
+  _impl_.channel_.Destroy();
 }
 
-void IncomingMessageResponse::ArenaDtor(void* object) {
-  IncomingMessageResponse* _this = reinterpret_cast< IncomingMessageResponse* >(object);
-  (void)_this;
-}
-void IncomingMessageResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void IncomingMessageResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const IncomingMessageResponse& IncomingMessageResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_IncomingMessageResponse_chat_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void IncomingMessageResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.IncomingMessageResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  sender_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  type_ = 0;
+  _impl_.sender_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.channel_.ClearToEmpty();
+  ::memset(&_impl_.message_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.message_id_)) + sizeof(_impl_.type_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* IncomingMessageResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* IncomingMessageResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string sender = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_sender();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.IncomingMessageResponse.sender"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.sender"));
+        } else
+          goto handle_unusual;
         continue;
       // string content = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.IncomingMessageResponse.content"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.content"));
+        } else
+          goto handle_unusual;
         continue;
       // .chat.MessageType type = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_type(static_cast<::chat::MessageType>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint64 message_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.message_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string channel = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.channel"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* IncomingMessageResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* IncomingMessageResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.IncomingMessageResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string sender = 1;
-  if (this->sender().size() > 0) {
+  if (!this->_internal_sender().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1282,7 +2059,7 @@ failure:
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1292,14 +2069,30 @@ failure:
   }
 
   // .chat.MessageType type = 3;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       3, this->_internal_type(), target);
   }
 
+  // uint64 message_id = 4;
+  if (this->_internal_message_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_message_id(), target);
+  }
+
+  // string channel = 5;
+  if (!this->_internal_channel().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.IncomingMessageResponse.channel");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_channel(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.IncomingMessageResponse)
@@ -1310,77 +2103,76 @@ size_t IncomingMessageResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.IncomingMessageResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string sender = 1;
-  if (this->sender().size() > 0) {
+  if (!this->_internal_sender().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_sender());
   }
 
   // string content = 2;
-  if (this->content().size() > 0) {
+  if (!this->_internal_content().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_content());
   }
 
-  // .chat.MessageType type = 3;
-  if (this->type() != 0) {
+  // string channel = 5;
+  if (!this->_internal_channel().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint64 message_id = 4;
+  if (this->_internal_message_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_message_id());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void IncomingMessageResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.IncomingMessageResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const IncomingMessageResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<IncomingMessageResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.IncomingMessageResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.IncomingMessageResponse)
-    MergeFrom(*source);
+  // .chat.MessageType type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IncomingMessageResponse::MergeFrom(const IncomingMessageResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.IncomingMessageResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncomingMessageResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IncomingMessageResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncomingMessageResponse::GetClassData() const { return &_class_data_; }
+
+
+void IncomingMessageResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncomingMessageResponse*>(&to_msg);
+  auto& from = static_cast<const IncomingMessageResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.IncomingMessageResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.sender().size() > 0) {
-    _internal_set_sender(from._internal_sender());
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
   }
-  if (from.content().size() > 0) {
-    _internal_set_content(from._internal_content());
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
   }
-  if (from.type() != 0) {
-    _internal_set_type(from._internal_type());
+  if (!from._internal_channel().empty()) {
+    _this->_internal_set_channel(from._internal_channel());
   }
-}
-
-void IncomingMessageResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.IncomingMessageResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_message_id() != 0) {
+    _this->_internal_set_message_id(from._internal_message_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IncomingMessageResponse::CopyFrom(const IncomingMessageResponse& from) {
@@ -1396,598 +2188,5872 @@ bool IncomingMessageResponse::IsInitialized() const {
 
 void IncomingMessageResponse::InternalSwap(IncomingMessageResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  sender_.Swap(&other->sender_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.Swap(&other->content_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(type_, other->type_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IncomingMessageResponse, _impl_.type_)
+      + sizeof(IncomingMessageResponse::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(IncomingMessageResponse, _impl_.message_id_)>(
+          reinterpret_cast<char*>(&_impl_.message_id_),
+          reinterpret_cast<char*>(&other->_impl_.message_id_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata IncomingMessageResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void UserListRequest::InitAsDefaultInstance() {
-}
-class UserListRequest::_Internal {
+class ChannelRequest::_Internal {
  public:
 };
 
-UserListRequest::UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:chat.UserListRequest)
+ChannelRequest::ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ChannelRequest)
 }
-UserListRequest::UserListRequest(const UserListRequest& from)
+ChannelRequest::ChannelRequest(const ChannelRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channel_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_channel().empty()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ChannelRequest)
+}
+
+inline void ChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channel_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChannelRequest::~ChannelRequest() {
+  // @@protoc_insertion_point(destructor:chat.ChannelRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:chat.UserListRequest)
-}
-
-void UserListRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UserListRequest_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-UserListRequest::~UserListRequest() {
-  // @@protoc_insertion_point(destructor:chat.UserListRequest)
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UserListRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ChannelRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
 }
 
-void UserListRequest::ArenaDtor(void* object) {
-  UserListRequest* _this = reinterpret_cast< UserListRequest* >(object);
-  (void)_this;
-}
-void UserListRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void UserListRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UserListRequest& UserListRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UserListRequest_chat_2eproto.base);
-  return *internal_default_instance();
+void ChannelRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void UserListRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:chat.UserListRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ChannelRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ChannelRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.channel_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UserListRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ChannelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string username = 1;
+      // string channel = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.UserListRequest.username"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.ChannelRequest.channel"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UserListRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:chat.UserListRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ChannelRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ChannelRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string username = 1;
-  if (this->username().size() > 0) {
+  // string channel = 1;
+  if (!this->_internal_channel().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "chat.UserListRequest.username");
+      "chat.ChannelRequest.channel");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_username(), target);
+        1, this->_internal_channel(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:chat.UserListRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ChannelRequest)
   return target;
 }
 
-size_t UserListRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:chat.UserListRequest)
+size_t ChannelRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ChannelRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string username = 1;
-  if (this->username().size() > 0) {
+  // string channel = 1;
+  if (!this->_internal_channel().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_username());
+        this->_internal_channel());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UserListRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.UserListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UserListRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UserListRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.UserListRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.UserListRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChannelRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChannelRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChannelRequest::GetClassData() const { return &_class_data_; }
 
-void UserListRequest::MergeFrom(const UserListRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChannelRequest*>(&to_msg);
+  auto& from = static_cast<const ChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  if (!from._internal_channel().empty()) {
+    _this->_internal_set_channel(from._internal_channel());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UserListRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.UserListRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void UserListRequest::CopyFrom(const UserListRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:chat.UserListRequest)
+void ChannelRequest::CopyFrom(const ChannelRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ChannelRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UserListRequest::IsInitialized() const {
+bool ChannelRequest::IsInitialized() const {
   return true;
 }
 
-void UserListRequest::InternalSwap(UserListRequest* other) {
+void ChannelRequest::InternalSwap(ChannelRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UserListRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ChannelRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void UserListResponse::InitAsDefaultInstance() {
-}
-class UserListResponse::_Internal {
+class AckRequest::_Internal {
  public:
 };
 
-UserListResponse::UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  users_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:chat.UserListResponse)
+AckRequest::AckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.AckRequest)
 }
-UserListResponse::UserListResponse(const UserListResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      users_(from.users_) {
+AckRequest::AckRequest(const AckRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AckRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_ids_){from._impl_.message_ids_}
+    , /*decltype(_impl_._message_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  type_ = from.type_;
-  // @@protoc_insertion_point(copy_constructor:chat.UserListResponse)
+  // @@protoc_insertion_point(copy_constructor:chat.AckRequest)
 }
 
-void UserListResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UserListResponse_chat_2eproto.base);
-  type_ = 0;
+inline void AckRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_ids_){arena}
+    , /*decltype(_impl_._message_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-UserListResponse::~UserListResponse() {
-  // @@protoc_insertion_point(destructor:chat.UserListResponse)
+AckRequest::~AckRequest() {
+  // @@protoc_insertion_point(destructor:chat.AckRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UserListResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void AckRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_ids_.~RepeatedField();
 }
 
-void UserListResponse::ArenaDtor(void* object) {
-  UserListResponse* _this = reinterpret_cast< UserListResponse* >(object);
-  (void)_this;
-}
-void UserListResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void UserListResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UserListResponse& UserListResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UserListResponse_chat_2eproto.base);
-  return *internal_default_instance();
+void AckRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void UserListResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:chat.UserListResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void AckRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.AckRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  users_.Clear();
-  type_ = 0;
+  _impl_.message_ids_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UserListResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* AckRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .chat.User users = 1;
+      // repeated uint64 message_ids = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_users(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // .chat.UserListType type = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_message_ids(), ptr, ctx);
           CHK_(ptr);
-          _internal_set_type(static_cast<::chat::UserListType>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_message_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UserListResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:chat.UserListResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* AckRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.AckRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .chat.User users = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_users_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_users(i), target, stream);
-  }
-
-  // .chat.UserListType type = 2;
-  if (this->type() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      2, this->_internal_type(), target);
+  // repeated uint64 message_ids = 1;
+  {
+    int byte_size = _impl_._message_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_message_ids(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:chat.UserListResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:chat.AckRequest)
   return target;
 }
 
-size_t UserListResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:chat.UserListResponse)
+size_t AckRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.AckRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .chat.User users = 1;
-  total_size += 1UL * this->_internal_users_size();
-  for (const auto& msg : this->users_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // .chat.UserListType type = 2;
-  if (this->type() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+  // repeated uint64 message_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.message_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._message_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UserListResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.UserListResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UserListResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UserListResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.UserListResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.UserListResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AckRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AckRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AckRequest::GetClassData() const { return &_class_data_; }
 
-void UserListResponse::MergeFrom(const UserListResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  users_.MergeFrom(from.users_);
-  if (from.type() != 0) {
-    _internal_set_type(from._internal_type());
-  }
-}
+void AckRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AckRequest*>(&to_msg);
+  auto& from = static_cast<const AckRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.AckRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void UserListResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.UserListResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.message_ids_.MergeFrom(from._impl_.message_ids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UserListResponse::CopyFrom(const UserListResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:chat.UserListResponse)
+void AckRequest::CopyFrom(const AckRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.AckRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UserListResponse::IsInitialized() const {
+bool AckRequest::IsInitialized() const {
   return true;
 }
 
-void UserListResponse::InternalSwap(UserListResponse* other) {
+void AckRequest::InternalSwap(AckRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  users_.InternalSwap(&other->users_);
-  swap(type_, other->type_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.message_ids_.InternalSwap(&other->_impl_.message_ids_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UserListResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata AckRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void UpdateStatusRequest::InitAsDefaultInstance() {
-}
-class UpdateStatusRequest::_Internal {
+class DeliveryReceipt::_Internal {
  public:
 };
 
-UpdateStatusRequest::UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:chat.UpdateStatusRequest)
+DeliveryReceipt::DeliveryReceipt(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.DeliveryReceipt)
 }
-UpdateStatusRequest::UpdateStatusRequest(const UpdateStatusRequest& from)
+DeliveryReceipt::DeliveryReceipt(const DeliveryReceipt& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeliveryReceipt* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.delivered_through_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_username().empty()) {
-    username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_username(),
-      GetArena());
-  }
-  new_status_ = from.new_status_;
-  // @@protoc_insertion_point(copy_constructor:chat.UpdateStatusRequest)
+  _this->_impl_.delivered_through_ = from._impl_.delivered_through_;
+  // @@protoc_insertion_point(copy_constructor:chat.DeliveryReceipt)
 }
 
-void UpdateStatusRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UpdateStatusRequest_chat_2eproto.base);
-  username_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_status_ = 0;
+inline void DeliveryReceipt::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.delivered_through_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-UpdateStatusRequest::~UpdateStatusRequest() {
-  // @@protoc_insertion_point(destructor:chat.UpdateStatusRequest)
+DeliveryReceipt::~DeliveryReceipt() {
+  // @@protoc_insertion_point(destructor:chat.DeliveryReceipt)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UpdateStatusRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  username_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void DeliveryReceipt::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void UpdateStatusRequest::ArenaDtor(void* object) {
-  UpdateStatusRequest* _this = reinterpret_cast< UpdateStatusRequest* >(object);
-  (void)_this;
-}
-void UpdateStatusRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void DeliveryReceipt::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void UpdateStatusRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UpdateStatusRequest& UpdateStatusRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UpdateStatusRequest_chat_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void UpdateStatusRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:chat.UpdateStatusRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void DeliveryReceipt::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.DeliveryReceipt)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_status_ = 0;
+  _impl_.delivered_through_ = uint64_t{0u};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UpdateStatusRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DeliveryReceipt::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string username = 1;
+      // uint64 delivered_through = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_username();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.UpdateStatusRequest.username"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .chat.UserStatus new_status = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.delivered_through_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_new_status(static_cast<::chat::UserStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UpdateStatusRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:chat.UpdateStatusRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* DeliveryReceipt::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.DeliveryReceipt)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string username = 1;
-  if (this->username().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+  // uint64 delivered_through = 1;
+  if (this->_internal_delivered_through() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_delivered_through(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.DeliveryReceipt)
+  return target;
+}
+
+size_t DeliveryReceipt::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.DeliveryReceipt)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 delivered_through = 1;
+  if (this->_internal_delivered_through() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivered_through());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeliveryReceipt::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeliveryReceipt::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeliveryReceipt::GetClassData() const { return &_class_data_; }
+
+
+void DeliveryReceipt::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeliveryReceipt*>(&to_msg);
+  auto& from = static_cast<const DeliveryReceipt&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.DeliveryReceipt)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_delivered_through() != 0) {
+    _this->_internal_set_delivered_through(from._internal_delivered_through());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeliveryReceipt::CopyFrom(const DeliveryReceipt& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.DeliveryReceipt)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeliveryReceipt::IsInitialized() const {
+  return true;
+}
+
+void DeliveryReceipt::InternalSwap(DeliveryReceipt* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.delivered_through_, other->_impl_.delivered_through_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeliveryReceipt::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[6]);
+}
+
+// ===================================================================
+
+class UserListRequest::_Internal {
+ public:
+};
+
+UserListRequest::UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UserListRequest)
+}
+UserListRequest::UserListRequest(const UserListRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.filter_status_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cursor().empty()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prefix().empty()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.filter_status_, &from._impl_.filter_status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.limit_) -
+    reinterpret_cast<char*>(&_impl_.filter_status_)) + sizeof(_impl_.limit_));
+  // @@protoc_insertion_point(copy_constructor:chat.UserListRequest)
+}
+
+inline void UserListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.filter_status_){false}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.limit_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UserListRequest::~UserListRequest() {
+  // @@protoc_insertion_point(destructor:chat.UserListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UserListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.cursor_.Destroy();
+  _impl_.prefix_.Destroy();
+}
+
+void UserListRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UserListRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UserListRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.cursor_.ClearToEmpty();
+  _impl_.prefix_.ClearToEmpty();
+  ::memset(&_impl_.filter_status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.limit_) -
+      reinterpret_cast<char*>(&_impl_.filter_status_)) + sizeof(_impl_.limit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UserListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UserListRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cursor = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UserListRequest.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string prefix = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UserListRequest.prefix"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool filter_status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.filter_status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 limit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UserListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UserListRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UserListRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // string cursor = 2;
+  if (!this->_internal_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UserListRequest.cursor");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cursor(), target);
+  }
+
+  // string prefix = 3;
+  if (!this->_internal_prefix().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_prefix().data(), static_cast<int>(this->_internal_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UserListRequest.prefix");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_prefix(), target);
+  }
+
+  // bool filter_status = 4;
+  if (this->_internal_filter_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_filter_status(), target);
+  }
+
+  // .chat.UserStatus status = 5;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_status(), target);
+  }
+
+  // uint32 limit = 6;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UserListRequest)
+  return target;
+}
+
+size_t UserListRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UserListRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // string cursor = 2;
+  if (!this->_internal_cursor().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cursor());
+  }
+
+  // string prefix = 3;
+  if (!this->_internal_prefix().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_prefix());
+  }
+
+  // bool filter_status = 4;
+  if (this->_internal_filter_status() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .chat.UserStatus status = 5;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // uint32 limit = 6;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserListRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserListRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserListRequest::GetClassData() const { return &_class_data_; }
+
+
+void UserListRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserListRequest*>(&to_msg);
+  auto& from = static_cast<const UserListRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_cursor().empty()) {
+    _this->_internal_set_cursor(from._internal_cursor());
+  }
+  if (!from._internal_prefix().empty()) {
+    _this->_internal_set_prefix(from._internal_prefix());
+  }
+  if (from._internal_filter_status() != 0) {
+    _this->_internal_set_filter_status(from._internal_filter_status());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UserListRequest::CopyFrom(const UserListRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UserListRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UserListRequest::IsInitialized() const {
+  return true;
+}
+
+void UserListRequest::InternalSwap(UserListRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UserListRequest, _impl_.limit_)
+      + sizeof(UserListRequest::_impl_.limit_)
+      - PROTOBUF_FIELD_OFFSET(UserListRequest, _impl_.filter_status_)>(
+          reinterpret_cast<char*>(&_impl_.filter_status_),
+          reinterpret_cast<char*>(&other->_impl_.filter_status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UserListRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[7]);
+}
+
+// ===================================================================
+
+class UserListResponse::_Internal {
+ public:
+};
+
+UserListResponse::UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UserListResponse)
+}
+UserListResponse::UserListResponse(const UserListResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserListResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){from._impl_.users_}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_next_cursor().empty()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:chat.UserListResponse)
+}
+
+inline void UserListResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){arena}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UserListResponse::~UserListResponse() {
+  // @@protoc_insertion_point(destructor:chat.UserListResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UserListResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.users_.~RepeatedPtrField();
+  _impl_.next_cursor_.Destroy();
+}
+
+void UserListResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UserListResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UserListResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.users_.Clear();
+  _impl_.next_cursor_.ClearToEmpty();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UserListResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.User users = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_users(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserListType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::chat::UserListType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UserListResponse.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UserListResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UserListResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.User users = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_users_size()); i < n; i++) {
+    const auto& repfield = this->_internal_users(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .chat.UserListType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // string next_cursor = 3;
+  if (!this->_internal_next_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UserListResponse.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_next_cursor(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UserListResponse)
+  return target;
+}
+
+size_t UserListResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UserListResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.User users = 1;
+  total_size += 1UL * this->_internal_users_size();
+  for (const auto& msg : this->_impl_.users_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string next_cursor = 3;
+  if (!this->_internal_next_cursor().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_next_cursor());
+  }
+
+  // .chat.UserListType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserListResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserListResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserListResponse::GetClassData() const { return &_class_data_; }
+
+
+void UserListResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserListResponse*>(&to_msg);
+  auto& from = static_cast<const UserListResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.users_.MergeFrom(from._impl_.users_);
+  if (!from._internal_next_cursor().empty()) {
+    _this->_internal_set_next_cursor(from._internal_next_cursor());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UserListResponse::CopyFrom(const UserListResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UserListResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UserListResponse::IsInitialized() const {
+  return true;
+}
+
+void UserListResponse::InternalSwap(UserListResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.users_.InternalSwap(&other->_impl_.users_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UserListResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[8]);
+}
+
+// ===================================================================
+
+class PresenceSubscribeRequest::_Internal {
+ public:
+};
+
+PresenceSubscribeRequest::PresenceSubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceSubscribeRequest)
+}
+PresenceSubscribeRequest::PresenceSubscribeRequest(const PresenceSubscribeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceSubscribeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.unsubscribe_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.unsubscribe_ = from._impl_.unsubscribe_;
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceSubscribeRequest)
+}
+
+inline void PresenceSubscribeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.unsubscribe_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PresenceSubscribeRequest::~PresenceSubscribeRequest() {
+  // @@protoc_insertion_point(destructor:chat.PresenceSubscribeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceSubscribeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PresenceSubscribeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceSubscribeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceSubscribeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.unsubscribe_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceSubscribeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool unsubscribe = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.unsubscribe_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceSubscribeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceSubscribeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool unsubscribe = 1;
+  if (this->_internal_unsubscribe() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_unsubscribe(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceSubscribeRequest)
+  return target;
+}
+
+size_t PresenceSubscribeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceSubscribeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool unsubscribe = 1;
+  if (this->_internal_unsubscribe() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceSubscribeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceSubscribeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceSubscribeRequest::GetClassData() const { return &_class_data_; }
+
+
+void PresenceSubscribeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceSubscribeRequest*>(&to_msg);
+  auto& from = static_cast<const PresenceSubscribeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceSubscribeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_unsubscribe() != 0) {
+    _this->_internal_set_unsubscribe(from._internal_unsubscribe());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceSubscribeRequest::CopyFrom(const PresenceSubscribeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceSubscribeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceSubscribeRequest::IsInitialized() const {
+  return true;
+}
+
+void PresenceSubscribeRequest::InternalSwap(PresenceSubscribeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.unsubscribe_, other->_impl_.unsubscribe_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceSubscribeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[9]);
+}
+
+// ===================================================================
+
+class PresenceDelta::_Internal {
+ public:
+  static const ::chat::User& user(const PresenceDelta* msg);
+};
+
+const ::chat::User&
+PresenceDelta::_Internal::user(const PresenceDelta* msg) {
+  return *msg->_impl_.user_;
+}
+PresenceDelta::PresenceDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceDelta)
+}
+PresenceDelta::PresenceDelta(const PresenceDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.event_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::chat::User(*from._impl_.user_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.event_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.event_));
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceDelta)
+}
+
+inline void PresenceDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.event_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PresenceDelta::~PresenceDelta() {
+  // @@protoc_insertion_point(destructor:chat.PresenceDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.user_;
+}
+
+void PresenceDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.event_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.event_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.PresenceEvent event = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_event(static_cast<::chat::PresenceEvent>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.User user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.PresenceEvent event = 1;
+  if (this->_internal_event() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_event(), target);
+  }
+
+  // .chat.User user = 2;
+  if (this->_internal_has_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 version = 3;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceDelta)
+  return target;
+}
+
+size_t PresenceDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .chat.User user = 2;
+  if (this->_internal_has_user()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.user_);
+  }
+
+  // uint64 version = 3;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // .chat.PresenceEvent event = 1;
+  if (this->_internal_event() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_event());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceDelta::GetClassData() const { return &_class_data_; }
+
+
+void PresenceDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceDelta*>(&to_msg);
+  auto& from = static_cast<const PresenceDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_user()) {
+    _this->_internal_mutable_user()->::chat::User::MergeFrom(
+        from._internal_user());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_event() != 0) {
+    _this->_internal_set_event(from._internal_event());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceDelta::CopyFrom(const PresenceDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceDelta::IsInitialized() const {
+  return true;
+}
+
+void PresenceDelta::InternalSwap(PresenceDelta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceDelta, _impl_.event_)
+      + sizeof(PresenceDelta::_impl_.event_)
+      - PROTOBUF_FIELD_OFFSET(PresenceDelta, _impl_.user_)>(
+          reinterpret_cast<char*>(&_impl_.user_),
+          reinterpret_cast<char*>(&other->_impl_.user_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[10]);
+}
+
+// ===================================================================
+
+class PresenceUpdate::_Internal {
+ public:
+};
+
+PresenceUpdate::PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceUpdate)
+}
+PresenceUpdate::PresenceUpdate(const PresenceUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.deltas_){from._impl_.deltas_}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.snapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.snapshot_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.snapshot_));
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceUpdate)
+}
+
+inline void PresenceUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.deltas_){arena}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.snapshot_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PresenceUpdate::~PresenceUpdate() {
+  // @@protoc_insertion_point(destructor:chat.PresenceUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.deltas_.~RepeatedPtrField();
+}
+
+void PresenceUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.deltas_.Clear();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.snapshot_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.snapshot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool snapshot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PresenceDelta deltas = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_deltas(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_version(), target);
+  }
+
+  // bool snapshot = 2;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_snapshot(), target);
+  }
+
+  // repeated .chat.PresenceDelta deltas = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_deltas_size()); i < n; i++) {
+    const auto& repfield = this->_internal_deltas(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceUpdate)
+  return target;
+}
+
+size_t PresenceUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.PresenceDelta deltas = 3;
+  total_size += 1UL * this->_internal_deltas_size();
+  for (const auto& msg : this->_impl_.deltas_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // bool snapshot = 2;
+  if (this->_internal_snapshot() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceUpdate::GetClassData() const { return &_class_data_; }
+
+
+void PresenceUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceUpdate*>(&to_msg);
+  auto& from = static_cast<const PresenceUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.deltas_.MergeFrom(from._impl_.deltas_);
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceUpdate::CopyFrom(const PresenceUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceUpdate::IsInitialized() const {
+  return true;
+}
+
+void PresenceUpdate::InternalSwap(PresenceUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.deltas_.InternalSwap(&other->_impl_.deltas_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceUpdate, _impl_.snapshot_)
+      + sizeof(PresenceUpdate::_impl_.snapshot_)
+      - PROTOBUF_FIELD_OFFSET(PresenceUpdate, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[11]);
+}
+
+// ===================================================================
+
+class TransferStart::_Internal {
+ public:
+};
+
+TransferStart::TransferStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.TransferStart)
+}
+TransferStart::TransferStart(const TransferStart& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferStart* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.transfer_id_){}
+    , decltype(_impl_.total_size_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_recipient().empty()) {
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_channel().empty()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sender().empty()) {
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.transfer_id_, &from._impl_.transfer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:chat.TransferStart)
+}
+
+inline void TransferStart::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.transfer_id_){uint64_t{0u}}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferStart::~TransferStart() {
+  // @@protoc_insertion_point(destructor:chat.TransferStart)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferStart::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recipient_.Destroy();
+  _impl_.channel_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.sender_.Destroy();
+}
+
+void TransferStart::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferStart::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.TransferStart)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.recipient_.ClearToEmpty();
+  _impl_.channel_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.sender_.ClearToEmpty();
+  ::memset(&_impl_.transfer_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferStart::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 transfer_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.transfer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string recipient = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_recipient();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.TransferStart.recipient"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string channel = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.TransferStart.channel"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.TransferStart.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string sender = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_sender();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.TransferStart.sender"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.MessageType type = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::chat::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferStart::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.TransferStart)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_transfer_id(), target);
+  }
+
+  // string recipient = 2;
+  if (!this->_internal_recipient().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.TransferStart.recipient");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_recipient(), target);
+  }
+
+  // string channel = 3;
+  if (!this->_internal_channel().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_channel().data(), static_cast<int>(this->_internal_channel().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.TransferStart.channel");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_channel(), target);
+  }
+
+  // string name = 4;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.TransferStart.name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name(), target);
+  }
+
+  // uint64 total_size = 5;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_total_size(), target);
+  }
+
+  // string sender = 6;
+  if (!this->_internal_sender().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.TransferStart.sender");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_sender(), target);
+  }
+
+  // .chat.MessageType type = 7;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.TransferStart)
+  return target;
+}
+
+size_t TransferStart::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.TransferStart)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string recipient = 2;
+  if (!this->_internal_recipient().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_recipient());
+  }
+
+  // string channel = 3;
+  if (!this->_internal_channel().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+  }
+
+  // string name = 4;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string sender = 6;
+  if (!this->_internal_sender().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
+  }
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_transfer_id());
+  }
+
+  // uint64 total_size = 5;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
+  }
+
+  // .chat.MessageType type = 7;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferStart::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferStart::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferStart::GetClassData() const { return &_class_data_; }
+
+
+void TransferStart::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferStart*>(&to_msg);
+  auto& from = static_cast<const TransferStart&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.TransferStart)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
+  }
+  if (!from._internal_channel().empty()) {
+    _this->_internal_set_channel(from._internal_channel());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
+  }
+  if (from._internal_transfer_id() != 0) {
+    _this->_internal_set_transfer_id(from._internal_transfer_id());
+  }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferStart::CopyFrom(const TransferStart& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.TransferStart)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferStart::IsInitialized() const {
+  return true;
+}
+
+void TransferStart::InternalSwap(TransferStart* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferStart, _impl_.type_)
+      + sizeof(TransferStart::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(TransferStart, _impl_.transfer_id_)>(
+          reinterpret_cast<char*>(&_impl_.transfer_id_),
+          reinterpret_cast<char*>(&other->_impl_.transfer_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferStart::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[12]);
+}
+
+// ===================================================================
+
+class TransferChunk::_Internal {
+ public:
+};
+
+TransferChunk::TransferChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.TransferChunk)
+}
+TransferChunk::TransferChunk(const TransferChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.transfer_id_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.last_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.transfer_id_, &from._impl_.transfer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_) -
+    reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.last_));
+  // @@protoc_insertion_point(copy_constructor:chat.TransferChunk)
+}
+
+inline void TransferChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.transfer_id_){uint64_t{0u}}
+    , decltype(_impl_.sequence_){0u}
+    , decltype(_impl_.last_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferChunk::~TransferChunk() {
+  // @@protoc_insertion_point(destructor:chat.TransferChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void TransferChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.TransferChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.transfer_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.last_) -
+      reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.last_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 transfer_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.transfer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sequence = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool last = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.TransferChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_transfer_id(), target);
+  }
+
+  // uint32 sequence = 2;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_sequence(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_last(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.TransferChunk)
+  return target;
+}
+
+size_t TransferChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.TransferChunk)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_transfer_id());
+  }
+
+  // uint32 sequence = 2;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequence());
+  }
+
+  // bool last = 4;
+  if (this->_internal_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferChunk::GetClassData() const { return &_class_data_; }
+
+
+void TransferChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferChunk*>(&to_msg);
+  auto& from = static_cast<const TransferChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.TransferChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_transfer_id() != 0) {
+    _this->_internal_set_transfer_id(from._internal_transfer_id());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_last() != 0) {
+    _this->_internal_set_last(from._internal_last());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferChunk::CopyFrom(const TransferChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.TransferChunk)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferChunk::IsInitialized() const {
+  return true;
+}
+
+void TransferChunk::InternalSwap(TransferChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferChunk, _impl_.last_)
+      + sizeof(TransferChunk::_impl_.last_)
+      - PROTOBUF_FIELD_OFFSET(TransferChunk, _impl_.transfer_id_)>(
+          reinterpret_cast<char*>(&_impl_.transfer_id_),
+          reinterpret_cast<char*>(&other->_impl_.transfer_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[13]);
+}
+
+// ===================================================================
+
+class TransferCredit::_Internal {
+ public:
+};
+
+TransferCredit::TransferCredit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.TransferCredit)
+}
+TransferCredit::TransferCredit(const TransferCredit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferCredit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transfer_id_){}
+    , decltype(_impl_.chunks_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.transfer_id_, &from._impl_.transfer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chunks_) -
+    reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.chunks_));
+  // @@protoc_insertion_point(copy_constructor:chat.TransferCredit)
+}
+
+inline void TransferCredit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transfer_id_){uint64_t{0u}}
+    , decltype(_impl_.chunks_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TransferCredit::~TransferCredit() {
+  // @@protoc_insertion_point(destructor:chat.TransferCredit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferCredit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TransferCredit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferCredit::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.TransferCredit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.transfer_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.chunks_) -
+      reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.chunks_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferCredit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 transfer_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.transfer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunks = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.chunks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferCredit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.TransferCredit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_transfer_id(), target);
+  }
+
+  // uint32 chunks = 2;
+  if (this->_internal_chunks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_chunks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.TransferCredit)
+  return target;
+}
+
+size_t TransferCredit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.TransferCredit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_transfer_id());
+  }
+
+  // uint32 chunks = 2;
+  if (this->_internal_chunks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunks());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferCredit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferCredit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferCredit::GetClassData() const { return &_class_data_; }
+
+
+void TransferCredit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferCredit*>(&to_msg);
+  auto& from = static_cast<const TransferCredit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.TransferCredit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_transfer_id() != 0) {
+    _this->_internal_set_transfer_id(from._internal_transfer_id());
+  }
+  if (from._internal_chunks() != 0) {
+    _this->_internal_set_chunks(from._internal_chunks());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferCredit::CopyFrom(const TransferCredit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.TransferCredit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferCredit::IsInitialized() const {
+  return true;
+}
+
+void TransferCredit::InternalSwap(TransferCredit* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferCredit, _impl_.chunks_)
+      + sizeof(TransferCredit::_impl_.chunks_)
+      - PROTOBUF_FIELD_OFFSET(TransferCredit, _impl_.transfer_id_)>(
+          reinterpret_cast<char*>(&_impl_.transfer_id_),
+          reinterpret_cast<char*>(&other->_impl_.transfer_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferCredit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[14]);
+}
+
+// ===================================================================
+
+class ServerShutdown::_Internal {
+ public:
+};
+
+ServerShutdown::ServerShutdown(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ServerShutdown)
+}
+ServerShutdown::ServerShutdown(const ServerShutdown& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerShutdown* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.reconnect_after_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.reconnect_after_ms_ = from._impl_.reconnect_after_ms_;
+  // @@protoc_insertion_point(copy_constructor:chat.ServerShutdown)
+}
+
+inline void ServerShutdown::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.reconnect_after_ms_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerShutdown::~ServerShutdown() {
+  // @@protoc_insertion_point(destructor:chat.ServerShutdown)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerShutdown::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ServerShutdown::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerShutdown::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ServerShutdown)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.reconnect_after_ms_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerShutdown::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 reconnect_after_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.reconnect_after_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerShutdown::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ServerShutdown)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 reconnect_after_ms = 1;
+  if (this->_internal_reconnect_after_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_reconnect_after_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ServerShutdown)
+  return target;
+}
+
+size_t ServerShutdown::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ServerShutdown)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 reconnect_after_ms = 1;
+  if (this->_internal_reconnect_after_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_reconnect_after_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerShutdown::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerShutdown::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerShutdown::GetClassData() const { return &_class_data_; }
+
+
+void ServerShutdown::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerShutdown*>(&to_msg);
+  auto& from = static_cast<const ServerShutdown&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ServerShutdown)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_reconnect_after_ms() != 0) {
+    _this->_internal_set_reconnect_after_ms(from._internal_reconnect_after_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerShutdown::CopyFrom(const ServerShutdown& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ServerShutdown)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerShutdown::IsInitialized() const {
+  return true;
+}
+
+void ServerShutdown::InternalSwap(ServerShutdown* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.reconnect_after_ms_, other->_impl_.reconnect_after_ms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerShutdown::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[15]);
+}
+
+// ===================================================================
+
+class UpgradeSession::_Internal {
+ public:
+};
+
+UpgradeSession::UpgradeSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UpgradeSession)
+}
+UpgradeSession::UpgradeSession(const UpgradeSession& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpgradeSession* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channels_){from._impl_.channels_}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.peer_node_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.codec_){}
+    , decltype(_impl_.ack_mode_){}
+    , decltype(_impl_.presence_){}
+    , decltype(_impl_.shared_memory_){}
+    , decltype(_impl_.pending_input_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.peer_node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_peer_node().empty()) {
+    _this->_impl_.peer_node_.Set(from._internal_peer_node(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pending_input_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.pending_input_));
+  // @@protoc_insertion_point(copy_constructor:chat.UpgradeSession)
+}
+
+inline void UpgradeSession::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channels_){arena}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.peer_node_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.codec_){0}
+    , decltype(_impl_.ack_mode_){false}
+    , decltype(_impl_.presence_){false}
+    , decltype(_impl_.shared_memory_){false}
+    , decltype(_impl_.pending_input_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.peer_node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.peer_node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UpgradeSession::~UpgradeSession() {
+  // @@protoc_insertion_point(destructor:chat.UpgradeSession)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpgradeSession::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channels_.~RepeatedPtrField();
+  _impl_.username_.Destroy();
+  _impl_.ip_.Destroy();
+  _impl_.peer_node_.Destroy();
+}
+
+void UpgradeSession::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpgradeSession::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UpgradeSession)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.channels_.Clear();
+  _impl_.username_.ClearToEmpty();
+  _impl_.ip_.ClearToEmpty();
+  _impl_.peer_node_.ClearToEmpty();
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.pending_input_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.pending_input_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpgradeSession::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UpgradeSession.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ack_mode = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ack_mode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Codec codec = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_codec(static_cast<::chat::Codec>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool presence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.presence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string channels = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_channels();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "chat.UpgradeSession.channels"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 pending_input = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.pending_input_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string ip = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UpgradeSession.ip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string peer_node = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_peer_node();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UpgradeSession.peer_node"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool shared_memory = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.shared_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpgradeSession::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UpgradeSession)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UpgradeSession.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // .chat.UserStatus status = 2;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_status(), target);
+  }
+
+  // bool ack_mode = 3;
+  if (this->_internal_ack_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ack_mode(), target);
+  }
+
+  // .chat.Codec codec = 4;
+  if (this->_internal_codec() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_codec(), target);
+  }
+
+  // bool presence = 5;
+  if (this->_internal_presence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_presence(), target);
+  }
+
+  // repeated string channels = 6;
+  for (int i = 0, n = this->_internal_channels_size(); i < n; i++) {
+    const auto& s = this->_internal_channels(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UpgradeSession.channels");
+    target = stream->WriteString(6, s, target);
+  }
+
+  // uint32 pending_input = 7;
+  if (this->_internal_pending_input() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_pending_input(), target);
+  }
+
+  // string ip = 8;
+  if (!this->_internal_ip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UpgradeSession.ip");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_ip(), target);
+  }
+
+  // string peer_node = 9;
+  if (!this->_internal_peer_node().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_peer_node().data(), static_cast<int>(this->_internal_peer_node().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UpgradeSession.peer_node");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_peer_node(), target);
+  }
+
+  // bool shared_memory = 10;
+  if (this->_internal_shared_memory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_shared_memory(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UpgradeSession)
+  return target;
+}
+
+size_t UpgradeSession::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UpgradeSession)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string channels = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.channels_.size());
+  for (int i = 0, n = _impl_.channels_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.channels_.Get(i));
+  }
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // string ip = 8;
+  if (!this->_internal_ip().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
+  }
+
+  // string peer_node = 9;
+  if (!this->_internal_peer_node().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_peer_node());
+  }
+
+  // .chat.UserStatus status = 2;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // .chat.Codec codec = 4;
+  if (this->_internal_codec() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_codec());
+  }
+
+  // bool ack_mode = 3;
+  if (this->_internal_ack_mode() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool presence = 5;
+  if (this->_internal_presence() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool shared_memory = 10;
+  if (this->_internal_shared_memory() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 pending_input = 7;
+  if (this->_internal_pending_input() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pending_input());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpgradeSession::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpgradeSession::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpgradeSession::GetClassData() const { return &_class_data_; }
+
+
+void UpgradeSession::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpgradeSession*>(&to_msg);
+  auto& from = static_cast<const UpgradeSession&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UpgradeSession)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.channels_.MergeFrom(from._impl_.channels_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
+  }
+  if (!from._internal_peer_node().empty()) {
+    _this->_internal_set_peer_node(from._internal_peer_node());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_codec() != 0) {
+    _this->_internal_set_codec(from._internal_codec());
+  }
+  if (from._internal_ack_mode() != 0) {
+    _this->_internal_set_ack_mode(from._internal_ack_mode());
+  }
+  if (from._internal_presence() != 0) {
+    _this->_internal_set_presence(from._internal_presence());
+  }
+  if (from._internal_shared_memory() != 0) {
+    _this->_internal_set_shared_memory(from._internal_shared_memory());
+  }
+  if (from._internal_pending_input() != 0) {
+    _this->_internal_set_pending_input(from._internal_pending_input());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpgradeSession::CopyFrom(const UpgradeSession& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UpgradeSession)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpgradeSession::IsInitialized() const {
+  return true;
+}
+
+void UpgradeSession::InternalSwap(UpgradeSession* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.channels_.InternalSwap(&other->_impl_.channels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.peer_node_, lhs_arena,
+      &other->_impl_.peer_node_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UpgradeSession, _impl_.pending_input_)
+      + sizeof(UpgradeSession::_impl_.pending_input_)
+      - PROTOBUF_FIELD_OFFSET(UpgradeSession, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpgradeSession::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[16]);
+}
+
+// ===================================================================
+
+class UpgradeDone::_Internal {
+ public:
+};
+
+UpgradeDone::UpgradeDone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UpgradeDone)
+}
+UpgradeDone::UpgradeDone(const UpgradeDone& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpgradeDone* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.registry_version_){}
+    , decltype(_impl_.incarnation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.registry_version_, &from._impl_.registry_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.incarnation_) -
+    reinterpret_cast<char*>(&_impl_.registry_version_)) + sizeof(_impl_.incarnation_));
+  // @@protoc_insertion_point(copy_constructor:chat.UpgradeDone)
+}
+
+inline void UpgradeDone::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.registry_version_){uint64_t{0u}}
+    , decltype(_impl_.incarnation_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UpgradeDone::~UpgradeDone() {
+  // @@protoc_insertion_point(destructor:chat.UpgradeDone)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpgradeDone::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void UpgradeDone::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpgradeDone::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UpgradeDone)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.registry_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.incarnation_) -
+      reinterpret_cast<char*>(&_impl_.registry_version_)) + sizeof(_impl_.incarnation_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpgradeDone::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 registry_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.registry_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 incarnation = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.incarnation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpgradeDone::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UpgradeDone)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 registry_version = 1;
+  if (this->_internal_registry_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_registry_version(), target);
+  }
+
+  // uint64 incarnation = 2;
+  if (this->_internal_incarnation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_incarnation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UpgradeDone)
+  return target;
+}
+
+size_t UpgradeDone::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UpgradeDone)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 registry_version = 1;
+  if (this->_internal_registry_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_registry_version());
+  }
+
+  // uint64 incarnation = 2;
+  if (this->_internal_incarnation() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_incarnation());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpgradeDone::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpgradeDone::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpgradeDone::GetClassData() const { return &_class_data_; }
+
+
+void UpgradeDone::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpgradeDone*>(&to_msg);
+  auto& from = static_cast<const UpgradeDone&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UpgradeDone)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_registry_version() != 0) {
+    _this->_internal_set_registry_version(from._internal_registry_version());
+  }
+  if (from._internal_incarnation() != 0) {
+    _this->_internal_set_incarnation(from._internal_incarnation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpgradeDone::CopyFrom(const UpgradeDone& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UpgradeDone)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpgradeDone::IsInitialized() const {
+  return true;
+}
+
+void UpgradeDone::InternalSwap(UpgradeDone* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UpgradeDone, _impl_.incarnation_)
+      + sizeof(UpgradeDone::_impl_.incarnation_)
+      - PROTOBUF_FIELD_OFFSET(UpgradeDone, _impl_.registry_version_)>(
+          reinterpret_cast<char*>(&_impl_.registry_version_),
+          reinterpret_cast<char*>(&other->_impl_.registry_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpgradeDone::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[17]);
+}
+
+// ===================================================================
+
+class UpgradeRecord::_Internal {
+ public:
+  static const ::chat::UpgradeSession& session(const UpgradeRecord* msg);
+  static const ::chat::UpgradeDone& done(const UpgradeRecord* msg);
+};
+
+const ::chat::UpgradeSession&
+UpgradeRecord::_Internal::session(const UpgradeRecord* msg) {
+  return *msg->_impl_.record_.session_;
+}
+const ::chat::UpgradeDone&
+UpgradeRecord::_Internal::done(const UpgradeRecord* msg) {
+  return *msg->_impl_.record_.done_;
+}
+void UpgradeRecord::set_allocated_session(::chat::UpgradeSession* session) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_record();
+  if (session) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session);
+    if (message_arena != submessage_arena) {
+      session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, session, submessage_arena);
+    }
+    set_has_session();
+    _impl_.record_.session_ = session;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.UpgradeRecord.session)
+}
+void UpgradeRecord::set_allocated_done(::chat::UpgradeDone* done) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_record();
+  if (done) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(done);
+    if (message_arena != submessage_arena) {
+      done = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, done, submessage_arena);
+    }
+    set_has_done();
+    _impl_.record_.done_ = done;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.UpgradeRecord.done)
+}
+UpgradeRecord::UpgradeRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UpgradeRecord)
+}
+UpgradeRecord::UpgradeRecord(const UpgradeRecord& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpgradeRecord* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.record_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_record();
+  switch (from.record_case()) {
+    case kListener: {
+      _this->_internal_set_listener(from._internal_listener());
+      break;
+    }
+    case kSession: {
+      _this->_internal_mutable_session()->::chat::UpgradeSession::MergeFrom(
+          from._internal_session());
+      break;
+    }
+    case kDone: {
+      _this->_internal_mutable_done()->::chat::UpgradeDone::MergeFrom(
+          from._internal_done());
+      break;
+    }
+    case kRequest: {
+      _this->_internal_set_request(from._internal_request());
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.UpgradeRecord)
+}
+
+inline void UpgradeRecord::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.record_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_record();
+}
+
+UpgradeRecord::~UpgradeRecord() {
+  // @@protoc_insertion_point(destructor:chat.UpgradeRecord)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpgradeRecord::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_record()) {
+    clear_record();
+  }
+}
+
+void UpgradeRecord::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpgradeRecord::clear_record() {
+// @@protoc_insertion_point(one_of_clear_start:chat.UpgradeRecord)
+  switch (record_case()) {
+    case kListener: {
+      // No need to clear
+      break;
+    }
+    case kSession: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.record_.session_;
+      }
+      break;
+    }
+    case kDone: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.record_.done_;
+      }
+      break;
+    }
+    case kRequest: {
+      // No need to clear
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = RECORD_NOT_SET;
+}
+
+
+void UpgradeRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UpgradeRecord)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_record();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpgradeRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool listener = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _internal_set_listener(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UpgradeSession session = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UpgradeDone done = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_done(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _internal_set_request(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpgradeRecord::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UpgradeRecord)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool listener = 1;
+  if (_internal_has_listener()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_listener(), target);
+  }
+
+  // .chat.UpgradeSession session = 2;
+  if (_internal_has_session()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::session(this),
+        _Internal::session(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.UpgradeDone done = 3;
+  if (_internal_has_done()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::done(this),
+        _Internal::done(this).GetCachedSize(), target, stream);
+  }
+
+  // bool request = 4;
+  if (_internal_has_request()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_request(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UpgradeRecord)
+  return target;
+}
+
+size_t UpgradeRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UpgradeRecord)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (record_case()) {
+    // bool listener = 1;
+    case kListener: {
+      total_size += 1 + 1;
+      break;
+    }
+    // .chat.UpgradeSession session = 2;
+    case kSession: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.record_.session_);
+      break;
+    }
+    // .chat.UpgradeDone done = 3;
+    case kDone: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.record_.done_);
+      break;
+    }
+    // bool request = 4;
+    case kRequest: {
+      total_size += 1 + 1;
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpgradeRecord::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpgradeRecord::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpgradeRecord::GetClassData() const { return &_class_data_; }
+
+
+void UpgradeRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpgradeRecord*>(&to_msg);
+  auto& from = static_cast<const UpgradeRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UpgradeRecord)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.record_case()) {
+    case kListener: {
+      _this->_internal_set_listener(from._internal_listener());
+      break;
+    }
+    case kSession: {
+      _this->_internal_mutable_session()->::chat::UpgradeSession::MergeFrom(
+          from._internal_session());
+      break;
+    }
+    case kDone: {
+      _this->_internal_mutable_done()->::chat::UpgradeDone::MergeFrom(
+          from._internal_done());
+      break;
+    }
+    case kRequest: {
+      _this->_internal_set_request(from._internal_request());
+      break;
+    }
+    case RECORD_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpgradeRecord::CopyFrom(const UpgradeRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UpgradeRecord)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpgradeRecord::IsInitialized() const {
+  return true;
+}
+
+void UpgradeRecord::InternalSwap(UpgradeRecord* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.record_, other->_impl_.record_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpgradeRecord::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[18]);
+}
+
+// ===================================================================
+
+class PresenceEntry::_Internal {
+ public:
+};
+
+PresenceEntry::PresenceEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceEntry)
+}
+PresenceEntry::PresenceEntry(const PresenceEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.removed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node().empty()) {
+    _this->_impl_.node_.Set(from._internal_node(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.removed_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.removed_));
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceEntry)
+}
+
+inline void PresenceEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.removed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PresenceEntry::~PresenceEntry() {
+  // @@protoc_insertion_point(destructor:chat.PresenceEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.node_.Destroy();
+}
+
+void PresenceEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.node_.ClearToEmpty();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.removed_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.removed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PresenceEntry.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string node = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_node();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PresenceEntry.node"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool removed = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.removed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PresenceEntry.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // string node = 2;
+  if (!this->_internal_node().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node().data(), static_cast<int>(this->_internal_node().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PresenceEntry.node");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_node(), target);
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // uint64 version = 4;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_version(), target);
+  }
+
+  // bool removed = 5;
+  if (this->_internal_removed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_removed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceEntry)
+  return target;
+}
+
+size_t PresenceEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // string node = 2;
+  if (!this->_internal_node().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node());
+  }
+
+  // uint64 version = 4;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // bool removed = 5;
+  if (this->_internal_removed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceEntry::GetClassData() const { return &_class_data_; }
+
+
+void PresenceEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceEntry*>(&to_msg);
+  auto& from = static_cast<const PresenceEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_node().empty()) {
+    _this->_internal_set_node(from._internal_node());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_removed() != 0) {
+    _this->_internal_set_removed(from._internal_removed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceEntry::CopyFrom(const PresenceEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceEntry::IsInitialized() const {
+  return true;
+}
+
+void PresenceEntry::InternalSwap(PresenceEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_, lhs_arena,
+      &other->_impl_.node_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceEntry, _impl_.removed_)
+      + sizeof(PresenceEntry::_impl_.removed_)
+      - PROTOBUF_FIELD_OFFSET(PresenceEntry, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[19]);
+}
+
+// ===================================================================
+
+class NodeVersion::_Internal {
+ public:
+};
+
+NodeVersion::NodeVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.NodeVersion)
+}
+NodeVersion::NodeVersion(const NodeVersion& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeVersion* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_){}
+    , decltype(_impl_.incarnation_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.replace_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node().empty()) {
+    _this->_impl_.node_.Set(from._internal_node(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.incarnation_, &from._impl_.incarnation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replace_) -
+    reinterpret_cast<char*>(&_impl_.incarnation_)) + sizeof(_impl_.replace_));
+  // @@protoc_insertion_point(copy_constructor:chat.NodeVersion)
+}
+
+inline void NodeVersion::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_){}
+    , decltype(_impl_.incarnation_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.replace_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NodeVersion::~NodeVersion() {
+  // @@protoc_insertion_point(destructor:chat.NodeVersion)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeVersion::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.node_.Destroy();
+}
+
+void NodeVersion::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeVersion::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.NodeVersion)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.node_.ClearToEmpty();
+  ::memset(&_impl_.incarnation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replace_) -
+      reinterpret_cast<char*>(&_impl_.incarnation_)) + sizeof(_impl_.replace_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeVersion::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.NodeVersion.node"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 incarnation = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.incarnation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool replace = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.replace_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeVersion::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.NodeVersion)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node = 1;
+  if (!this->_internal_node().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node().data(), static_cast<int>(this->_internal_node().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.NodeVersion.node");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node(), target);
+  }
+
+  // uint64 incarnation = 2;
+  if (this->_internal_incarnation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_incarnation(), target);
+  }
+
+  // uint64 version = 3;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_version(), target);
+  }
+
+  // bool replace = 4;
+  if (this->_internal_replace() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_replace(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.NodeVersion)
+  return target;
+}
+
+size_t NodeVersion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.NodeVersion)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string node = 1;
+  if (!this->_internal_node().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node());
+  }
+
+  // uint64 incarnation = 2;
+  if (this->_internal_incarnation() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_incarnation());
+  }
+
+  // uint64 version = 3;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // bool replace = 4;
+  if (this->_internal_replace() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeVersion::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeVersion::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeVersion::GetClassData() const { return &_class_data_; }
+
+
+void NodeVersion::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeVersion*>(&to_msg);
+  auto& from = static_cast<const NodeVersion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.NodeVersion)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_node().empty()) {
+    _this->_internal_set_node(from._internal_node());
+  }
+  if (from._internal_incarnation() != 0) {
+    _this->_internal_set_incarnation(from._internal_incarnation());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_replace() != 0) {
+    _this->_internal_set_replace(from._internal_replace());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeVersion::CopyFrom(const NodeVersion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.NodeVersion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeVersion::IsInitialized() const {
+  return true;
+}
+
+void NodeVersion::InternalSwap(NodeVersion* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_, lhs_arena,
+      &other->_impl_.node_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeVersion, _impl_.replace_)
+      + sizeof(NodeVersion::_impl_.replace_)
+      - PROTOBUF_FIELD_OFFSET(NodeVersion, _impl_.incarnation_)>(
+          reinterpret_cast<char*>(&_impl_.incarnation_),
+          reinterpret_cast<char*>(&other->_impl_.incarnation_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeVersion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[20]);
+}
+
+// ===================================================================
+
+class ForwardedMessage::_Internal {
+ public:
+};
+
+ForwardedMessage::ForwardedMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ForwardedMessage)
+}
+ForwardedMessage::ForwardedMessage(const ForwardedMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ForwardedMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_recipient().empty()) {
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sender().empty()) {
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ForwardedMessage)
+}
+
+inline void ForwardedMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ForwardedMessage::~ForwardedMessage() {
+  // @@protoc_insertion_point(destructor:chat.ForwardedMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ForwardedMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recipient_.Destroy();
+  _impl_.sender_.Destroy();
+  _impl_.content_.Destroy();
+}
+
+void ForwardedMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ForwardedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ForwardedMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.recipient_.ClearToEmpty();
+  _impl_.sender_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ForwardedMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string recipient = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_recipient();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.ForwardedMessage.recipient"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string sender = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_sender();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.ForwardedMessage.sender"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string content = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.ForwardedMessage.content"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ForwardedMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ForwardedMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string recipient = 1;
+  if (!this->_internal_recipient().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.ForwardedMessage.recipient");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_recipient(), target);
+  }
+
+  // string sender = 2;
+  if (!this->_internal_sender().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.ForwardedMessage.sender");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_sender(), target);
+  }
+
+  // string content = 3;
+  if (!this->_internal_content().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.ForwardedMessage.content");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_content(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ForwardedMessage)
+  return target;
+}
+
+size_t ForwardedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ForwardedMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string recipient = 1;
+  if (!this->_internal_recipient().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_recipient());
+  }
+
+  // string sender = 2;
+  if (!this->_internal_sender().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
+  }
+
+  // string content = 3;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ForwardedMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ForwardedMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ForwardedMessage::GetClassData() const { return &_class_data_; }
+
+
+void ForwardedMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ForwardedMessage*>(&to_msg);
+  auto& from = static_cast<const ForwardedMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ForwardedMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
+  }
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ForwardedMessage::CopyFrom(const ForwardedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ForwardedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ForwardedMessage::IsInitialized() const {
+  return true;
+}
+
+void ForwardedMessage::InternalSwap(ForwardedMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ForwardedMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[21]);
+}
+
+// ===================================================================
+
+class PeerBatch::_Internal {
+ public:
+  static const ::chat::NodeVersion& clock(const PeerBatch* msg);
+};
+
+const ::chat::NodeVersion&
+PeerBatch::_Internal::clock(const PeerBatch* msg) {
+  return *msg->_impl_.clock_;
+}
+PeerBatch::PeerBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PeerBatch)
+}
+PeerBatch::PeerBatch(const PeerBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PeerBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.presence_){from._impl_.presence_}
+    , decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.digest_){from._impl_.digest_}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.secret_){}
+    , decltype(_impl_.clock_){nullptr}
+    , decltype(_impl_.snapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node().empty()) {
+    _this->_impl_.node_.Set(from._internal_node(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.secret_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.secret_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_secret().empty()) {
+    _this->_impl_.secret_.Set(from._internal_secret(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_clock()) {
+    _this->_impl_.clock_ = new ::chat::NodeVersion(*from._impl_.clock_);
+  }
+  _this->_impl_.snapshot_ = from._impl_.snapshot_;
+  // @@protoc_insertion_point(copy_constructor:chat.PeerBatch)
+}
+
+inline void PeerBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.presence_){arena}
+    , decltype(_impl_.messages_){arena}
+    , decltype(_impl_.digest_){arena}
+    , decltype(_impl_.node_){}
+    , decltype(_impl_.secret_){}
+    , decltype(_impl_.clock_){nullptr}
+    , decltype(_impl_.snapshot_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.secret_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.secret_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PeerBatch::~PeerBatch() {
+  // @@protoc_insertion_point(destructor:chat.PeerBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PeerBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.presence_.~RepeatedPtrField();
+  _impl_.messages_.~RepeatedPtrField();
+  _impl_.digest_.~RepeatedPtrField();
+  _impl_.node_.Destroy();
+  _impl_.secret_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.clock_;
+}
+
+void PeerBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PeerBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PeerBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.presence_.Clear();
+  _impl_.messages_.Clear();
+  _impl_.digest_.Clear();
+  _impl_.node_.ClearToEmpty();
+  _impl_.secret_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.clock_ != nullptr) {
+    delete _impl_.clock_;
+  }
+  _impl_.clock_ = nullptr;
+  _impl_.snapshot_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PeerBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string node = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_node();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PeerBatch.node"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool snapshot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PresenceEntry presence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_presence(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.ForwardedMessage messages = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.NodeVersion clock = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clock(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.NodeVersion digest = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_digest(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string secret = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_secret();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PeerBatch.secret"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PeerBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PeerBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string node = 1;
+  if (!this->_internal_node().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node().data(), static_cast<int>(this->_internal_node().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerBatch.node");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_node(), target);
+  }
+
+  // bool snapshot = 2;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_snapshot(), target);
+  }
+
+  // repeated .chat.PresenceEntry presence = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_presence_size()); i < n; i++) {
+    const auto& repfield = this->_internal_presence(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.ForwardedMessage messages = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .chat.NodeVersion clock = 5;
+  if (this->_internal_has_clock()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::clock(this),
+        _Internal::clock(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.NodeVersion digest = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_digest_size()); i < n; i++) {
+    const auto& repfield = this->_internal_digest(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string secret = 7;
+  if (!this->_internal_secret().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_secret().data(), static_cast<int>(this->_internal_secret().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PeerBatch.secret");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_secret(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PeerBatch)
+  return target;
+}
+
+size_t PeerBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PeerBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.PresenceEntry presence = 3;
+  total_size += 1UL * this->_internal_presence_size();
+  for (const auto& msg : this->_impl_.presence_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.ForwardedMessage messages = 4;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.NodeVersion digest = 6;
+  total_size += 1UL * this->_internal_digest_size();
+  for (const auto& msg : this->_impl_.digest_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string node = 1;
+  if (!this->_internal_node().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node());
+  }
+
+  // string secret = 7;
+  if (!this->_internal_secret().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_secret());
+  }
+
+  // .chat.NodeVersion clock = 5;
+  if (this->_internal_has_clock()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.clock_);
+  }
+
+  // bool snapshot = 2;
+  if (this->_internal_snapshot() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PeerBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PeerBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PeerBatch::GetClassData() const { return &_class_data_; }
+
+
+void PeerBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PeerBatch*>(&to_msg);
+  auto& from = static_cast<const PeerBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PeerBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.presence_.MergeFrom(from._impl_.presence_);
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_impl_.digest_.MergeFrom(from._impl_.digest_);
+  if (!from._internal_node().empty()) {
+    _this->_internal_set_node(from._internal_node());
+  }
+  if (!from._internal_secret().empty()) {
+    _this->_internal_set_secret(from._internal_secret());
+  }
+  if (from._internal_has_clock()) {
+    _this->_internal_mutable_clock()->::chat::NodeVersion::MergeFrom(
+        from._internal_clock());
+  }
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PeerBatch::CopyFrom(const PeerBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PeerBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PeerBatch::IsInitialized() const {
+  return true;
+}
+
+void PeerBatch::InternalSwap(PeerBatch* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.presence_.InternalSwap(&other->_impl_.presence_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  _impl_.digest_.InternalSwap(&other->_impl_.digest_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_, lhs_arena,
+      &other->_impl_.node_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.secret_, lhs_arena,
+      &other->_impl_.secret_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PeerBatch, _impl_.snapshot_)
+      + sizeof(PeerBatch::_impl_.snapshot_)
+      - PROTOBUF_FIELD_OFFSET(PeerBatch, _impl_.clock_)>(
+          reinterpret_cast<char*>(&_impl_.clock_),
+          reinterpret_cast<char*>(&other->_impl_.clock_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PeerBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[22]);
+}
+
+// ===================================================================
+
+class GossipUpdate::_Internal {
+ public:
+  static const ::chat::NodeVersion& node(const GossipUpdate* msg);
+};
+
+const ::chat::NodeVersion&
+GossipUpdate::_Internal::node(const GossipUpdate* msg) {
+  return *msg->_impl_.node_;
+}
+GossipUpdate::GossipUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.GossipUpdate)
+}
+GossipUpdate::GossipUpdate(const GossipUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GossipUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.node_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_node()) {
+    _this->_impl_.node_ = new ::chat::NodeVersion(*from._impl_.node_);
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.GossipUpdate)
+}
+
+inline void GossipUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.node_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GossipUpdate::~GossipUpdate() {
+  // @@protoc_insertion_point(destructor:chat.GossipUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GossipUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.node_;
+}
+
+void GossipUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GossipUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.GossipUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.node_ != nullptr) {
+    delete _impl_.node_;
+  }
+  _impl_.node_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GossipUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.NodeVersion node = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_node(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PresenceEntry entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GossipUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.GossipUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.NodeVersion node = 1;
+  if (this->_internal_has_node()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::node(this),
+        _Internal::node(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.PresenceEntry entries = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.GossipUpdate)
+  return target;
+}
+
+size_t GossipUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.GossipUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.PresenceEntry entries = 2;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .chat.NodeVersion node = 1;
+  if (this->_internal_has_node()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.node_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GossipUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GossipUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GossipUpdate::GetClassData() const { return &_class_data_; }
+
+
+void GossipUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GossipUpdate*>(&to_msg);
+  auto& from = static_cast<const GossipUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.GossipUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_has_node()) {
+    _this->_internal_mutable_node()->::chat::NodeVersion::MergeFrom(
+        from._internal_node());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GossipUpdate::CopyFrom(const GossipUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.GossipUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GossipUpdate::IsInitialized() const {
+  return true;
+}
+
+void GossipUpdate::InternalSwap(GossipUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  swap(_impl_.node_, other->_impl_.node_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GossipUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[23]);
+}
+
+// ===================================================================
+
+class UpdateStatusRequest::_Internal {
+ public:
+};
+
+UpdateStatusRequest::UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UpdateStatusRequest)
+}
+UpdateStatusRequest::UpdateStatusRequest(const UpdateStatusRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateStatusRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.new_status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.new_status_ = from._impl_.new_status_;
+  // @@protoc_insertion_point(copy_constructor:chat.UpdateStatusRequest)
+}
+
+inline void UpdateStatusRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.new_status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UpdateStatusRequest::~UpdateStatusRequest() {
+  // @@protoc_insertion_point(destructor:chat.UpdateStatusRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpdateStatusRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void UpdateStatusRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpdateStatusRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UpdateStatusRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.new_status_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateStatusRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UpdateStatusRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus new_status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_new_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpdateStatusRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UpdateStatusRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "chat.UpdateStatusRequest.username");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_username(), target);
   }
 
   // .chat.UserStatus new_status = 2;
-  if (this->new_status() != 0) {
+  if (this->_internal_new_status() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_new_status(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.UpdateStatusRequest)
@@ -1998,67 +8064,48 @@ size_t UpdateStatusRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.UpdateStatusRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_username());
   }
 
   // .chat.UserStatus new_status = 2;
-  if (this->new_status() != 0) {
+  if (this->_internal_new_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_new_status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_new_status());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateStatusRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.UpdateStatusRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateStatusRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UpdateStatusRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.UpdateStatusRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.UpdateStatusRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateStatusRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateStatusRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateStatusRequest::GetClassData() const { return &_class_data_; }
 
-void UpdateStatusRequest::MergeFrom(const UpdateStatusRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.UpdateStatusRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void UpdateStatusRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateStatusRequest*>(&to_msg);
+  auto& from = static_cast<const UpdateStatusRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UpdateStatusRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.username().size() > 0) {
-    _internal_set_username(from._internal_username());
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.new_status() != 0) {
-    _internal_set_new_status(from._internal_new_status());
+  if (from._internal_new_status() != 0) {
+    _this->_internal_set_new_status(from._internal_new_status());
   }
-}
-
-void UpdateStatusRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.UpdateStatusRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UpdateStatusRequest::CopyFrom(const UpdateStatusRequest& from) {
@@ -2074,30 +8121,24 @@ bool UpdateStatusRequest::IsInitialized() const {
 
 void UpdateStatusRequest::InternalSwap(UpdateStatusRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  username_.Swap(&other->username_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(new_status_, other->new_status_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.new_status_, other->_impl_.new_status_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata UpdateStatusRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[24]);
 }
 
-
 // ===================================================================
 
-void Request::InitAsDefaultInstance() {
-  ::chat::_Request_default_instance_.register_user_ = const_cast< ::chat::NewUserRequest*>(
-      ::chat::NewUserRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.send_message_ = const_cast< ::chat::SendMessageRequest*>(
-      ::chat::SendMessageRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.update_status_ = const_cast< ::chat::UpdateStatusRequest*>(
-      ::chat::UpdateStatusRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.get_users_ = const_cast< ::chat::UserListRequest*>(
-      ::chat::UserListRequest::internal_default_instance());
-  ::chat::_Request_default_instance_.unregister_user_ = const_cast< ::chat::User*>(
-      ::chat::User::internal_default_instance());
-}
 class Request::_Internal {
  public:
   static const ::chat::NewUserRequest& register_user(const Request* msg);
@@ -2105,133 +8146,295 @@ class Request::_Internal {
   static const ::chat::UpdateStatusRequest& update_status(const Request* msg);
   static const ::chat::UserListRequest& get_users(const Request* msg);
   static const ::chat::User& unregister_user(const Request* msg);
+  static const ::chat::AckRequest& ack(const Request* msg);
+  static const ::chat::ChannelRequest& channel(const Request* msg);
+  static const ::chat::PresenceSubscribeRequest& subscribe_presence(const Request* msg);
+  static const ::chat::TransferStart& transfer_start(const Request* msg);
+  static const ::chat::TransferChunk& transfer_chunk(const Request* msg);
+  static const ::chat::PeerBatch& peer_batch(const Request* msg);
 };
 
 const ::chat::NewUserRequest&
 Request::_Internal::register_user(const Request* msg) {
-  return *msg->payload_.register_user_;
+  return *msg->_impl_.payload_.register_user_;
 }
 const ::chat::SendMessageRequest&
 Request::_Internal::send_message(const Request* msg) {
-  return *msg->payload_.send_message_;
+  return *msg->_impl_.payload_.send_message_;
 }
 const ::chat::UpdateStatusRequest&
 Request::_Internal::update_status(const Request* msg) {
-  return *msg->payload_.update_status_;
+  return *msg->_impl_.payload_.update_status_;
 }
 const ::chat::UserListRequest&
 Request::_Internal::get_users(const Request* msg) {
-  return *msg->payload_.get_users_;
+  return *msg->_impl_.payload_.get_users_;
 }
 const ::chat::User&
 Request::_Internal::unregister_user(const Request* msg) {
-  return *msg->payload_.unregister_user_;
+  return *msg->_impl_.payload_.unregister_user_;
+}
+const ::chat::AckRequest&
+Request::_Internal::ack(const Request* msg) {
+  return *msg->_impl_.payload_.ack_;
+}
+const ::chat::ChannelRequest&
+Request::_Internal::channel(const Request* msg) {
+  return *msg->_impl_.payload_.channel_;
+}
+const ::chat::PresenceSubscribeRequest&
+Request::_Internal::subscribe_presence(const Request* msg) {
+  return *msg->_impl_.payload_.subscribe_presence_;
+}
+const ::chat::TransferStart&
+Request::_Internal::transfer_start(const Request* msg) {
+  return *msg->_impl_.payload_.transfer_start_;
+}
+const ::chat::TransferChunk&
+Request::_Internal::transfer_chunk(const Request* msg) {
+  return *msg->_impl_.payload_.transfer_chunk_;
+}
+const ::chat::PeerBatch&
+Request::_Internal::peer_batch(const Request* msg) {
+  return *msg->_impl_.payload_.peer_batch_;
 }
 void Request::set_allocated_register_user(::chat::NewUserRequest* register_user) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
   if (register_user) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(register_user);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(register_user);
     if (message_arena != submessage_arena) {
       register_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, register_user, submessage_arena);
     }
     set_has_register_user();
-    payload_.register_user_ = register_user;
+    _impl_.payload_.register_user_ = register_user;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Request.register_user)
 }
 void Request::set_allocated_send_message(::chat::SendMessageRequest* send_message) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
   if (send_message) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(send_message);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(send_message);
     if (message_arena != submessage_arena) {
       send_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, send_message, submessage_arena);
     }
     set_has_send_message();
-    payload_.send_message_ = send_message;
+    _impl_.payload_.send_message_ = send_message;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Request.send_message)
 }
 void Request::set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
   if (update_status) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(update_status);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_status);
     if (message_arena != submessage_arena) {
       update_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, update_status, submessage_arena);
     }
     set_has_update_status();
-    payload_.update_status_ = update_status;
+    _impl_.payload_.update_status_ = update_status;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Request.update_status)
 }
 void Request::set_allocated_get_users(::chat::UserListRequest* get_users) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
   if (get_users) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(get_users);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get_users);
     if (message_arena != submessage_arena) {
       get_users = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, get_users, submessage_arena);
     }
     set_has_get_users();
-    payload_.get_users_ = get_users;
+    _impl_.payload_.get_users_ = get_users;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Request.get_users)
 }
 void Request::set_allocated_unregister_user(::chat::User* unregister_user) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
   if (unregister_user) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(unregister_user);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unregister_user);
     if (message_arena != submessage_arena) {
       unregister_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, unregister_user, submessage_arena);
     }
     set_has_unregister_user();
-    payload_.unregister_user_ = unregister_user;
+    _impl_.payload_.unregister_user_ = unregister_user;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Request.unregister_user)
 }
-Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+void Request::set_allocated_ack(::chat::AckRequest* ack) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (ack) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ack);
+    if (message_arena != submessage_arena) {
+      ack = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ack, submessage_arena);
+    }
+    set_has_ack();
+    _impl_.payload_.ack_ = ack;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.ack)
+}
+void Request::set_allocated_channel(::chat::ChannelRequest* channel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (channel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel);
+    if (message_arena != submessage_arena) {
+      channel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channel, submessage_arena);
+    }
+    set_has_channel();
+    _impl_.payload_.channel_ = channel;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.channel)
+}
+void Request::set_allocated_subscribe_presence(::chat::PresenceSubscribeRequest* subscribe_presence) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (subscribe_presence) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(subscribe_presence);
+    if (message_arena != submessage_arena) {
+      subscribe_presence = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, subscribe_presence, submessage_arena);
+    }
+    set_has_subscribe_presence();
+    _impl_.payload_.subscribe_presence_ = subscribe_presence;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.subscribe_presence)
+}
+void Request::set_allocated_transfer_start(::chat::TransferStart* transfer_start) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (transfer_start) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transfer_start);
+    if (message_arena != submessage_arena) {
+      transfer_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transfer_start, submessage_arena);
+    }
+    set_has_transfer_start();
+    _impl_.payload_.transfer_start_ = transfer_start;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.transfer_start)
+}
+void Request::set_allocated_transfer_chunk(::chat::TransferChunk* transfer_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (transfer_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transfer_chunk);
+    if (message_arena != submessage_arena) {
+      transfer_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transfer_chunk, submessage_arena);
+    }
+    set_has_transfer_chunk();
+    _impl_.payload_.transfer_chunk_ = transfer_chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.transfer_chunk)
+}
+void Request::set_allocated_peer_batch(::chat::PeerBatch* peer_batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (peer_batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(peer_batch);
+    if (message_arena != submessage_arena) {
+      peer_batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, peer_batch, submessage_arena);
+    }
+    set_has_peer_batch();
+    _impl_.payload_.peer_batch_ = peer_batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.peer_batch)
+}
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.Request)
 }
 Request::Request(const Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  operation_ = from.operation_;
+  _this->_impl_.operation_ = from._impl_.operation_;
   clear_has_payload();
   switch (from.payload_case()) {
     case kRegisterUser: {
-      _internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(from._internal_register_user());
+      _this->_internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(
+          from._internal_register_user());
       break;
     }
     case kSendMessage: {
-      _internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(from._internal_send_message());
+      _this->_internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(
+          from._internal_send_message());
       break;
     }
     case kUpdateStatus: {
-      _internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(from._internal_update_status());
+      _this->_internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(
+          from._internal_update_status());
       break;
     }
     case kGetUsers: {
-      _internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(from._internal_get_users());
+      _this->_internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(
+          from._internal_get_users());
       break;
     }
     case kUnregisterUser: {
-      _internal_mutable_unregister_user()->::chat::User::MergeFrom(from._internal_unregister_user());
+      _this->_internal_mutable_unregister_user()->::chat::User::MergeFrom(
+          from._internal_unregister_user());
+      break;
+    }
+    case kAck: {
+      _this->_internal_mutable_ack()->::chat::AckRequest::MergeFrom(
+          from._internal_ack());
+      break;
+    }
+    case kChannel: {
+      _this->_internal_mutable_channel()->::chat::ChannelRequest::MergeFrom(
+          from._internal_channel());
+      break;
+    }
+    case kSubscribePresence: {
+      _this->_internal_mutable_subscribe_presence()->::chat::PresenceSubscribeRequest::MergeFrom(
+          from._internal_subscribe_presence());
+      break;
+    }
+    case kTransferStart: {
+      _this->_internal_mutable_transfer_start()->::chat::TransferStart::MergeFrom(
+          from._internal_transfer_start());
+      break;
+    }
+    case kTransferChunk: {
+      _this->_internal_mutable_transfer_chunk()->::chat::TransferChunk::MergeFrom(
+          from._internal_transfer_chunk());
+      break;
+    }
+    case kPeerBatch: {
+      _this->_internal_mutable_peer_batch()->::chat::PeerBatch::MergeFrom(
+          from._internal_peer_batch());
       break;
     }
     case PAYLOAD_NOT_SET: {
@@ -2241,70 +8444,105 @@ Request::Request(const Request& from)
   // @@protoc_insertion_point(copy_constructor:chat.Request)
 }
 
-void Request::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Request_chat_2eproto.base);
-  operation_ = 0;
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){0}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_payload();
 }
 
 Request::~Request() {
   // @@protoc_insertion_point(destructor:chat.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Request::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_payload()) {
     clear_payload();
   }
 }
 
-void Request::ArenaDtor(void* object) {
-  Request* _this = reinterpret_cast< Request* >(object);
-  (void)_this;
-}
-void Request::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Request::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Request& Request::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Request_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Request::clear_payload() {
 // @@protoc_insertion_point(one_of_clear_start:chat.Request)
   switch (payload_case()) {
     case kRegisterUser: {
-      if (GetArena() == nullptr) {
-        delete payload_.register_user_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.register_user_;
       }
       break;
     }
     case kSendMessage: {
-      if (GetArena() == nullptr) {
-        delete payload_.send_message_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.send_message_;
       }
       break;
     }
     case kUpdateStatus: {
-      if (GetArena() == nullptr) {
-        delete payload_.update_status_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.update_status_;
       }
       break;
     }
     case kGetUsers: {
-      if (GetArena() == nullptr) {
-        delete payload_.get_users_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.get_users_;
       }
       break;
     }
     case kUnregisterUser: {
-      if (GetArena() == nullptr) {
-        delete payload_.unregister_user_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.unregister_user_;
+      }
+      break;
+    }
+    case kAck: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.ack_;
+      }
+      break;
+    }
+    case kChannel: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.channel_;
+      }
+      break;
+    }
+    case kSubscribePresence: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.subscribe_presence_;
+      }
+      break;
+    }
+    case kTransferStart: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.transfer_start_;
+      }
+      break;
+    }
+    case kTransferChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.transfer_chunk_;
+      }
+      break;
+    }
+    case kPeerBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.peer_batch_;
       }
       break;
     }
@@ -2312,149 +8550,239 @@ void Request::clear_payload() {
       break;
     }
   }
-  _oneof_case_[0] = PAYLOAD_NOT_SET;
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
 }
 
 
 void Request::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.Request)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  operation_ = 0;
+  _impl_.operation_ = 0;
   clear_payload();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Request::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .chat.Operation operation = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_operation(static_cast<::chat::Operation>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.NewUserRequest register_user = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_register_user(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.SendMessageRequest send_message = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_send_message(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UpdateStatusRequest update_status = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_update_status(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UserListRequest get_users = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ctx->ParseMessage(_internal_mutable_get_users(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.User unregister_user = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_unregister_user(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .chat.AckRequest ack = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ack(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .chat.ChannelRequest channel = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.PresenceSubscribeRequest subscribe_presence = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_subscribe_presence(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.TransferStart transfer_start = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transfer_start(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.TransferChunk transfer_chunk = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transfer_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.PeerBatch peer_batch = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_peer_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Request::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.Request)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
+  if (this->_internal_operation() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_operation(), target);
   }
 
   // .chat.NewUserRequest register_user = 2;
   if (_internal_has_register_user()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::register_user(this), target, stream);
+      InternalWriteMessage(2, _Internal::register_user(this),
+        _Internal::register_user(this).GetCachedSize(), target, stream);
   }
 
   // .chat.SendMessageRequest send_message = 3;
   if (_internal_has_send_message()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::send_message(this), target, stream);
+      InternalWriteMessage(3, _Internal::send_message(this),
+        _Internal::send_message(this).GetCachedSize(), target, stream);
   }
 
   // .chat.UpdateStatusRequest update_status = 4;
   if (_internal_has_update_status()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::update_status(this), target, stream);
+      InternalWriteMessage(4, _Internal::update_status(this),
+        _Internal::update_status(this).GetCachedSize(), target, stream);
   }
 
   // .chat.UserListRequest get_users = 5;
   if (_internal_has_get_users()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::get_users(this), target, stream);
+      InternalWriteMessage(5, _Internal::get_users(this),
+        _Internal::get_users(this).GetCachedSize(), target, stream);
   }
 
   // .chat.User unregister_user = 6;
   if (_internal_has_unregister_user()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::unregister_user(this), target, stream);
+      InternalWriteMessage(6, _Internal::unregister_user(this),
+        _Internal::unregister_user(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.AckRequest ack = 7;
+  if (_internal_has_ack()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::ack(this),
+        _Internal::ack(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.ChannelRequest channel = 8;
+  if (_internal_has_channel()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::channel(this),
+        _Internal::channel(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.PresenceSubscribeRequest subscribe_presence = 9;
+  if (_internal_has_subscribe_presence()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::subscribe_presence(this),
+        _Internal::subscribe_presence(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.TransferStart transfer_start = 10;
+  if (_internal_has_transfer_start()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::transfer_start(this),
+        _Internal::transfer_start(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.TransferChunk transfer_chunk = 11;
+  if (_internal_has_transfer_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::transfer_chunk(this),
+        _Internal::transfer_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.PeerBatch peer_batch = 12;
+  if (_internal_has_peer_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::peer_batch(this),
+        _Internal::peer_batch(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.Request)
@@ -2465,14 +8793,14 @@ size_t Request::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.Request)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
+  if (this->_internal_operation() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_operation());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
   }
 
   switch (payload_case()) {
@@ -2480,107 +8808,165 @@ size_t Request::ByteSizeLong() const {
     case kRegisterUser: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.register_user_);
+          *_impl_.payload_.register_user_);
       break;
     }
     // .chat.SendMessageRequest send_message = 3;
     case kSendMessage: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.send_message_);
+          *_impl_.payload_.send_message_);
       break;
     }
     // .chat.UpdateStatusRequest update_status = 4;
     case kUpdateStatus: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.update_status_);
+          *_impl_.payload_.update_status_);
       break;
     }
     // .chat.UserListRequest get_users = 5;
     case kGetUsers: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.get_users_);
+          *_impl_.payload_.get_users_);
       break;
     }
     // .chat.User unregister_user = 6;
     case kUnregisterUser: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *payload_.unregister_user_);
+          *_impl_.payload_.unregister_user_);
       break;
     }
-    case PAYLOAD_NOT_SET: {
+    // .chat.AckRequest ack = 7;
+    case kAck: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.ack_);
+      break;
+    }
+    // .chat.ChannelRequest channel = 8;
+    case kChannel: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.channel_);
+      break;
+    }
+    // .chat.PresenceSubscribeRequest subscribe_presence = 9;
+    case kSubscribePresence: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.subscribe_presence_);
+      break;
+    }
+    // .chat.TransferStart transfer_start = 10;
+    case kTransferStart: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.transfer_start_);
+      break;
+    }
+    // .chat.TransferChunk transfer_chunk = 11;
+    case kTransferChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.transfer_chunk_);
+      break;
+    }
+    // .chat.PeerBatch peer_batch = 12;
+    case kPeerBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.peer_batch_);
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Request::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.Request)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Request* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Request>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.Request)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.Request)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
 
-void Request::MergeFrom(const Request& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.Request)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.operation() != 0) {
-    _internal_set_operation(from._internal_operation());
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
   }
   switch (from.payload_case()) {
     case kRegisterUser: {
-      _internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(from._internal_register_user());
+      _this->_internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(
+          from._internal_register_user());
       break;
     }
     case kSendMessage: {
-      _internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(from._internal_send_message());
+      _this->_internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(
+          from._internal_send_message());
       break;
     }
     case kUpdateStatus: {
-      _internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(from._internal_update_status());
+      _this->_internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(
+          from._internal_update_status());
       break;
     }
     case kGetUsers: {
-      _internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(from._internal_get_users());
+      _this->_internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(
+          from._internal_get_users());
       break;
     }
     case kUnregisterUser: {
-      _internal_mutable_unregister_user()->::chat::User::MergeFrom(from._internal_unregister_user());
+      _this->_internal_mutable_unregister_user()->::chat::User::MergeFrom(
+          from._internal_unregister_user());
+      break;
+    }
+    case kAck: {
+      _this->_internal_mutable_ack()->::chat::AckRequest::MergeFrom(
+          from._internal_ack());
+      break;
+    }
+    case kChannel: {
+      _this->_internal_mutable_channel()->::chat::ChannelRequest::MergeFrom(
+          from._internal_channel());
+      break;
+    }
+    case kSubscribePresence: {
+      _this->_internal_mutable_subscribe_presence()->::chat::PresenceSubscribeRequest::MergeFrom(
+          from._internal_subscribe_presence());
+      break;
+    }
+    case kTransferStart: {
+      _this->_internal_mutable_transfer_start()->::chat::TransferStart::MergeFrom(
+          from._internal_transfer_start());
+      break;
+    }
+    case kTransferChunk: {
+      _this->_internal_mutable_transfer_chunk()->::chat::TransferChunk::MergeFrom(
+          from._internal_transfer_chunk());
+      break;
+    }
+    case kPeerBatch: {
+      _this->_internal_mutable_peer_batch()->::chat::PeerBatch::MergeFrom(
+          from._internal_peer_batch());
       break;
     }
     case PAYLOAD_NOT_SET: {
       break;
     }
   }
-}
-
-void Request::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.Request)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Request::CopyFrom(const Request& from) {
@@ -2596,94 +8982,289 @@ bool Request::IsInitialized() const {
 
 void Request::InternalSwap(Request* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(operation_, other->operation_);
-  swap(payload_, other->payload_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.operation_, other->_impl_.operation_);
+  swap(_impl_.payload_, other->_impl_.payload_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[25]);
 }
 
-
 // ===================================================================
 
-void Response::InitAsDefaultInstance() {
-  ::chat::_Response_default_instance_.user_list_ = const_cast< ::chat::UserListResponse*>(
-      ::chat::UserListResponse::internal_default_instance());
-  ::chat::_Response_default_instance_.incoming_message_ = const_cast< ::chat::IncomingMessageResponse*>(
-      ::chat::IncomingMessageResponse::internal_default_instance());
-}
 class Response::_Internal {
  public:
   static const ::chat::UserListResponse& user_list(const Response* msg);
   static const ::chat::IncomingMessageResponse& incoming_message(const Response* msg);
+  static const ::chat::DeliveryReceipt& delivery_receipt(const Response* msg);
+  static const ::chat::PresenceUpdate& presence(const Response* msg);
+  static const ::chat::TransferStart& transfer_start(const Response* msg);
+  static const ::chat::TransferChunk& transfer_chunk(const Response* msg);
+  static const ::chat::TransferCredit& transfer_credit(const Response* msg);
+  static const ::chat::ServerShutdown& server_shutdown(const Response* msg);
+  static const ::chat::GossipUpdate& gossip(const Response* msg);
 };
 
 const ::chat::UserListResponse&
 Response::_Internal::user_list(const Response* msg) {
-  return *msg->result_.user_list_;
+  return *msg->_impl_.result_.user_list_;
 }
 const ::chat::IncomingMessageResponse&
 Response::_Internal::incoming_message(const Response* msg) {
-  return *msg->result_.incoming_message_;
+  return *msg->_impl_.result_.incoming_message_;
+}
+const ::chat::DeliveryReceipt&
+Response::_Internal::delivery_receipt(const Response* msg) {
+  return *msg->_impl_.result_.delivery_receipt_;
+}
+const ::chat::PresenceUpdate&
+Response::_Internal::presence(const Response* msg) {
+  return *msg->_impl_.result_.presence_;
+}
+const ::chat::TransferStart&
+Response::_Internal::transfer_start(const Response* msg) {
+  return *msg->_impl_.result_.transfer_start_;
+}
+const ::chat::TransferChunk&
+Response::_Internal::transfer_chunk(const Response* msg) {
+  return *msg->_impl_.result_.transfer_chunk_;
+}
+const ::chat::TransferCredit&
+Response::_Internal::transfer_credit(const Response* msg) {
+  return *msg->_impl_.result_.transfer_credit_;
+}
+const ::chat::ServerShutdown&
+Response::_Internal::server_shutdown(const Response* msg) {
+  return *msg->_impl_.result_.server_shutdown_;
+}
+const ::chat::GossipUpdate&
+Response::_Internal::gossip(const Response* msg) {
+  return *msg->_impl_.result_.gossip_;
 }
 void Response::set_allocated_user_list(::chat::UserListResponse* user_list) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_result();
   if (user_list) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(user_list);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user_list);
     if (message_arena != submessage_arena) {
       user_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, user_list, submessage_arena);
     }
     set_has_user_list();
-    result_.user_list_ = user_list;
+    _impl_.result_.user_list_ = user_list;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Response.user_list)
 }
 void Response::set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_result();
   if (incoming_message) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(incoming_message);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(incoming_message);
     if (message_arena != submessage_arena) {
       incoming_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, incoming_message, submessage_arena);
     }
     set_has_incoming_message();
-    result_.incoming_message_ = incoming_message;
+    _impl_.result_.incoming_message_ = incoming_message;
   }
   // @@protoc_insertion_point(field_set_allocated:chat.Response.incoming_message)
 }
-Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+void Response::set_allocated_delivery_receipt(::chat::DeliveryReceipt* delivery_receipt) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (delivery_receipt) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(delivery_receipt);
+    if (message_arena != submessage_arena) {
+      delivery_receipt = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, delivery_receipt, submessage_arena);
+    }
+    set_has_delivery_receipt();
+    _impl_.result_.delivery_receipt_ = delivery_receipt;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.delivery_receipt)
+}
+void Response::set_allocated_presence(::chat::PresenceUpdate* presence) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (presence) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(presence);
+    if (message_arena != submessage_arena) {
+      presence = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, presence, submessage_arena);
+    }
+    set_has_presence();
+    _impl_.result_.presence_ = presence;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.presence)
+}
+void Response::set_allocated_transfer_start(::chat::TransferStart* transfer_start) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (transfer_start) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transfer_start);
+    if (message_arena != submessage_arena) {
+      transfer_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transfer_start, submessage_arena);
+    }
+    set_has_transfer_start();
+    _impl_.result_.transfer_start_ = transfer_start;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.transfer_start)
+}
+void Response::set_allocated_transfer_chunk(::chat::TransferChunk* transfer_chunk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (transfer_chunk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transfer_chunk);
+    if (message_arena != submessage_arena) {
+      transfer_chunk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transfer_chunk, submessage_arena);
+    }
+    set_has_transfer_chunk();
+    _impl_.result_.transfer_chunk_ = transfer_chunk;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.transfer_chunk)
+}
+void Response::set_allocated_transfer_credit(::chat::TransferCredit* transfer_credit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (transfer_credit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transfer_credit);
+    if (message_arena != submessage_arena) {
+      transfer_credit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transfer_credit, submessage_arena);
+    }
+    set_has_transfer_credit();
+    _impl_.result_.transfer_credit_ = transfer_credit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.transfer_credit)
+}
+void Response::set_allocated_server_shutdown(::chat::ServerShutdown* server_shutdown) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (server_shutdown) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server_shutdown);
+    if (message_arena != submessage_arena) {
+      server_shutdown = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, server_shutdown, submessage_arena);
+    }
+    set_has_server_shutdown();
+    _impl_.result_.server_shutdown_ = server_shutdown;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.server_shutdown)
+}
+void Response::set_allocated_gossip(::chat::GossipUpdate* gossip) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (gossip) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gossip);
+    if (message_arena != submessage_arena) {
+      gossip = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gossip, submessage_arena);
+    }
+    set_has_gossip();
+    _impl_.result_.gossip_ = gossip;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.gossip)
+}
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:chat.Response)
 }
 Response::Response(const Response& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.redirect_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.status_code_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.codec_){}
+    , decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_message().empty()) {
-    message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_message(),
-      GetArena());
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.redirect_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.redirect_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_redirect().empty()) {
+    _this->_impl_.redirect_.Set(from._internal_redirect(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&operation_, &from.operation_,
-    static_cast<size_t>(reinterpret_cast<char*>(&status_code_) -
-    reinterpret_cast<char*>(&operation_)) + sizeof(status_code_));
+  ::memcpy(&_impl_.operation_, &from._impl_.operation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.codec_) -
+    reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.codec_));
   clear_has_result();
   switch (from.result_case()) {
     case kUserList: {
-      _internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(from._internal_user_list());
+      _this->_internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(
+          from._internal_user_list());
       break;
     }
     case kIncomingMessage: {
-      _internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(from._internal_incoming_message());
+      _this->_internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(
+          from._internal_incoming_message());
+      break;
+    }
+    case kDeliveryReceipt: {
+      _this->_internal_mutable_delivery_receipt()->::chat::DeliveryReceipt::MergeFrom(
+          from._internal_delivery_receipt());
+      break;
+    }
+    case kPresence: {
+      _this->_internal_mutable_presence()->::chat::PresenceUpdate::MergeFrom(
+          from._internal_presence());
+      break;
+    }
+    case kTransferStart: {
+      _this->_internal_mutable_transfer_start()->::chat::TransferStart::MergeFrom(
+          from._internal_transfer_start());
+      break;
+    }
+    case kTransferChunk: {
+      _this->_internal_mutable_transfer_chunk()->::chat::TransferChunk::MergeFrom(
+          from._internal_transfer_chunk());
+      break;
+    }
+    case kTransferCredit: {
+      _this->_internal_mutable_transfer_credit()->::chat::TransferCredit::MergeFrom(
+          from._internal_transfer_credit());
+      break;
+    }
+    case kServerShutdown: {
+      _this->_internal_mutable_server_shutdown()->::chat::ServerShutdown::MergeFrom(
+          from._internal_server_shutdown());
+      break;
+    }
+    case kGossip: {
+      _this->_internal_mutable_gossip()->::chat::GossipUpdate::MergeFrom(
+          from._internal_gossip());
       break;
     }
     case RESULT_NOT_SET: {
@@ -2693,56 +9274,108 @@ Response::Response(const Response& from)
   // @@protoc_insertion_point(copy_constructor:chat.Response)
 }
 
-void Response::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Response_chat_2eproto.base);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&operation_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_code_) -
-      reinterpret_cast<char*>(&operation_)) + sizeof(status_code_));
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.redirect_){}
+    , decltype(_impl_.operation_){0}
+    , decltype(_impl_.status_code_){0}
+    , decltype(_impl_.message_id_){uint64_t{0u}}
+    , decltype(_impl_.codec_){0}
+    , decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.redirect_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.redirect_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_result();
 }
 
 Response::~Response() {
   // @@protoc_insertion_point(destructor:chat.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Response::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+  _impl_.redirect_.Destroy();
   if (has_result()) {
     clear_result();
   }
 }
 
-void Response::ArenaDtor(void* object) {
-  Response* _this = reinterpret_cast< Response* >(object);
-  (void)_this;
-}
-void Response::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Response::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Response& Response::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Response_chat_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Response::clear_result() {
 // @@protoc_insertion_point(one_of_clear_start:chat.Response)
   switch (result_case()) {
     case kUserList: {
-      if (GetArena() == nullptr) {
-        delete result_.user_list_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.user_list_;
       }
       break;
     }
     case kIncomingMessage: {
-      if (GetArena() == nullptr) {
-        delete result_.incoming_message_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.incoming_message_;
+      }
+      break;
+    }
+    case kDeliveryReceipt: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.delivery_receipt_;
+      }
+      break;
+    }
+    case kPresence: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.presence_;
+      }
+      break;
+    }
+    case kTransferStart: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.transfer_start_;
+      }
+      break;
+    }
+    case kTransferChunk: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.transfer_chunk_;
+      }
+      break;
+    }
+    case kTransferCredit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.transfer_credit_;
+      }
+      break;
+    }
+    case kServerShutdown: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.server_shutdown_;
+      }
+      break;
+    }
+    case kGossip: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.gossip_;
       }
       break;
     }
@@ -2750,115 +9383,203 @@ void Response::clear_result() {
       break;
     }
   }
-  _oneof_case_[0] = RESULT_NOT_SET;
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
 }
 
 
 void Response::Clear() {
 // @@protoc_insertion_point(message_clear_start:chat.Response)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&operation_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_code_) -
-      reinterpret_cast<char*>(&operation_)) + sizeof(status_code_));
+  _impl_.message_.ClearToEmpty();
+  _impl_.redirect_.ClearToEmpty();
+  ::memset(&_impl_.operation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.codec_) -
+      reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.codec_));
   clear_result();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Response::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .chat.Operation operation = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_operation(static_cast<::chat::Operation>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.StatusCode status_code = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_status_code(static_cast<::chat::StatusCode>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string message = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_message();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "chat.Response.message"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "chat.Response.message"));
+        } else
+          goto handle_unusual;
         continue;
       // .chat.UserListResponse user_list = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_user_list(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .chat.IncomingMessageResponse incoming_message = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ctx->ParseMessage(_internal_mutable_incoming_message(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .chat.DeliveryReceipt delivery_receipt = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delivery_receipt(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint64 message_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.message_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.PresenceUpdate presence = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_presence(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Codec codec = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_codec(static_cast<::chat::Codec>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.TransferStart transfer_start = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transfer_start(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.TransferChunk transfer_chunk = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transfer_chunk(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.TransferCredit transfer_credit = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transfer_credit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.ServerShutdown server_shutdown = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_server_shutdown(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string redirect = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_redirect();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.Response.redirect"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.GossipUpdate gossip = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gossip(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Response::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:chat.Response)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
+  if (this->_internal_operation() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_operation(), target);
   }
 
   // .chat.StatusCode status_code = 2;
-  if (this->status_code() != 0) {
+  if (this->_internal_status_code() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_status_code(), target);
   }
 
   // string message = 3;
-  if (this->message().size() > 0) {
+  if (!this->_internal_message().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2869,22 +9590,92 @@ failure:
 
   // .chat.UserListResponse user_list = 4;
   if (_internal_has_user_list()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::user_list(this), target, stream);
+      InternalWriteMessage(4, _Internal::user_list(this),
+        _Internal::user_list(this).GetCachedSize(), target, stream);
   }
 
   // .chat.IncomingMessageResponse incoming_message = 5;
   if (_internal_has_incoming_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::incoming_message(this),
+        _Internal::incoming_message(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.DeliveryReceipt delivery_receipt = 6;
+  if (_internal_has_delivery_receipt()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::delivery_receipt(this),
+        _Internal::delivery_receipt(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 message_id = 7;
+  if (this->_internal_message_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_message_id(), target);
+  }
+
+  // .chat.PresenceUpdate presence = 8;
+  if (_internal_has_presence()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::presence(this),
+        _Internal::presence(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.Codec codec = 9;
+  if (this->_internal_codec() != 0) {
     target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_codec(), target);
+  }
+
+  // .chat.TransferStart transfer_start = 10;
+  if (_internal_has_transfer_start()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::transfer_start(this),
+        _Internal::transfer_start(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.TransferChunk transfer_chunk = 11;
+  if (_internal_has_transfer_chunk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::transfer_chunk(this),
+        _Internal::transfer_chunk(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.TransferCredit transfer_credit = 12;
+  if (_internal_has_transfer_credit()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::transfer_credit(this),
+        _Internal::transfer_credit(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.ServerShutdown server_shutdown = 13;
+  if (_internal_has_server_shutdown()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::server_shutdown(this),
+        _Internal::server_shutdown(this).GetCachedSize(), target, stream);
+  }
+
+  // string redirect = 14;
+  if (!this->_internal_redirect().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_redirect().data(), static_cast<int>(this->_internal_redirect().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.Response.redirect");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_redirect(), target);
+  }
+
+  // .chat.GossipUpdate gossip = 15;
+  if (_internal_has_gossip()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::incoming_message(this), target, stream);
+      InternalWriteMessage(15, _Internal::gossip(this),
+        _Internal::gossip(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:chat.Response)
@@ -2895,27 +9686,45 @@ size_t Response::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:chat.Response)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string message = 3;
-  if (this->message().size() > 0) {
+  if (!this->_internal_message().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_message());
   }
 
+  // string redirect = 14;
+  if (!this->_internal_redirect().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_redirect());
+  }
+
   // .chat.Operation operation = 1;
-  if (this->operation() != 0) {
+  if (this->_internal_operation() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_operation());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
   }
 
   // .chat.StatusCode status_code = 2;
-  if (this->status_code() != 0) {
+  if (this->_internal_status_code() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status_code());
+  }
+
+  // uint64 message_id = 7;
+  if (this->_internal_message_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_message_id());
+  }
+
+  // .chat.Codec codec = 9;
+  if (this->_internal_codec() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_status_code());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_codec());
   }
 
   switch (result_case()) {
@@ -2923,80 +9732,156 @@ size_t Response::ByteSizeLong() const {
     case kUserList: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *result_.user_list_);
+          *_impl_.result_.user_list_);
       break;
     }
     // .chat.IncomingMessageResponse incoming_message = 5;
     case kIncomingMessage: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *result_.incoming_message_);
+          *_impl_.result_.incoming_message_);
+      break;
+    }
+    // .chat.DeliveryReceipt delivery_receipt = 6;
+    case kDeliveryReceipt: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.delivery_receipt_);
+      break;
+    }
+    // .chat.PresenceUpdate presence = 8;
+    case kPresence: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.presence_);
+      break;
+    }
+    // .chat.TransferStart transfer_start = 10;
+    case kTransferStart: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.transfer_start_);
+      break;
+    }
+    // .chat.TransferChunk transfer_chunk = 11;
+    case kTransferChunk: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.transfer_chunk_);
+      break;
+    }
+    // .chat.TransferCredit transfer_credit = 12;
+    case kTransferCredit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.transfer_credit_);
+      break;
+    }
+    // .chat.ServerShutdown server_shutdown = 13;
+    case kServerShutdown: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.server_shutdown_);
+      break;
+    }
+    // .chat.GossipUpdate gossip = 15;
+    case kGossip: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.gossip_);
       break;
     }
     case RESULT_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Response::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:chat.Response)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Response* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Response>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:chat.Response)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:chat.Response)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
 
-void Response::MergeFrom(const Response& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:chat.Response)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.message().size() > 0) {
-    _internal_set_message(from._internal_message());
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  if (!from._internal_redirect().empty()) {
+    _this->_internal_set_redirect(from._internal_redirect());
   }
-  if (from.operation() != 0) {
-    _internal_set_operation(from._internal_operation());
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
   }
-  if (from.status_code() != 0) {
-    _internal_set_status_code(from._internal_status_code());
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
+  }
+  if (from._internal_message_id() != 0) {
+    _this->_internal_set_message_id(from._internal_message_id());
+  }
+  if (from._internal_codec() != 0) {
+    _this->_internal_set_codec(from._internal_codec());
   }
   switch (from.result_case()) {
     case kUserList: {
-      _internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(from._internal_user_list());
+      _this->_internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(
+          from._internal_user_list());
       break;
     }
     case kIncomingMessage: {
-      _internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(from._internal_incoming_message());
+      _this->_internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(
+          from._internal_incoming_message());
+      break;
+    }
+    case kDeliveryReceipt: {
+      _this->_internal_mutable_delivery_receipt()->::chat::DeliveryReceipt::MergeFrom(
+          from._internal_delivery_receipt());
+      break;
+    }
+    case kPresence: {
+      _this->_internal_mutable_presence()->::chat::PresenceUpdate::MergeFrom(
+          from._internal_presence());
+      break;
+    }
+    case kTransferStart: {
+      _this->_internal_mutable_transfer_start()->::chat::TransferStart::MergeFrom(
+          from._internal_transfer_start());
+      break;
+    }
+    case kTransferChunk: {
+      _this->_internal_mutable_transfer_chunk()->::chat::TransferChunk::MergeFrom(
+          from._internal_transfer_chunk());
+      break;
+    }
+    case kTransferCredit: {
+      _this->_internal_mutable_transfer_credit()->::chat::TransferCredit::MergeFrom(
+          from._internal_transfer_credit());
+      break;
+    }
+    case kServerShutdown: {
+      _this->_internal_mutable_server_shutdown()->::chat::ServerShutdown::MergeFrom(
+          from._internal_server_shutdown());
+      break;
+    }
+    case kGossip: {
+      _this->_internal_mutable_gossip()->::chat::GossipUpdate::MergeFrom(
+          from._internal_gossip());
       break;
     }
     case RESULT_NOT_SET: {
       break;
     }
   }
-}
-
-void Response::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:chat.Response)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Response::CopyFrom(const Response& from) {
@@ -3012,51 +9897,142 @@ bool Response::IsInitialized() const {
 
 void Response::InternalSwap(Response* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  message_.Swap(&other->message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.redirect_, lhs_arena,
+      &other->_impl_.redirect_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Response, status_code_)
-      + sizeof(Response::status_code_)
-      - PROTOBUF_FIELD_OFFSET(Response, operation_)>(
-          reinterpret_cast<char*>(&operation_),
-          reinterpret_cast<char*>(&other->operation_));
-  swap(result_, other->result_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.codec_)
+      + sizeof(Response::_impl_.codec_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.operation_)>(
+          reinterpret_cast<char*>(&_impl_.operation_),
+          reinterpret_cast<char*>(&other->_impl_.operation_));
+  swap(_impl_.result_, other->_impl_.result_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[26]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace chat
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::chat::User* Arena::CreateMaybeMessage< ::chat::User >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::User*
+Arena::CreateMaybeMessage< ::chat::User >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::User >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::NewUserRequest* Arena::CreateMaybeMessage< ::chat::NewUserRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::NewUserRequest*
+Arena::CreateMaybeMessage< ::chat::NewUserRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::NewUserRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::SendMessageRequest* Arena::CreateMaybeMessage< ::chat::SendMessageRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::SendMessageRequest*
+Arena::CreateMaybeMessage< ::chat::SendMessageRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::SendMessageRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::IncomingMessageResponse* Arena::CreateMaybeMessage< ::chat::IncomingMessageResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::IncomingMessageResponse*
+Arena::CreateMaybeMessage< ::chat::IncomingMessageResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::IncomingMessageResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::UserListRequest* Arena::CreateMaybeMessage< ::chat::UserListRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::ChannelRequest*
+Arena::CreateMaybeMessage< ::chat::ChannelRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ChannelRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::AckRequest*
+Arena::CreateMaybeMessage< ::chat::AckRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::AckRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::DeliveryReceipt*
+Arena::CreateMaybeMessage< ::chat::DeliveryReceipt >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::DeliveryReceipt >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UserListRequest*
+Arena::CreateMaybeMessage< ::chat::UserListRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::UserListRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::UserListResponse* Arena::CreateMaybeMessage< ::chat::UserListResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::UserListResponse*
+Arena::CreateMaybeMessage< ::chat::UserListResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::UserListResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::UpdateStatusRequest* Arena::CreateMaybeMessage< ::chat::UpdateStatusRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::PresenceSubscribeRequest*
+Arena::CreateMaybeMessage< ::chat::PresenceSubscribeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceSubscribeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceDelta*
+Arena::CreateMaybeMessage< ::chat::PresenceDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceDelta >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceUpdate*
+Arena::CreateMaybeMessage< ::chat::PresenceUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::TransferStart*
+Arena::CreateMaybeMessage< ::chat::TransferStart >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::TransferStart >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::TransferChunk*
+Arena::CreateMaybeMessage< ::chat::TransferChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::TransferChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::TransferCredit*
+Arena::CreateMaybeMessage< ::chat::TransferCredit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::TransferCredit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ServerShutdown*
+Arena::CreateMaybeMessage< ::chat::ServerShutdown >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ServerShutdown >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UpgradeSession*
+Arena::CreateMaybeMessage< ::chat::UpgradeSession >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::UpgradeSession >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UpgradeDone*
+Arena::CreateMaybeMessage< ::chat::UpgradeDone >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::UpgradeDone >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UpgradeRecord*
+Arena::CreateMaybeMessage< ::chat::UpgradeRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::UpgradeRecord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceEntry*
+Arena::CreateMaybeMessage< ::chat::PresenceEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::NodeVersion*
+Arena::CreateMaybeMessage< ::chat::NodeVersion >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::NodeVersion >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ForwardedMessage*
+Arena::CreateMaybeMessage< ::chat::ForwardedMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ForwardedMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PeerBatch*
+Arena::CreateMaybeMessage< ::chat::PeerBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PeerBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::GossipUpdate*
+Arena::CreateMaybeMessage< ::chat::GossipUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::GossipUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UpdateStatusRequest*
+Arena::CreateMaybeMessage< ::chat::UpdateStatusRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::UpdateStatusRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::Request* Arena::CreateMaybeMessage< ::chat::Request >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::Request*
+Arena::CreateMaybeMessage< ::chat::Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::Request >(arena);
 }
-template<> PROTOBUF_NOINLINE ::chat::Response* Arena::CreateMaybeMessage< ::chat::Response >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::chat::Response*
+Arena::CreateMaybeMessage< ::chat::Response >(Arena* arena) {
   return Arena::CreateMessageInternal< ::chat::Response >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
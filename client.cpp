@@ -1,8 +1,11 @@
 #include "./messageUtil/chat.pb.h" // Include the generated protobuf header
 #include "./messageUtil/message.h"
+#include "./messageUtil/compression.h"
 #include <iostream>
 #include <sys/socket.h>
 #include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/un.h>
 #include <unistd.h>
 #include <cstring>
 #include <string>
@@ -14,6 +17,11 @@
 #include <mutex>
 #include <condition_variable>
 #include <sstream>
+#include <unordered_set>
+#include <map>
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
 
 #define RED "\x1b[31m"
 #define GREEN "\x1b[32m"
@@ -29,10 +37,35 @@ std::atomic<bool> terminate_execution{false};
 std::atomic<bool> streaming_mode{true};
 std::mutex cout_mutex;
 std::deque<std::string> message_buffer; // Buffer for messages received during input mode
+std::atomic<bool> ack_mode{false};
+std::mutex ack_mutex;
+std::vector<uint64_t> pending_acks;        // Ids received but not yet acknowledged
+std::unordered_set<uint64_t> seen_messages; // Recently received ids, used to drop retransmissions
+std::deque<uint64_t> seen_order;
+std::atomic<bool> presence_subscribed{false};
+std::mutex presence_mutex;
+std::map<std::string, chat::UserStatus> presence_replica; // Local copy of the user registry kept by presence updates
+uint64_t presence_version = 0;
+std::mutex page_mutex;
+chat::UserListRequest last_page_request; // Filters of the last userPage, reused by nextPage
+std::string next_page_cursor;
+std::mutex transfer_mutex;
+std::condition_variable transfer_cv;
+uint64_t outgoing_transfer = 0; // Id of the transfer being sent
+uint32_t transfer_credit = 0;   // Chunks that may still be sent before waiting for credit
+bool transfer_failed = false;
+struct IncomingTransfer
+{
+  std::ofstream file;
+  std::string path;
+  std::string name;
+  std::string sender;
+};
+std::map<uint64_t, IncomingTransfer> incoming_transfers; // Only used by the listener thread
 
 // TODO: add identifier uuid to each request and response to match them
 
-void terminationHandler(int sock, std::string username, std::thread &listener)
+void terminationHandler(int sock, std::thread &listener)
 {
   while (!terminate_execution)
   {
@@ -62,6 +95,194 @@ void flush_message_buffer()
   }
 }
 
+std::string statusName(chat::UserStatus status)
+{
+  switch (status)
+  {
+  case chat::UserStatus::ONLINE:
+    return "ONLINE";
+  case chat::UserStatus::BUSY:
+    return "BUSY";
+  case chat::UserStatus::OFFLINE:
+    return "OFFLINE";
+  default:
+    return "UNKNOWN";
+  }
+}
+
+void applyPresence(const chat::PresenceUpdate &update)
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  if (update.snapshot())
+  {
+    presence_replica.clear();
+  }
+  else if (update.version() < presence_version)
+  {
+    return; // Older than the replica; the parts of a snapshot share its version
+  }
+  for (const auto &delta : update.deltas())
+  {
+    if (delta.event() == chat::PresenceEvent::USER_LEFT)
+    {
+      presence_replica.erase(delta.user().username());
+    }
+    else
+    {
+      presence_replica[delta.user().username()] = delta.user().status();
+    }
+  }
+  presence_version = update.version();
+}
+
+void printPresenceReplica()
+{
+  std::lock_guard<std::mutex> lock(presence_mutex);
+  std::string message = std::string(MAGENTA) + "Users online (v" + std::to_string(presence_version) + "): ";
+  for (const auto &user : presence_replica)
+  {
+    message += user.first + " " + statusName(user.second) + ", ";
+  }
+  std::lock_guard<std::mutex> cout_lock(cout_mutex);
+  std::cout << message << RESET << std::endl;
+}
+
+void flushAcks(int sock)
+{
+  chat::Request request;
+  {
+    std::lock_guard<std::mutex> lock(ack_mutex);
+    if (pending_acks.empty())
+    {
+      return;
+    }
+    request.set_operation(chat::Operation::ACK_MESSAGES);
+    auto *ack = request.mutable_ack();
+    for (uint64_t message_id : pending_acks)
+    {
+      ack->add_message_ids(message_id);
+    }
+    pending_acks.clear();
+  }
+  send_response(sock, request);
+}
+
+// Queues the ack for a message and reports whether it was already received
+bool acknowledgeMessage(int sock, uint64_t message_id)
+{
+  bool duplicate;
+  bool flush;
+  {
+    std::lock_guard<std::mutex> lock(ack_mutex);
+    // Retransmissions are acked again, the previous ack may have been lost
+    pending_acks.push_back(message_id);
+    duplicate = !seen_messages.insert(message_id).second;
+    if (!duplicate)
+    {
+      seen_order.push_back(message_id);
+      if (seen_order.size() > 4096)
+      {
+        seen_messages.erase(seen_order.front());
+        seen_order.pop_front();
+      }
+    }
+    flush = pending_acks.size() >= ACK_BATCH_SIZE;
+  }
+  if (flush)
+  {
+    flushAcks(sock);
+  }
+  return duplicate;
+}
+
+void ackFlusher(int sock)
+{
+  while (running)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ACK_FLUSH_INTERVAL_MS));
+    flushAcks(sock);
+  }
+}
+
+void creditTransfer(const chat::TransferCredit &credit)
+{
+  {
+    std::lock_guard<std::mutex> lock(transfer_mutex);
+    outgoing_transfer = credit.transfer_id();
+    transfer_credit += credit.chunks();
+  }
+  transfer_cv.notify_one();
+}
+
+void failTransfer()
+{
+  {
+    std::lock_guard<std::mutex> lock(transfer_mutex);
+    transfer_failed = true;
+  }
+  transfer_cv.notify_one();
+}
+
+// Opens the file an incoming transfer is written to, chunk by chunk
+std::string receiveTransferStart(const chat::TransferStart &start)
+{
+  std::string name = start.name().substr(start.name().find_last_of('/') + 1);
+  if (name.empty() || name == "." || name == "..")
+  {
+    name = "file";
+  }
+  IncomingTransfer &transfer = incoming_transfers[start.transfer_id()];
+  transfer.path = "received_" + std::to_string(start.transfer_id()) + "_" + name;
+  transfer.name = name;
+  transfer.sender = start.sender();
+  transfer.file.open(transfer.path, std::ios::binary | std::ios::trunc);
+  if (!transfer.file)
+  {
+    incoming_transfers.erase(start.transfer_id());
+    return RED "Cannot write incoming file " + name + " from " + start.sender() + RESET;
+  }
+  std::string type = (start.type() == chat::MessageType::BROADCAST) ? "Broadcast" : "Direct";
+  if (start.type() == chat::MessageType::CHANNEL)
+  {
+    type = "#" + start.channel();
+  }
+  return LIGHT_GREEN + type + " file from " + start.sender() + ": " + name + " (" + std::to_string(start.total_size()) + " bytes)" + RESET;
+}
+
+// Writes a chunk, returns the message to show once the transfer is complete
+std::string receiveTransferChunk(const chat::TransferChunk &chunk)
+{
+  auto it = incoming_transfers.find(chunk.transfer_id());
+  if (it == incoming_transfers.end())
+  {
+    return "";
+  }
+  IncomingTransfer &transfer = it->second;
+  transfer.file.write(chunk.data().data(), chunk.data().size());
+  if (!chunk.last())
+  {
+    return "";
+  }
+  transfer.file.close();
+  std::string message = LIGHT_GREEN "File " + transfer.name + " from " + transfer.sender + " saved to " + transfer.path + RESET;
+  incoming_transfers.erase(it);
+  return message;
+}
+
+std::string abortIncomingTransfer(const chat::TransferChunk &chunk)
+{
+  auto it = incoming_transfers.find(chunk.transfer_id());
+  if (it == incoming_transfers.end())
+  {
+    return "";
+  }
+  it->second.file.close();
+  std::remove(it->second.path.c_str());
+  std::string message = RED "Transfer of " + it->second.name + " from " + it->second.sender + " aborted." + RESET;
+  incoming_transfers.erase(it);
+  return message;
+}
+
 void messageListener(int sock)
 {
   while (running)
@@ -69,10 +290,32 @@ void messageListener(int sock)
     chat::Response response;
     if (receive_request(sock, response))
     {
+      if (response.operation() == chat::Operation::PRESENCE_UPDATE && response.has_presence())
+      {
+        applyPresence(response.presence());
+        continue;
+      }
+      if (response.has_transfer_credit())
+      {
+        creditTransfer(response.transfer_credit());
+        continue;
+      }
       std::lock_guard<std::mutex> lock(cout_mutex);
       std::string message;
-      if (response.status_code() != chat::StatusCode::OK)
+      if (response.status_code() != chat::StatusCode::OK && response.has_transfer_chunk())
       {
+        message = abortIncomingTransfer(response.transfer_chunk());
+        if (message.empty())
+        {
+          continue;
+        }
+      }
+      else if (response.status_code() != chat::StatusCode::OK)
+      {
+        if (response.operation() == chat::Operation::TRANSFER_START || response.operation() == chat::Operation::TRANSFER_CHUNK)
+        {
+          failTransfer();
+        }
         message = RED "Server error: " + response.message() + RESET;
       }
       else
@@ -83,7 +326,15 @@ void messageListener(int sock)
           if (response.has_incoming_message())
           {
             const auto &msg = response.incoming_message();
+            if (msg.message_id() != 0 && acknowledgeMessage(sock, msg.message_id()))
+            {
+              continue; // Already shown, this is a retransmission
+            }
             std::string type = (msg.type() == chat::MessageType::BROADCAST) ? "Broadcast" : "Direct";
+            if (msg.type() == chat::MessageType::CHANNEL)
+            {
+              type = "#" + msg.channel();
+            }
             message = LIGHT_GREEN + type + " message from " + msg.sender() + ": " + msg.content() + RESET;
           }
           break;
@@ -101,34 +352,65 @@ void messageListener(int sock)
             }
             for (const auto &user : user_list.users())
             {
-              std::string status;
-              switch (user.status())
-              {
-              case chat::UserStatus::ONLINE:
-                status = "ONLINE";
-                break;
-              case chat::UserStatus::BUSY:
-                status = "BUSY";
-                break;
-              case chat::UserStatus::OFFLINE:
-                status = "OFFLINE";
-                break;
-              default:
-                status = "UNKNOWN";
-              }
-
-              message += user.username() + " " + status + ", ";
+              message += user.username() + " " + statusName(user.status()) + ", ";
+            }
+            {
+              std::lock_guard<std::mutex> page_lock(page_mutex);
+              next_page_cursor = user_list.next_cursor();
+            }
+            if (!user_list.next_cursor().empty())
+            {
+              message += "(more: nextPage)";
             }
             message += RESET;
           }
           break;
+        case chat::Operation::SUBSCRIBE_PRESENCE:
+          if (response.status_code() != chat::StatusCode::OK)
+          {
+            presence_subscribed = false; // userList goes back to asking the server
+          }
+          message = "SERVER: " + response.message();
+          break;
+        case chat::Operation::TRANSFER_START:
+          message = receiveTransferStart(response.transfer_start());
+          break;
+        case chat::Operation::TRANSFER_CHUNK:
+          if (!response.has_transfer_chunk())
+          {
+            message = "SERVER: " + response.message();
+            break;
+          }
+          message = receiveTransferChunk(response.transfer_chunk());
+          if (message.empty())
+          {
+            continue;
+          }
+          break;
+        case chat::Operation::SERVER_SHUTDOWN:
+          message = RED "SERVER: " + response.message() + RESET;
+          break;
+        case chat::Operation::SESSION_MOVED:
+          message = RED "SERVER: " + response.message() + " (" + response.redirect() + ")" + RESET;
+          break;
+        case chat::Operation::DELIVERY_RECEIPT:
+          message = std::string(CYAN) + "Delivered: messages up to #" + std::to_string(response.delivery_receipt().delivered_through()) + RESET;
+          break;
+        case chat::Operation::SEND_MESSAGE:
+          message = "SERVER: " + response.message();
+          if (response.message_id() != 0)
+          {
+            message += " (#" + std::to_string(response.message_id()) + ")";
+          }
+          break;
         default:
           message = "SERVER: " + response.message();
           break;
         }
       }
 
-      if (response.operation() == chat::Operation::INCOMING_MESSAGE)
+      if (response.operation() == chat::Operation::INCOMING_MESSAGE || response.operation() == chat::Operation::DELIVERY_RECEIPT ||
+          response.has_transfer_start() || response.has_transfer_chunk())
       {
         if (streaming_mode)
         {
@@ -165,7 +447,16 @@ void displayHelp()
   std::cout << "    messageto <recipient> <message>\n";
   std::cout << "    status <status>\n";
   std::cout << "    userList\n";
+  std::cout << "    userPage [prefix=<prefix>] [status=<status>] [limit=<n>]\n";
+  std::cout << "    nextPage\n";
   std::cout << "    info <username>\n";
+  std::cout << "    create <channel>\n";
+  std::cout << "    join <channel>\n";
+  std::cout << "    leave <channel>\n";
+  std::cout << "    channel <channel> <message>\n";
+  std::cout << "    sendfile <path> [recipient|#channel]\n";
+  std::cout << "    subscribe\n";
+  std::cout << "    unsubscribe\n";
   std::cout << "    liveChat\n";
    std::cout << "    help\n";
   std::cout << "    exit\n\n";
@@ -193,6 +484,114 @@ void handleDirectMessage(int sock, const std::string &recipient, const std::stri
   send_response(sock, request);
 }
 
+void handleChannelRequest(int sock, chat::Operation operation, const std::string &channel)
+{
+  chat::Request request;
+  request.set_operation(operation);
+  request.mutable_channel()->set_channel(channel);
+
+  send_response(sock, request);
+}
+
+// Text of the command after its first count words, the message keeps the spacing the user typed
+std::string textAfterWords(const std::string &command, size_t count)
+{
+  size_t position = 0;
+  for (size_t i = 0; i < count && position != std::string::npos; i++)
+  {
+    position = command.find_first_not_of(" \t", position);
+    position = command.find_first_of(" \t", position);
+  }
+  return position == std::string::npos ? "" : command.substr(position + 1);
+}
+
+void handleChannelMessage(int sock, const std::string &channel, const std::string &message)
+{
+  chat::Request request;
+  request.set_operation(chat::Operation::SEND_MESSAGE);
+  auto *msg = request.mutable_send_message();
+  msg->set_content(message);
+  msg->set_channel(channel);
+
+  send_response(sock, request);
+}
+
+// Streams a file in TRANSFER_CHUNK_SIZE chunks, never sending more chunks than the server credited
+bool handleSendFile(int sock, const std::string &path, const std::string &target)
+{
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    std::cout << "Cannot open " << path << std::endl;
+    return false;
+  }
+  uint64_t total_size = file.tellg();
+  file.seekg(0);
+  if (total_size == 0 || total_size > MAX_TRANSFER_SIZE)
+  {
+    std::cout << "File must have between 1 and " << MAX_TRANSFER_SIZE << " bytes." << std::endl;
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(transfer_mutex);
+    outgoing_transfer = 0;
+    transfer_credit = 0;
+    transfer_failed = false;
+  }
+  chat::Request request;
+  request.set_operation(chat::Operation::TRANSFER_START);
+  auto *start = request.mutable_transfer_start();
+  if (!target.empty() && target[0] == '#')
+  {
+    start->set_channel(target.substr(1));
+  }
+  else
+  {
+    start->set_recipient(target);
+  }
+  start->set_name(path.substr(path.find_last_of('/') + 1));
+  start->set_total_size(total_size);
+  send_response(sock, request);
+
+  std::vector<char> buffer(TRANSFER_CHUNK_SIZE);
+  uint64_t sent = 0;
+  for (uint32_t sequence = 0;; sequence++)
+  {
+    uint64_t transfer_id;
+    {
+      std::unique_lock<std::mutex> lock(transfer_mutex);
+      while (transfer_credit == 0 && !transfer_failed && !terminate_execution)
+      {
+        transfer_cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
+      if (transfer_credit == 0)
+      {
+        return true; // The listener already reported the error
+      }
+      transfer_credit--;
+      transfer_id = outgoing_transfer;
+    }
+
+    file.read(buffer.data(), std::min<uint64_t>(TRANSFER_CHUNK_SIZE, total_size - sent));
+    size_t size = file.gcount();
+    sent += size;
+
+    chat::Request chunk_request;
+    chunk_request.set_operation(chat::Operation::TRANSFER_CHUNK);
+    auto *chunk = chunk_request.mutable_transfer_chunk();
+    chunk->set_transfer_id(transfer_id);
+    chunk->set_sequence(sequence);
+    chunk->set_data(buffer.data(), size);
+    // A file that shrank while sending ends early, the server rejects it as incomplete
+    chunk->set_last(sent == total_size || size == 0);
+    send_response(sock, chunk_request);
+    if (chunk->last())
+    {
+      return true;
+    }
+  }
+}
 
 bool handleChangeStatus(int sock, const std::string &username, const std::string &status) {
     chat::Request request;
@@ -224,7 +623,92 @@ void handleListUsers(int sock)
 {
   chat::Request request;
   request.set_operation(chat::Operation::GET_USERS);
-  auto *user_list = request.mutable_get_users();
+  request.mutable_get_users(); // Empty filter: every user
+
+  send_response(sock, request);
+}
+
+bool parseStatus(const std::string &status, chat::UserStatus &value)
+{
+  if (status == "ONLINE")
+    value = chat::UserStatus::ONLINE;
+  else if (status == "BUSY")
+    value = chat::UserStatus::BUSY;
+  else if (status == "OFFLINE")
+    value = chat::UserStatus::OFFLINE;
+  else
+    return false;
+  return true;
+}
+
+// Requests a page of users. Filters are given as key=value words after the command.
+bool handleUserPage(int sock, const std::vector<std::string> &words)
+{
+  chat::UserListRequest page_request;
+  for (size_t i = 1; i < words.size(); i++)
+  {
+    size_t equals = words[i].find('=');
+    std::string key = words[i].substr(0, equals);
+    std::string value = equals == std::string::npos ? "" : words[i].substr(equals + 1);
+    chat::UserStatus status;
+    if (key == "prefix")
+    {
+      page_request.set_prefix(value);
+    }
+    else if (key == "status" && parseStatus(value, status))
+    {
+      page_request.set_filter_status(true);
+      page_request.set_status(status);
+    }
+    else if (key == "limit" && !value.empty() && value.find_first_not_of("0123456789") == std::string::npos)
+    {
+      page_request.set_limit(std::stoul(value));
+    }
+    else
+    {
+      return false;
+    }
+  }
+  if (page_request.limit() == 0)
+  {
+    page_request.set_limit(USER_PAGE_SIZE);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(page_mutex);
+    last_page_request = page_request;
+  }
+  chat::Request request;
+  request.set_operation(chat::Operation::GET_USERS);
+  request.mutable_get_users()->CopyFrom(page_request);
+
+  send_response(sock, request);
+  return true;
+}
+
+bool handleNextPage(int sock)
+{
+  chat::Request request;
+  request.set_operation(chat::Operation::GET_USERS);
+  {
+    std::lock_guard<std::mutex> lock(page_mutex);
+    if (next_page_cursor.empty())
+    {
+      return false;
+    }
+    request.mutable_get_users()->CopyFrom(last_page_request);
+    request.mutable_get_users()->set_cursor(next_page_cursor);
+  }
+
+  send_response(sock, request);
+  return true;
+}
+
+void handleSubscribePresence(int sock, bool unsubscribe)
+{
+  chat::Request request;
+  request.set_operation(chat::Operation::SUBSCRIBE_PRESENCE);
+  request.mutable_subscribe_presence()->set_unsubscribe(unsubscribe);
 
   send_response(sock, request);
 }
@@ -249,73 +733,186 @@ void handleUnregisterUser(int sock, const std::string &username)
   send_response(sock, request);
 }
 
-int main(int argc, char *argv[])
+// Clients on the same machine use the Unix socket of the server, given as host "local"
+int connectLocal(int port)
 {
-  if (argc != 4)
+  std::string path = private_socket_path(LOCAL_SOCKET_FORMAT, port, false);
+  if (path.empty())
   {
-    std::cerr << "Usage: " << argv[0] << " <server IP> <server port> <username>\n";
-    return 1;
+    std::cerr << "No local server socket \n";
+    return -1;
   }
-
-  std::string server_ip = argv[1];
-  int server_port = std::stoi(argv[2]);
-  std::string username = argv[3];
-
-  int sock = 0;
-  struct sockaddr_in serv_addr;
-
-  if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+  struct sockaddr_un address = {};
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
   {
     std::cerr << "Socket creation error \n";
-    return -1;
   }
+  else if (connect(sock, (struct sockaddr *)&address, sizeof(address)) < 0)
+  {
+    std::cerr << "Connection Failed \n";
+    close(sock);
+    sock = -1;
+  }
+  return sock;
+}
 
-  serv_addr.sin_family = AF_INET;
-  serv_addr.sin_port = htons(server_port);
+// Connects to the server, the host may also be a name: redirects carry the address the nodes use
+int connectToServer(const std::string &host, int port)
+{
+  if (host == "local")
+    return connectLocal(port);
 
-  if (inet_pton(AF_INET, server_ip.c_str(), &serv_addr.sin_addr) <= 0)
+  struct addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result;
+  if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &result) != 0)
   {
     std::cerr << "Invalid address/ Address not supported \n";
     return -1;
   }
 
-  if (connect(sock, (struct sockaddr *)&serv_addr, sizeof(serv_addr)) < 0)
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  if (sock < 0)
+  {
+    std::cerr << "Socket creation error \n";
+  }
+  else if (connect(sock, result->ai_addr, result->ai_addrlen) < 0)
   {
     std::cerr << "Connection Failed \n";
-    return -1;
+    close(sock);
+    sock = -1;
+  }
+  freeaddrinfo(result);
+  return sock;
+}
+
+// Moves the frames of a local connection to shared memory rings. The server answers through the rings,
+// or through the socket if it refuses, and then it closes the connection.
+bool useSharedMemory(int sock)
+{
+  int memfd = create_shm_channel();
+  if (memfd < 0)
+    return false;
+  std::unique_ptr<ShmChannel> channel = map_shm_channel(memfd);
+  chat::Request request;
+  request.set_operation(chat::Operation::OPEN_SHARED_MEMORY);
+  std::string frame;
+  if (!channel || !serialize_frame(request, frame) || !send_frame_with_descriptor(sock, frame, channel->fd))
+  {
+    std::cerr << "Shared memory setup failed \n";
+    return false;
+  }
+
+  attach_shm_channel(sock, std::move(channel));
+  chat::Response response;
+  if (receive_request(sock, response) && response.status_code() == chat::StatusCode::OK)
+    return true;
+  attach_shm_channel(sock, nullptr);
+  if (receive_request(sock, response))
+    std::cout << RED "ERROR: " + response.message() + RESET << std::endl;
+  return false;
+}
+
+int main(int argc, char *argv[])
+{
+  bool compression = true;
+  bool shared_memory = false;
+  bool valid_options = argc >= 4;
+  for (int i = 4; i < argc; i++)
+  {
+    std::string option = argv[i];
+    if (option == "--ack")
+      ack_mode = true;
+    else if (option == "--no-compression")
+      compression = false;
+    else if (option == "--shm")
+      shared_memory = true;
+    else
+      valid_options = false;
   }
+  if (!valid_options)
+  {
+    std::cerr << "Usage: " << argv[0] << " <server IP|local> <server port> <username> [--ack] [--no-compression] [--shm]\n";
+    return 1;
+  }
+
+  std::string server_ip = argv[1];
+  int server_port = std::stoi(argv[2]);
+  std::string username = argv[3];
 
   // Register the user first
   chat::Request request;
   request.set_operation(chat::Operation::REGISTER_USER);
   auto *new_user = request.mutable_register_user();
   new_user->set_username(username);
+  new_user->set_ack_mode(ack_mode);
+  if (compression)
+  {
+    for (chat::Codec codec : supported_codecs())
+    {
+      new_user->add_codecs(codec);
+    }
+  }
 
-  send_response(sock, request);
-
+  // With several nodes the server may redirect the user to the node that owns its username
+  int sock = -1;
   chat::Response response;
-  if (receive_request(sock, response))
+  for (int redirects = 0;; redirects++)
   {
-    if (response.status_code() != chat::StatusCode::OK)
+    sock = connectToServer(server_ip, server_port);
+    if (sock < 0)
+      return -1;
+    // Compressing is not worth it in shared memory; a redirect goes to another machine and uses TCP
+    if (shared_memory && server_ip == "local")
     {
-      std::cout << RED "ERROR: " + response.message() + RESET << std::endl;
+      if (!useSharedMemory(sock))
+      {
+        close(sock);
+        return -1;
+      }
+      new_user->clear_codecs();
+    }
+
+    send_response(sock, request);
+    if (!receive_request(sock, response))
+    {
+      std::cerr << "Connection closed." << std::endl;
+      close(sock);
       return -1;
     }
+    size_t colon = response.redirect().rfind(':');
+    if (response.status_code() != chat::StatusCode::MOVED || colon == std::string::npos || redirects == MAX_REDIRECTS)
+      break;
 
-    std::cout << "SERVER: " << response.message() << std::endl;
+    std::cout << "SERVER: " << response.message() << " Connecting to " << response.redirect() << std::endl;
+    close(sock);
+    server_ip = response.redirect().substr(0, colon);
+    server_port = std::stoi(response.redirect().substr(colon + 1));
   }
-  else
+
+  if (response.status_code() != chat::StatusCode::OK)
   {
-    std::cerr << "Connection closed." << std::endl;
-    close(sock);
+    std::cout << RED "ERROR: " + response.message() + RESET << std::endl;
     return -1;
   }
 
+  std::cout << "SERVER: " << response.message() << std::endl;
+  set_socket_codec(sock, response.codec());
+
   std::thread listener(messageListener, sock);
   listener.detach();
 
+  if (ack_mode)
+  {
+    std::thread(ackFlusher, sock).detach();
+  }
+
   // Start the termination handler thread
-  std::thread terminator(terminationHandler, sock, username, std::ref(listener));
+  std::thread terminator(terminationHandler, sock, std::ref(listener));
   terminator.detach(); // Detach the thread so it can run independently
 
   int choice = 0;
@@ -390,11 +987,33 @@ int main(int argc, char *argv[])
         std::cout << "Invalid command. Usage: userList\n";
         waiting_response = false;
       }
+      else if (presence_subscribed)
+      {
+        // The local replica is kept up to date by the server, no need to ask
+        printPresenceReplica();
+        waiting_response = false;
+      }
       else
       {
         handleListUsers(sock);
       }
     }
+    else if (words[0] == "userPage")
+    {
+      if (!handleUserPage(sock, words))
+      {
+        std::cout << "Invalid command. Usage: userPage [prefix=<prefix>] [status=<status>] [limit=<n>]\n";
+        waiting_response = false;
+      }
+    }
+    else if (words[0] == "nextPage")
+    {
+      if (length != 1 || !handleNextPage(sock))
+      {
+        std::cout << "No more pages. Use userPage first.\n";
+        waiting_response = false;
+      }
+    }
     else if (words[0] == "info")
     {
       if (length != 2)
@@ -407,6 +1026,60 @@ int main(int argc, char *argv[])
         handleGetUserInfo(sock, words[1]);
       }
     }
+    else if (words[0] == "create" || words[0] == "join" || words[0] == "leave")
+    {
+      if (length != 2)
+      {
+        std::cout << "Invalid command. Usage: " << words[0] << " <channel>\n";
+        waiting_response = false;
+      }
+      else
+      {
+        chat::Operation operation = words[0] == "create" ? chat::Operation::CREATE_CHANNEL
+                                    : words[0] == "join" ? chat::Operation::JOIN_CHANNEL
+                                                         : chat::Operation::LEAVE_CHANNEL;
+        handleChannelRequest(sock, operation, words[1]);
+      }
+    }
+    else if (words[0] == "channel")
+    {
+      if (length < 3)
+      {
+        std::cout << "Invalid command. Usage: channel <channel> <message>\n";
+        waiting_response = false;
+      }
+      else
+      {
+        std::string channel = words[1];
+        std::string message = textAfterWords(command, 2);
+        handleChannelMessage(sock, channel, message);
+      }
+    }
+    else if (words[0] == "sendfile")
+    {
+      if (length < 2 || length > 3)
+      {
+        std::cout << "Invalid command. Usage: sendfile <path> [recipient|#channel]\n";
+        waiting_response = false;
+      }
+      else if (!handleSendFile(sock, words[1], length == 3 ? words[2] : ""))
+      {
+        waiting_response = false;
+      }
+    }
+    else if (words[0] == "subscribe" || words[0] == "unsubscribe")
+    {
+      if (length != 1)
+      {
+        std::cout << "Invalid command. Usage: " << words[0] << "\n";
+        waiting_response = false;
+      }
+      else
+      {
+        presence_subscribed = (words[0] == "subscribe");
+        handleSubscribePresence(sock, !presence_subscribed);
+      }
+    }
     else if (words[0] == "help")
     {
       if (length != 1)
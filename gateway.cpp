@@ -0,0 +1,545 @@
+/*
+*   Descripción:
+*           Gateway sin estado que va delante del servidor de chat. Atiende muchas conexiones de
+*           clientes, separa sus frames y responde sus heartbeats, y las multiplexa sobre unas pocas
+*           conexiones persistentes con el servidor (frames STREAM). El servidor ve a cada cliente
+*           como una conexión más, así que la cantidad de sockets deja de pesarle y se pueden correr
+*           tantos gateways como haga falta.
+*/
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <algorithm>
+#include <cerrno>   // For errno
+#include <cstring>  // For memcpy
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <netdb.h>       // For getaddrinfo
+#include <sys/epoll.h>   // For epoll
+#include <sys/timerfd.h> // For timerfd
+#include "./messageUtil/chat.pb.h"
+#include "./messageUtil/message.h"
+#include "./messageUtil/constants.h"
+
+/**
+ * Conexión del gateway: un cliente o un enlace con el servidor. Todo lo toca el único hilo del gateway;
+ * la salida se junta en output y se escribe una vez por vuelta de epoll.
+ */
+struct Connection
+{
+    int sock = -1;
+    bool backend = false;      // Enlace con el servidor; si no, un cliente
+    std::string input;         // Resto de un frame partido
+    std::string output;        // Bytes por escribir
+    size_t output_sent = 0;    // Bytes de output ya escritos
+    bool want_write = false;   // Registrada con EPOLLOUT porque el socket se llenó
+    bool dirty = false;        // Está en la lista dirty de la vuelta
+    bool closing = false;      // El servidor cerró la conexión del cliente, se cierra al vaciar output
+    bool connecting = false;   // Enlace cuyo connect sigue en curso, termina con EPOLLOUT
+    uint64_t heard_tick = 0;   // Último intervalo de heartbeat en el que llegaron bytes
+    // Cliente
+    uint32_t stream = 0;          // Id de la conexión en su enlace
+    Connection *link = nullptr;   // Enlace que la lleva
+    // Enlace
+    std::string address;          // host:puerto del servidor
+    uint32_t next_stream = 1;
+    std::unordered_map<uint32_t, Connection *> streams; // Clientes que lleva el enlace
+};
+
+int epoll_fd = -1;
+int listen_fd = -1;
+int heartbeat_fd = -1;
+uint64_t heartbeat_tick = 0;
+std::vector<std::unique_ptr<Connection>> links; // Enlaces con el servidor, se reparten los clientes en ronda
+std::string link_secret; // Secreto del servidor (--secret), va en el frame LINK con que empieza cada enlace
+size_t next_link = 0;
+std::vector<Connection *> dirty;                // Conexiones con salida pendiente de escribir en esta vuelta
+// Clientes cerrados en la vuelta: se borran al final, cuando ya no quedan eventos ni entradas en dirty que los nombren
+std::vector<std::unique_ptr<Connection>> closed_clients;
+
+void close_link(Connection &link);
+
+/**
+ * Empieza a conectar con el servidor dado como host:puerto, -1 si no está disponible. El socket no
+ * bloquea: con connecting el connect sigue en curso y el hilo del gateway no espera al servidor.
+ */
+int connect_backend(const std::string &address, bool &connecting) {
+    size_t colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        return -1;
+    }
+    struct addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *result;
+    if (getaddrinfo(address.substr(0, colon).c_str(), address.substr(colon + 1).c_str(), &hints, &result) != 0) {
+        return -1;
+    }
+    int sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    connecting = false;
+    if (sock >= 0 && connect(sock, result->ai_addr, result->ai_addrlen) < 0) {
+        connecting = errno == EINPROGRESS;
+        if (!connecting) {
+            close(sock);
+            sock = -1;
+        }
+    }
+    freeaddrinfo(result);
+    return sock;
+}
+
+// Registro de la conexión en el epoll según si espera para escribir
+void watch(Connection &connection, int operation) {
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    if (connection.want_write) {
+        event.events |= EPOLLOUT;
+    }
+    event.data.ptr = &connection;
+    if (epoll_ctl(epoll_fd, operation, connection.sock, &event) < 0) {
+        perror("epoll_ctl failed");
+    }
+}
+
+void mark_dirty(Connection &connection) {
+    if (!connection.dirty) {
+        connection.dirty = true;
+        dirty.push_back(&connection);
+    }
+}
+
+// Encola un frame STREAM en el enlace. Un servidor que no lee lo que se le manda cierra el enlace.
+void queue_stream(Connection &link, uint32_t stream, StreamKind kind, std::string_view data) {
+    if (link.sock < 0) {
+        return;
+    }
+    append_stream_header(link.output, stream, kind, data.size());
+    link.output.append(data);
+    mark_dirty(link);
+    if (link.output.size() - link.output_sent > MAX_GATEWAY_PENDING_OUTPUT) {
+        std::cerr << "Server link " << link.sock << " is not reading, closing it." << std::endl;
+        close_link(link);
+    }
+}
+
+// Cierra el socket del cliente; si el cierre no vino del servidor, se lo avisa por el enlace
+void close_client(Connection &client, bool notify) {
+    if (client.link != nullptr) {
+        client.link->streams.erase(client.stream);
+        if (notify) {
+            queue_stream(*client.link, client.stream, StreamKind::CLOSE, {});
+        }
+    }
+    client.link = nullptr;
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, client.sock, nullptr);
+    close(client.sock);
+    client.sock = -1;
+    closed_clients.emplace_back(&client);
+}
+
+// Cierra el enlace y los clientes que llevaba, que vuelven a conectarse; el enlace se reabre en el siguiente heartbeat
+void close_link(Connection &link) {
+    if (link.sock < 0) {
+        return;
+    }
+    // Un connect que no prosperó no es un enlace perdido: se reintenta en el siguiente heartbeat
+    if (!link.connecting) {
+        std::cerr << "Lost link to server " << link.address << " (" << link.streams.size() << " clients)." << std::endl;
+    }
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, link.sock, nullptr);
+    close(link.sock);
+    link.sock = -1;
+    auto streams = std::move(link.streams);
+    link.streams.clear();
+    for (auto &stream : streams) {
+        stream.second->link = nullptr;
+        close_client(*stream.second, false);
+    }
+    link.input.clear();
+    link.output.clear();
+    link.output_sent = 0;
+    link.want_write = false;
+    link.connecting = false;
+}
+
+// El enlace quedó conectado: el servidor solo atiende los STREAM de un enlace que empezó presentando su secreto
+void start_link(Connection &link) {
+    link.connecting = false;
+    queue_stream(link, 0, StreamKind::LINK, link_secret);
+    std::cout << "Linked to server " << link.address << " on socket " << link.sock << "." << std::endl;
+}
+
+// Termina un connect en curso cuando el socket avisa que se puede escribir. False si el servidor no respondió.
+bool finish_connect(Connection &link) {
+    int error = 0;
+    socklen_t size = sizeof(error);
+    if (getsockopt(link.sock, SOL_SOCKET, SO_ERROR, &error, &size) < 0 || error != 0) {
+        return false;
+    }
+    start_link(link);
+    return true;
+}
+
+// Un enlace que sigue conectando espera EPOLLOUT; si no contesta en HEARTBEAT_MISSED_LIMIT intervalos se cierra
+void open_link(Connection &link) {
+    bool connecting;
+    link.sock = connect_backend(link.address, connecting);
+    if (link.sock < 0) {
+        return;
+    }
+    link.heard_tick = heartbeat_tick;
+    link.connecting = connecting;
+    link.want_write = connecting;
+    watch(link, EPOLL_CTL_ADD);
+    if (!connecting) {
+        start_link(link);
+    }
+}
+
+// Escribe la salida pendiente; si el socket se llena queda registrada con EPOLLOUT. False si se cortó.
+bool flush(Connection &connection) {
+    while (connection.output_sent < connection.output.size()) {
+        ssize_t written = send(connection.sock, connection.output.data() + connection.output_sent,
+                               connection.output.size() - connection.output_sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        if (written < 0) {
+            perror("send failed");
+            return false;
+        }
+        connection.output_sent += written;
+    }
+    if (connection.output_sent == connection.output.size() || connection.output_sent > BUFFER_SIZE) {
+        connection.output.erase(0, connection.output_sent);
+        connection.output_sent = 0;
+    }
+    bool want_write = !connection.output.empty();
+    if (want_write != connection.want_write) {
+        connection.want_write = want_write;
+        watch(connection, EPOLL_CTL_MOD);
+    }
+    return true;
+}
+
+// Cierra la conexión por el camino que corresponde a su tipo
+void drop(Connection &connection) {
+    if (connection.backend) {
+        close_link(connection);
+    } else {
+        close_client(connection, !connection.closing);
+    }
+}
+
+// Lee lo que haya en el socket y lo agrega a input. False si la conexión se cerró.
+bool read_input(Connection &connection) {
+    char chunk[FRAME_HEADER_SIZE + BUFFER_SIZE];
+    ssize_t bytesRead = recv(connection.sock, chunk, sizeof(chunk), MSG_DONTWAIT);
+    if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+        return true;
+    }
+    if (bytesRead <= 0) {
+        return false;
+    }
+    connection.input.append(chunk, bytesRead);
+    connection.heard_tick = heartbeat_tick;
+    return true;
+}
+
+/**
+ * Frames de un cliente: los heartbeats se responden acá y cada frame completo pasa tal cual (incluso
+ * comprimido) al servidor en un frame STREAM. False si el cliente mandó algo inválido.
+ */
+bool relay_client(Connection &client) {
+    size_t consumed = 0;
+    while (true) {
+        size_t frame_size;
+        FrameStatus status = split_frame(std::string_view(client.input).substr(consumed), frame_size);
+        if (status == FrameStatus::INCOMPLETE) {
+            break;
+        }
+        if (status == FrameStatus::INVALID || status == FrameStatus::STREAM) {
+            return false;
+        }
+        if (status == FrameStatus::PING) {
+            client.output.append(PONG_FRAME, FRAME_HEADER_SIZE);
+            mark_dirty(client);
+        } else if (status == FrameStatus::READY && client.link != nullptr) {
+            queue_stream(*client.link, client.stream, StreamKind::DATA, std::string_view(client.input).substr(consumed, frame_size));
+        }
+        consumed += frame_size;
+    }
+    client.input.erase(0, consumed);
+    return true;
+}
+
+/**
+ * Frames del servidor: lo de cada conexión va a la salida de su cliente. Un cliente que no lee lo que
+ * le llega se cierra, igual que en el servidor. False si el enlace mandó algo inválido.
+ */
+bool relay_link(Connection &link) {
+    size_t consumed = 0;
+    while (link.sock >= 0) {
+        size_t frame_size;
+        std::string_view data = std::string_view(link.input).substr(consumed);
+        FrameStatus status = split_frame(data, frame_size);
+        if (status == FrameStatus::INCOMPLETE) {
+            break;
+        }
+        if (status == FrameStatus::INVALID) {
+            return false;
+        }
+        consumed += frame_size;
+        if (status == FrameStatus::PING) {
+            link.output.append(PONG_FRAME, FRAME_HEADER_SIZE);
+            mark_dirty(link);
+            continue;
+        }
+        uint32_t stream;
+        StreamKind kind;
+        std::string_view payload;
+        if (status != FrameStatus::STREAM || !read_stream_header(data.substr(FRAME_HEADER_SIZE, frame_size - FRAME_HEADER_SIZE), stream, kind, payload)) {
+            continue; // Respuestas sueltas del servidor, como el rechazo de una conexión cuando está lleno
+        }
+        auto it = link.streams.find(stream);
+        if (it == link.streams.end()) {
+            continue;
+        }
+        Connection &client = *it->second;
+        if (kind == StreamKind::CLOSE) {
+            client.closing = true;
+            mark_dirty(client);
+        } else if (kind == StreamKind::DATA) {
+            client.output.append(payload);
+            mark_dirty(client);
+            if (client.output.size() - client.output_sent > MAX_PENDING_OUTPUT) {
+                std::cerr << "Client on socket " << client.sock << " is not reading, closing connection." << std::endl;
+                close_client(client, true);
+            }
+        }
+    }
+    // Si el enlace se cerró mientras tanto, su input ya se vació
+    if (link.sock >= 0) {
+        link.input.erase(0, consumed);
+    }
+    return true;
+}
+
+// Con el servidor inalcanzable la conexión recibe una respuesta clara en lugar de quedar colgada
+void reject_connection(int client_sock) {
+    chat::Response response;
+    response.set_operation(chat::Operation::REGISTER_USER);
+    response.set_message("Server is unavailable, try again later.");
+    response.set_status_code(chat::StatusCode::SERVICE_UNAVAILABLE);
+    send_response(client_sock, response);
+    close(client_sock);
+}
+
+// Acepta las conexiones pendientes y abre una conexión en el servidor por cada una, repartidas entre los enlaces
+void accept_clients() {
+    while (true) {
+        struct sockaddr_in address;
+        socklen_t address_size = sizeof(address);
+        int client_sock = accept4(listen_fd, (struct sockaddr *)&address, &address_size, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_sock < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("Accept failed");
+            }
+            return;
+        }
+        Connection *link = nullptr;
+        for (size_t i = 0; i < links.size() && link == nullptr; i++) {
+            Connection &candidate = *links[next_link++ % links.size()];
+            link = candidate.sock >= 0 && !candidate.connecting ? &candidate : nullptr;
+        }
+        if (link == nullptr) {
+            reject_connection(client_sock);
+            continue;
+        }
+
+        Connection *client = new Connection();
+        client->sock = client_sock;
+        client->link = link;
+        client->heard_tick = heartbeat_tick;
+        do {
+            client->stream = link->next_stream++;
+        } while (client->stream == 0 || link->streams.count(client->stream) > 0);
+        link->streams[client->stream] = client;
+        watch(*client, EPOLL_CTL_ADD);
+        queue_stream(*link, client->stream, StreamKind::OPEN, inet_ntoa(address.sin_addr));
+    }
+}
+
+/**
+ * Heartbeats: un PING a cada cliente o enlace del que no llegó nada en el último intervalo y cierre de
+ * los que siguen callados después de HEARTBEAT_MISSED_LIMIT intervalos. Los enlaces caídos se reabren acá.
+ */
+void check_heartbeats() {
+    uint64_t expirations;
+    if (read(heartbeat_fd, &expirations, sizeof(expirations)) < 0) {
+        return;
+    }
+    heartbeat_tick += expirations;
+    for (auto &link : links) {
+        if (link->sock < 0) {
+            open_link(*link);
+            continue;
+        }
+        std::vector<Connection *> connections = {link.get()};
+        for (auto &stream : link->streams) {
+            connections.push_back(stream.second);
+        }
+        for (Connection *connection : connections) {
+            if (connection->sock < 0) {
+                continue;
+            }
+            uint64_t silent = heartbeat_tick - connection->heard_tick;
+            if (silent >= HEARTBEAT_MISSED_LIMIT) {
+                std::cerr << "Connection on socket " << connection->sock << " missed " << silent << " heartbeats, closing it." << std::endl;
+                drop(*connection);
+                if (connection == link.get()) {
+                    break;
+                }
+            } else if (silent > 0 && !connection->connecting) {
+                connection->output.append(PING_FRAME, FRAME_HEADER_SIZE);
+                mark_dirty(*connection);
+            }
+        }
+    }
+}
+
+// Escribe las conexiones que recibieron salida durante la vuelta; los clientes que el servidor cerró se cierran al vaciarse
+void flush_dirty() {
+    while (!dirty.empty()) {
+        Connection &connection = *dirty.back();
+        dirty.pop_back();
+        connection.dirty = false;
+        if (connection.sock < 0) {
+            continue;
+        }
+        bool alive = connection.want_write || flush(connection);
+        if (!alive || (connection.closing && connection.output.empty())) {
+            drop(connection);
+        }
+    }
+}
+
+int open_listener(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    int opt = 1;
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = INADDR_ANY;
+    address.sin_port = htons(port);
+    // SO_REUSEPORT: varios gateways en la misma máquina comparten el puerto
+    if (fd < 0 || setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) || setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) ||
+        bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(fd, LISTEN_BACKLOG) < 0) {
+        perror("Listener setup failed");
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char *argv[]) {
+    int link_count = GATEWAY_BACKEND_CONNECTIONS;
+    bool valid = argc >= 3;
+    for (int i = 3; i < argc && valid; i += 2) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            valid = false;
+        } else if (option == "--links") {
+            link_count = atoi(argv[i + 1]);
+            valid = link_count > 0;
+        } else if (option == "--secret") {
+            link_secret = argv[i + 1];
+        } else {
+            valid = false;
+        }
+    }
+    if (!valid || link_secret.empty()) {
+        std::cerr << "Usage: " << argv[0] << " <port> <server host:port> --secret <secret> [--links <n>]\n";
+        return 1;
+    }
+    int port = std::stoi(argv[1]);
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    listen_fd = open_listener(port);
+    heartbeat_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (epoll_fd < 0 || listen_fd < 0 || heartbeat_fd < 0) {
+        return 1;
+    }
+    struct itimerspec interval = {};
+    interval.it_interval.tv_sec = HEARTBEAT_INTERVAL_MS / 1000;
+    interval.it_interval.tv_nsec = (HEARTBEAT_INTERVAL_MS % 1000) * 1000000L;
+    interval.it_value = interval.it_interval;
+    timerfd_settime(heartbeat_fd, 0, &interval, nullptr);
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = &listen_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &event);
+    event.data.ptr = &heartbeat_fd;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, heartbeat_fd, &event);
+
+    for (int i = 0; i < link_count; i++) {
+        links.push_back(std::make_unique<Connection>());
+        links.back()->backend = true;
+        links.back()->address = argv[2];
+        open_link(*links.back());
+    }
+    flush_dirty(); // Los frames LINK de los enlaces que ya conectaron salen antes de esperar el primer evento
+    std::cout << "Gateway listening on port " << port << " for server " << argv[2] << " (" << link_count << " links)" << std::endl;
+
+    epoll_event events[MAX_EPOLL_EVENTS];
+    while (true) {
+        int count = epoll_wait(epoll_fd, events, MAX_EPOLL_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("epoll_wait failed");
+            return 1;
+        }
+        for (int i = 0; i < count; i++) {
+            void *source = events[i].data.ptr;
+            if (source == &listen_fd) {
+                accept_clients();
+                continue;
+            }
+            if (source == &heartbeat_fd) {
+                check_heartbeats();
+                continue;
+            }
+            // Una conexión cerrada en esta misma vuelta puede tener eventos pendientes en el arreglo
+            Connection &connection = *static_cast<Connection *>(source);
+            if (connection.sock < 0) {
+                continue;
+            }
+            if (connection.connecting && !finish_connect(connection)) {
+                drop(connection);
+                continue;
+            }
+            bool alive = !(events[i].events & EPOLLOUT) || flush(connection);
+            if (alive && (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+                alive = read_input(connection) && (connection.backend ? relay_link(connection) : relay_client(connection));
+            }
+            if (connection.sock >= 0 && (!alive || (connection.closing && connection.output.empty()))) {
+                drop(connection);
+            }
+        }
+        // Lo que se juntó en la vuelta sale en una escritura por conexión: los frames de muchos clientes van juntos al servidor
+        flush_dirty();
+        closed_clients.clear();
+    }
+}
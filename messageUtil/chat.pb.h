@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -44,53 +42,117 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_chat_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[9]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chat_2eproto;
 namespace chat {
+class AckRequest;
+struct AckRequestDefaultTypeInternal;
+extern AckRequestDefaultTypeInternal _AckRequest_default_instance_;
+class ChannelRequest;
+struct ChannelRequestDefaultTypeInternal;
+extern ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
+class DeliveryReceipt;
+struct DeliveryReceiptDefaultTypeInternal;
+extern DeliveryReceiptDefaultTypeInternal _DeliveryReceipt_default_instance_;
+class ForwardedMessage;
+struct ForwardedMessageDefaultTypeInternal;
+extern ForwardedMessageDefaultTypeInternal _ForwardedMessage_default_instance_;
+class GossipUpdate;
+struct GossipUpdateDefaultTypeInternal;
+extern GossipUpdateDefaultTypeInternal _GossipUpdate_default_instance_;
 class IncomingMessageResponse;
-class IncomingMessageResponseDefaultTypeInternal;
+struct IncomingMessageResponseDefaultTypeInternal;
 extern IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
 class NewUserRequest;
-class NewUserRequestDefaultTypeInternal;
+struct NewUserRequestDefaultTypeInternal;
 extern NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+class NodeVersion;
+struct NodeVersionDefaultTypeInternal;
+extern NodeVersionDefaultTypeInternal _NodeVersion_default_instance_;
+class PeerBatch;
+struct PeerBatchDefaultTypeInternal;
+extern PeerBatchDefaultTypeInternal _PeerBatch_default_instance_;
+class PresenceDelta;
+struct PresenceDeltaDefaultTypeInternal;
+extern PresenceDeltaDefaultTypeInternal _PresenceDelta_default_instance_;
+class PresenceEntry;
+struct PresenceEntryDefaultTypeInternal;
+extern PresenceEntryDefaultTypeInternal _PresenceEntry_default_instance_;
+class PresenceSubscribeRequest;
+struct PresenceSubscribeRequestDefaultTypeInternal;
+extern PresenceSubscribeRequestDefaultTypeInternal _PresenceSubscribeRequest_default_instance_;
+class PresenceUpdate;
+struct PresenceUpdateDefaultTypeInternal;
+extern PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
 class Request;
-class RequestDefaultTypeInternal;
+struct RequestDefaultTypeInternal;
 extern RequestDefaultTypeInternal _Request_default_instance_;
 class Response;
-class ResponseDefaultTypeInternal;
+struct ResponseDefaultTypeInternal;
 extern ResponseDefaultTypeInternal _Response_default_instance_;
 class SendMessageRequest;
-class SendMessageRequestDefaultTypeInternal;
+struct SendMessageRequestDefaultTypeInternal;
 extern SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+class ServerShutdown;
+struct ServerShutdownDefaultTypeInternal;
+extern ServerShutdownDefaultTypeInternal _ServerShutdown_default_instance_;
+class TransferChunk;
+struct TransferChunkDefaultTypeInternal;
+extern TransferChunkDefaultTypeInternal _TransferChunk_default_instance_;
+class TransferCredit;
+struct TransferCreditDefaultTypeInternal;
+extern TransferCreditDefaultTypeInternal _TransferCredit_default_instance_;
+class TransferStart;
+struct TransferStartDefaultTypeInternal;
+extern TransferStartDefaultTypeInternal _TransferStart_default_instance_;
 class UpdateStatusRequest;
-class UpdateStatusRequestDefaultTypeInternal;
+struct UpdateStatusRequestDefaultTypeInternal;
 extern UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
+class UpgradeDone;
+struct UpgradeDoneDefaultTypeInternal;
+extern UpgradeDoneDefaultTypeInternal _UpgradeDone_default_instance_;
+class UpgradeRecord;
+struct UpgradeRecordDefaultTypeInternal;
+extern UpgradeRecordDefaultTypeInternal _UpgradeRecord_default_instance_;
+class UpgradeSession;
+struct UpgradeSessionDefaultTypeInternal;
+extern UpgradeSessionDefaultTypeInternal _UpgradeSession_default_instance_;
 class User;
-class UserDefaultTypeInternal;
+struct UserDefaultTypeInternal;
 extern UserDefaultTypeInternal _User_default_instance_;
 class UserListRequest;
-class UserListRequestDefaultTypeInternal;
+struct UserListRequestDefaultTypeInternal;
 extern UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
 class UserListResponse;
-class UserListResponseDefaultTypeInternal;
+struct UserListResponseDefaultTypeInternal;
 extern UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
 }  // namespace chat
 PROTOBUF_NAMESPACE_OPEN
+template<> ::chat::AckRequest* Arena::CreateMaybeMessage<::chat::AckRequest>(Arena*);
+template<> ::chat::ChannelRequest* Arena::CreateMaybeMessage<::chat::ChannelRequest>(Arena*);
+template<> ::chat::DeliveryReceipt* Arena::CreateMaybeMessage<::chat::DeliveryReceipt>(Arena*);
+template<> ::chat::ForwardedMessage* Arena::CreateMaybeMessage<::chat::ForwardedMessage>(Arena*);
+template<> ::chat::GossipUpdate* Arena::CreateMaybeMessage<::chat::GossipUpdate>(Arena*);
 template<> ::chat::IncomingMessageResponse* Arena::CreateMaybeMessage<::chat::IncomingMessageResponse>(Arena*);
 template<> ::chat::NewUserRequest* Arena::CreateMaybeMessage<::chat::NewUserRequest>(Arena*);
+template<> ::chat::NodeVersion* Arena::CreateMaybeMessage<::chat::NodeVersion>(Arena*);
+template<> ::chat::PeerBatch* Arena::CreateMaybeMessage<::chat::PeerBatch>(Arena*);
+template<> ::chat::PresenceDelta* Arena::CreateMaybeMessage<::chat::PresenceDelta>(Arena*);
+template<> ::chat::PresenceEntry* Arena::CreateMaybeMessage<::chat::PresenceEntry>(Arena*);
+template<> ::chat::PresenceSubscribeRequest* Arena::CreateMaybeMessage<::chat::PresenceSubscribeRequest>(Arena*);
+template<> ::chat::PresenceUpdate* Arena::CreateMaybeMessage<::chat::PresenceUpdate>(Arena*);
 template<> ::chat::Request* Arena::CreateMaybeMessage<::chat::Request>(Arena*);
 template<> ::chat::Response* Arena::CreateMaybeMessage<::chat::Response>(Arena*);
 template<> ::chat::SendMessageRequest* Arena::CreateMaybeMessage<::chat::SendMessageRequest>(Arena*);
+template<> ::chat::ServerShutdown* Arena::CreateMaybeMessage<::chat::ServerShutdown>(Arena*);
+template<> ::chat::TransferChunk* Arena::CreateMaybeMessage<::chat::TransferChunk>(Arena*);
+template<> ::chat::TransferCredit* Arena::CreateMaybeMessage<::chat::TransferCredit>(Arena*);
+template<> ::chat::TransferStart* Arena::CreateMaybeMessage<::chat::TransferStart>(Arena*);
 template<> ::chat::UpdateStatusRequest* Arena::CreateMaybeMessage<::chat::UpdateStatusRequest>(Arena*);
+template<> ::chat::UpgradeDone* Arena::CreateMaybeMessage<::chat::UpgradeDone>(Arena*);
+template<> ::chat::UpgradeRecord* Arena::CreateMaybeMessage<::chat::UpgradeRecord>(Arena*);
+template<> ::chat::UpgradeSession* Arena::CreateMaybeMessage<::chat::UpgradeSession>(Arena*);
 template<> ::chat::User* Arena::CreateMaybeMessage<::chat::User>(Arena*);
 template<> ::chat::UserListRequest* Arena::CreateMaybeMessage<::chat::UserListRequest>(Arena*);
 template<> ::chat::UserListResponse* Arena::CreateMaybeMessage<::chat::UserListResponse>(Arena*);
@@ -101,8 +163,8 @@ enum UserStatus : int {
   ONLINE = 0,
   BUSY = 1,
   OFFLINE = 2,
-  UserStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  UserStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  UserStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool UserStatus_IsValid(int value);
 constexpr UserStatus UserStatus_MIN = ONLINE;
@@ -119,19 +181,46 @@ inline const std::string& UserStatus_Name(T enum_t_value) {
     UserStatus_descriptor(), enum_t_value);
 }
 inline bool UserStatus_Parse(
-    const std::string& name, UserStatus* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserStatus* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserStatus>(
     UserStatus_descriptor(), name, value);
 }
+enum Codec : int {
+  NO_COMPRESSION = 0,
+  LZ4 = 1,
+  ZSTD = 2,
+  Codec_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Codec_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Codec_IsValid(int value);
+constexpr Codec Codec_MIN = NO_COMPRESSION;
+constexpr Codec Codec_MAX = ZSTD;
+constexpr int Codec_ARRAYSIZE = Codec_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Codec_descriptor();
+template<typename T>
+inline const std::string& Codec_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Codec>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Codec_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Codec_descriptor(), enum_t_value);
+}
+inline bool Codec_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Codec* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Codec>(
+    Codec_descriptor(), name, value);
+}
 enum MessageType : int {
   BROADCAST = 0,
   DIRECT = 1,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  CHANNEL = 2,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
 constexpr MessageType MessageType_MIN = BROADCAST;
-constexpr MessageType MessageType_MAX = DIRECT;
+constexpr MessageType MessageType_MAX = CHANNEL;
 constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
@@ -144,15 +233,15 @@ inline const std::string& MessageType_Name(T enum_t_value) {
     MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const std::string& name, MessageType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
 enum UserListType : int {
   ALL = 0,
   SINGLE = 1,
-  UserListType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  UserListType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  UserListType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserListType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool UserListType_IsValid(int value);
 constexpr UserListType UserListType_MIN = ALL;
@@ -169,10 +258,36 @@ inline const std::string& UserListType_Name(T enum_t_value) {
     UserListType_descriptor(), enum_t_value);
 }
 inline bool UserListType_Parse(
-    const std::string& name, UserListType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserListType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserListType>(
     UserListType_descriptor(), name, value);
 }
+enum PresenceEvent : int {
+  USER_JOINED = 0,
+  USER_LEFT = 1,
+  STATUS_CHANGED = 2,
+  PresenceEvent_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PresenceEvent_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PresenceEvent_IsValid(int value);
+constexpr PresenceEvent PresenceEvent_MIN = USER_JOINED;
+constexpr PresenceEvent PresenceEvent_MAX = STATUS_CHANGED;
+constexpr int PresenceEvent_ARRAYSIZE = PresenceEvent_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PresenceEvent_descriptor();
+template<typename T>
+inline const std::string& PresenceEvent_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PresenceEvent>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PresenceEvent_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PresenceEvent_descriptor(), enum_t_value);
+}
+inline bool PresenceEvent_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PresenceEvent* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PresenceEvent>(
+    PresenceEvent_descriptor(), name, value);
+}
 enum Operation : int {
   REGISTER_USER = 0,
   SEND_MESSAGE = 1,
@@ -180,12 +295,26 @@ enum Operation : int {
   GET_USERS = 3,
   UNREGISTER_USER = 4,
   INCOMING_MESSAGE = 5,
-  Operation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Operation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ACK_MESSAGES = 6,
+  DELIVERY_RECEIPT = 7,
+  CREATE_CHANNEL = 8,
+  JOIN_CHANNEL = 9,
+  LEAVE_CHANNEL = 10,
+  SUBSCRIBE_PRESENCE = 11,
+  PRESENCE_UPDATE = 12,
+  TRANSFER_START = 13,
+  TRANSFER_CHUNK = 14,
+  TRANSFER_CREDIT = 15,
+  SERVER_SHUTDOWN = 16,
+  PEER_BATCH = 17,
+  SESSION_MOVED = 18,
+  OPEN_SHARED_MEMORY = 19,
+  Operation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Operation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Operation_IsValid(int value);
 constexpr Operation Operation_MIN = REGISTER_USER;
-constexpr Operation Operation_MAX = INCOMING_MESSAGE;
+constexpr Operation Operation_MAX = OPEN_SHARED_MEMORY;
 constexpr int Operation_ARRAYSIZE = Operation_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor();
@@ -198,7 +327,7 @@ inline const std::string& Operation_Name(T enum_t_value) {
     Operation_descriptor(), enum_t_value);
 }
 inline bool Operation_Parse(
-    const std::string& name, Operation* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation>(
     Operation_descriptor(), name, value);
 }
@@ -206,13 +335,16 @@ enum StatusCode : int {
   UNKNOWN_STATUS = 0,
   OK = 200,
   BAD_REQUEST = 400,
+  MOVED = 307,
+  RATE_LIMITED = 429,
   INTERNAL_SERVER_ERROR = 500,
-  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  SERVICE_UNAVAILABLE = 503,
+  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool StatusCode_IsValid(int value);
 constexpr StatusCode StatusCode_MIN = UNKNOWN_STATUS;
-constexpr StatusCode StatusCode_MAX = INTERNAL_SERVER_ERROR;
+constexpr StatusCode StatusCode_MAX = SERVICE_UNAVAILABLE;
 constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
@@ -225,17 +357,18 @@ inline const std::string& StatusCode_Name(T enum_t_value) {
     StatusCode_descriptor(), enum_t_value);
 }
 inline bool StatusCode_Parse(
-    const std::string& name, StatusCode* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
     StatusCode_descriptor(), name, value);
 }
 // ===================================================================
 
-class User PROTOBUF_FINAL :
+class User final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.User) */ {
  public:
-  inline User() : User(nullptr) {};
-  virtual ~User();
+  inline User() : User(nullptr) {}
+  ~User() override;
+  explicit PROTOBUF_CONSTEXPR User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   User(const User& from);
   User(User&& from) noexcept
@@ -248,8 +381,13 @@ class User PROTOBUF_FINAL :
     return *this;
   }
   inline User& operator=(User&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -260,14 +398,14 @@ class User PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const User& default_instance() {
+    return *internal_default_instance();
   }
-  static const User& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const User* internal_default_instance() {
     return reinterpret_cast<const User*>(
                &_User_default_instance_);
@@ -280,7 +418,12 @@ class User PROTOBUF_FINAL :
   }
   inline void Swap(User* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -288,56 +431,53 @@ class User PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(User* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline User* New() const final {
-    return CreateMaybeMessage<User>(nullptr);
-  }
-
-  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<User>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const User& from);
-  void MergeFrom(const User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const User& from) {
+    User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(User* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.User";
   }
   protected:
-  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -350,25 +490,14 @@ class User PROTOBUF_FINAL :
   // string username = 1;
   void clear_username();
   const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
   std::string* mutable_username();
-  std::string* release_username();
+  PROTOBUF_NODISCARD std::string* release_username();
   void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
   private:
   const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
   std::string* _internal_mutable_username();
   public:
 
@@ -388,18 +517,22 @@ class User PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  int status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NewUserRequest PROTOBUF_FINAL :
+class NewUserRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.NewUserRequest) */ {
  public:
-  inline NewUserRequest() : NewUserRequest(nullptr) {};
-  virtual ~NewUserRequest();
+  inline NewUserRequest() : NewUserRequest(nullptr) {}
+  ~NewUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR NewUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NewUserRequest(const NewUserRequest& from);
   NewUserRequest(NewUserRequest&& from) noexcept
@@ -412,8 +545,13 @@ class NewUserRequest PROTOBUF_FINAL :
     return *this;
   }
   inline NewUserRequest& operator=(NewUserRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -424,14 +562,14 @@ class NewUserRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewUserRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const NewUserRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NewUserRequest* internal_default_instance() {
     return reinterpret_cast<const NewUserRequest*>(
                &_NewUserRequest_default_instance_);
@@ -444,7 +582,12 @@ class NewUserRequest PROTOBUF_FINAL :
   }
   inline void Swap(NewUserRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -452,89 +595,103 @@ class NewUserRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NewUserRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NewUserRequest* New() const final {
-    return CreateMaybeMessage<NewUserRequest>(nullptr);
-  }
-
-  NewUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NewUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NewUserRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NewUserRequest& from);
-  void MergeFrom(const NewUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NewUserRequest& from) {
+    NewUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NewUserRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.NewUserRequest";
   }
   protected:
-  explicit NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kCodecsFieldNumber = 3,
     kUsernameFieldNumber = 1,
+    kAckModeFieldNumber = 2,
   };
+  // repeated .chat.Codec codecs = 3;
+  int codecs_size() const;
+  private:
+  int _internal_codecs_size() const;
+  public:
+  void clear_codecs();
+  private:
+  ::chat::Codec _internal_codecs(int index) const;
+  void _internal_add_codecs(::chat::Codec value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_codecs();
+  public:
+  ::chat::Codec codecs(int index) const;
+  void set_codecs(int index, ::chat::Codec value);
+  void add_codecs(::chat::Codec value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& codecs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_codecs();
+
   // string username = 1;
   void clear_username();
   const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
   std::string* mutable_username();
-  std::string* release_username();
+  PROTOBUF_NODISCARD std::string* release_username();
   void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
   private:
   const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
   std::string* _internal_mutable_username();
   public:
 
+  // bool ack_mode = 2;
+  void clear_ack_mode();
+  bool ack_mode() const;
+  void set_ack_mode(bool value);
+  private:
+  bool _internal_ack_mode() const;
+  void _internal_set_ack_mode(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:chat.NewUserRequest)
  private:
   class _Internal;
@@ -542,17 +699,24 @@ class NewUserRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> codecs_;
+    mutable std::atomic<int> _codecs_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    bool ack_mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SendMessageRequest PROTOBUF_FINAL :
+class SendMessageRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SendMessageRequest) */ {
  public:
-  inline SendMessageRequest() : SendMessageRequest(nullptr) {};
-  virtual ~SendMessageRequest();
+  inline SendMessageRequest() : SendMessageRequest(nullptr) {}
+  ~SendMessageRequest() override;
+  explicit PROTOBUF_CONSTEXPR SendMessageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SendMessageRequest(const SendMessageRequest& from);
   SendMessageRequest(SendMessageRequest&& from) noexcept
@@ -565,8 +729,13 @@ class SendMessageRequest PROTOBUF_FINAL :
     return *this;
   }
   inline SendMessageRequest& operator=(SendMessageRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -577,14 +746,14 @@ class SendMessageRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendMessageRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const SendMessageRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SendMessageRequest* internal_default_instance() {
     return reinterpret_cast<const SendMessageRequest*>(
                &_SendMessageRequest_default_instance_);
@@ -597,7 +766,12 @@ class SendMessageRequest PROTOBUF_FINAL :
   }
   inline void Swap(SendMessageRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -605,56 +779,53 @@ class SendMessageRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SendMessageRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SendMessageRequest* New() const final {
-    return CreateMaybeMessage<SendMessageRequest>(nullptr);
-  }
-
-  SendMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SendMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SendMessageRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SendMessageRequest& from);
-  void MergeFrom(const SendMessageRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendMessageRequest& from) {
+    SendMessageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SendMessageRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.SendMessageRequest";
   }
   protected:
-  explicit SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -663,57 +834,50 @@ class SendMessageRequest PROTOBUF_FINAL :
   enum : int {
     kRecipientFieldNumber = 1,
     kContentFieldNumber = 2,
+    kChannelFieldNumber = 3,
   };
   // string recipient = 1;
   void clear_recipient();
   const std::string& recipient() const;
-  void set_recipient(const std::string& value);
-  void set_recipient(std::string&& value);
-  void set_recipient(const char* value);
-  void set_recipient(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
   std::string* mutable_recipient();
-  std::string* release_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
   void set_allocated_recipient(std::string* recipient);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_recipient();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_recipient(
-      std::string* recipient);
   private:
   const std::string& _internal_recipient() const;
-  void _internal_set_recipient(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
   std::string* _internal_mutable_recipient();
   public:
 
   // string content = 2;
   void clear_content();
   const std::string& content() const;
-  void set_content(const std::string& value);
-  void set_content(std::string&& value);
-  void set_content(const char* value);
-  void set_content(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
   std::string* mutable_content();
-  std::string* release_content();
+  PROTOBUF_NODISCARD std::string* release_content();
   void set_allocated_content(std::string* content);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_content();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_content(
-      std::string* content);
   private:
   const std::string& _internal_content() const;
-  void _internal_set_content(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
   std::string* _internal_mutable_content();
   public:
 
+  // string channel = 3;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
   // @@protoc_insertion_point(class_scope:chat.SendMessageRequest)
  private:
   class _Internal;
@@ -721,18 +885,23 @@ class SendMessageRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IncomingMessageResponse PROTOBUF_FINAL :
+class IncomingMessageResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.IncomingMessageResponse) */ {
  public:
-  inline IncomingMessageResponse() : IncomingMessageResponse(nullptr) {};
-  virtual ~IncomingMessageResponse();
+  inline IncomingMessageResponse() : IncomingMessageResponse(nullptr) {}
+  ~IncomingMessageResponse() override;
+  explicit PROTOBUF_CONSTEXPR IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   IncomingMessageResponse(const IncomingMessageResponse& from);
   IncomingMessageResponse(IncomingMessageResponse&& from) noexcept
@@ -745,8 +914,13 @@ class IncomingMessageResponse PROTOBUF_FINAL :
     return *this;
   }
   inline IncomingMessageResponse& operator=(IncomingMessageResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -757,14 +931,14 @@ class IncomingMessageResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncomingMessageResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const IncomingMessageResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const IncomingMessageResponse* internal_default_instance() {
     return reinterpret_cast<const IncomingMessageResponse*>(
                &_IncomingMessageResponse_default_instance_);
@@ -777,7 +951,12 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   }
   inline void Swap(IncomingMessageResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -785,56 +964,53 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(IncomingMessageResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline IncomingMessageResponse* New() const final {
-    return CreateMaybeMessage<IncomingMessageResponse>(nullptr);
-  }
-
-  IncomingMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  IncomingMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<IncomingMessageResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IncomingMessageResponse& from);
-  void MergeFrom(const IncomingMessageResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncomingMessageResponse& from) {
+    IncomingMessageResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(IncomingMessageResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "chat.IncomingMessageResponse";
   }
   protected:
-  explicit IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -843,58 +1019,61 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   enum : int {
     kSenderFieldNumber = 1,
     kContentFieldNumber = 2,
+    kChannelFieldNumber = 5,
+    kMessageIdFieldNumber = 4,
     kTypeFieldNumber = 3,
   };
   // string sender = 1;
   void clear_sender();
   const std::string& sender() const;
-  void set_sender(const std::string& value);
-  void set_sender(std::string&& value);
-  void set_sender(const char* value);
-  void set_sender(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
   std::string* mutable_sender();
-  std::string* release_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
   void set_allocated_sender(std::string* sender);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_sender();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_sender(
-      std::string* sender);
   private:
   const std::string& _internal_sender() const;
-  void _internal_set_sender(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
   std::string* _internal_mutable_sender();
   public:
 
   // string content = 2;
   void clear_content();
   const std::string& content() const;
-  void set_content(const std::string& value);
-  void set_content(std::string&& value);
-  void set_content(const char* value);
-  void set_content(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
   std::string* mutable_content();
-  std::string* release_content();
+  PROTOBUF_NODISCARD std::string* release_content();
   void set_allocated_content(std::string* content);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_content();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_content(
-      std::string* content);
   private:
   const std::string& _internal_content() const;
-  void _internal_set_content(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
   std::string* _internal_mutable_content();
   public:
 
+  // string channel = 5;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // uint64 message_id = 4;
+  void clear_message_id();
+  uint64_t message_id() const;
+  void set_message_id(uint64_t value);
+  private:
+  uint64_t _internal_message_id() const;
+  void _internal_set_message_id(uint64_t value);
+  public:
+
   // .chat.MessageType type = 3;
   void clear_type();
   ::chat::MessageType type() const;
@@ -911,33 +1090,44 @@ class IncomingMessageResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    uint64_t message_id_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UserListRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListRequest) */ {
+class ChannelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelRequest) */ {
  public:
-  inline UserListRequest() : UserListRequest(nullptr) {};
-  virtual ~UserListRequest();
+  inline ChannelRequest() : ChannelRequest(nullptr) {}
+  ~ChannelRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChannelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UserListRequest(const UserListRequest& from);
-  UserListRequest(UserListRequest&& from) noexcept
-    : UserListRequest() {
+  ChannelRequest(const ChannelRequest& from);
+  ChannelRequest(ChannelRequest&& from) noexcept
+    : ChannelRequest() {
     *this = ::std::move(from);
   }
 
-  inline UserListRequest& operator=(const UserListRequest& from) {
+  inline ChannelRequest& operator=(const ChannelRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UserListRequest& operator=(UserListRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ChannelRequest& operator=(ChannelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -948,149 +1138,149 @@ class UserListRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UserListRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UserListRequest* internal_default_instance() {
-    return reinterpret_cast<const UserListRequest*>(
-               &_UserListRequest_default_instance_);
+  static const ChannelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelRequest* internal_default_instance() {
+    return reinterpret_cast<const ChannelRequest*>(
+               &_ChannelRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(UserListRequest& a, UserListRequest& b) {
+  friend void swap(ChannelRequest& a, ChannelRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(UserListRequest* other) {
+  inline void Swap(ChannelRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(UserListRequest* other) {
+  void UnsafeArenaSwap(ChannelRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UserListRequest* New() const final {
-    return CreateMaybeMessage<UserListRequest>(nullptr);
+  ChannelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelRequest>(arena);
   }
-
-  UserListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UserListRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelRequest& from) {
+    ChannelRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UserListRequest& from);
-  void MergeFrom(const UserListRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UserListRequest* other);
+  void InternalSwap(ChannelRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.UserListRequest";
+    return "chat.ChannelRequest";
   }
   protected:
-  explicit UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUsernameFieldNumber = 1,
+    kChannelFieldNumber = 1,
   };
-  // string username = 1;
-  void clear_username();
-  const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  std::string* mutable_username();
-  std::string* release_username();
-  void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
+  // string channel = 1;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
   private:
-  const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
-  std::string* _internal_mutable_username();
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
   public:
 
-  // @@protoc_insertion_point(class_scope:chat.UserListRequest)
+  // @@protoc_insertion_point(class_scope:chat.ChannelRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UserListResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListResponse) */ {
+class AckRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.AckRequest) */ {
  public:
-  inline UserListResponse() : UserListResponse(nullptr) {};
-  virtual ~UserListResponse();
+  inline AckRequest() : AckRequest(nullptr) {}
+  ~AckRequest() override;
+  explicit PROTOBUF_CONSTEXPR AckRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UserListResponse(const UserListResponse& from);
-  UserListResponse(UserListResponse&& from) noexcept
-    : UserListResponse() {
+  AckRequest(const AckRequest& from);
+  AckRequest(AckRequest&& from) noexcept
+    : AckRequest() {
     *this = ::std::move(from);
   }
 
-  inline UserListResponse& operator=(const UserListResponse& from) {
+  inline AckRequest& operator=(const AckRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UserListResponse& operator=(UserListResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline AckRequest& operator=(AckRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1101,153 +1291,158 @@ class UserListResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UserListResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UserListResponse* internal_default_instance() {
-    return reinterpret_cast<const UserListResponse*>(
-               &_UserListResponse_default_instance_);
+  static const AckRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AckRequest* internal_default_instance() {
+    return reinterpret_cast<const AckRequest*>(
+               &_AckRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(UserListResponse& a, UserListResponse& b) {
+  friend void swap(AckRequest& a, AckRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(UserListResponse* other) {
+  inline void Swap(AckRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(UserListResponse* other) {
+  void UnsafeArenaSwap(AckRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UserListResponse* New() const final {
-    return CreateMaybeMessage<UserListResponse>(nullptr);
+  AckRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AckRequest>(arena);
   }
-
-  UserListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UserListResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AckRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AckRequest& from) {
+    AckRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UserListResponse& from);
-  void MergeFrom(const UserListResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UserListResponse* other);
+  void InternalSwap(AckRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.UserListResponse";
+    return "chat.AckRequest";
   }
   protected:
-  explicit UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUsersFieldNumber = 1,
-    kTypeFieldNumber = 2,
+    kMessageIdsFieldNumber = 1,
   };
-  // repeated .chat.User users = 1;
-  int users_size() const;
-  private:
-  int _internal_users_size() const;
-  public:
-  void clear_users();
-  ::chat::User* mutable_users(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
-      mutable_users();
+  // repeated uint64 message_ids = 1;
+  int message_ids_size() const;
   private:
-  const ::chat::User& _internal_users(int index) const;
-  ::chat::User* _internal_add_users();
+  int _internal_message_ids_size() const;
   public:
-  const ::chat::User& users(int index) const;
-  ::chat::User* add_users();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
-      users() const;
-
-  // .chat.UserListType type = 2;
-  void clear_type();
-  ::chat::UserListType type() const;
-  void set_type(::chat::UserListType value);
+  void clear_message_ids();
   private:
-  ::chat::UserListType _internal_type() const;
-  void _internal_set_type(::chat::UserListType value);
+  uint64_t _internal_message_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_message_ids() const;
+  void _internal_add_message_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_message_ids();
   public:
-
-  // @@protoc_insertion_point(class_scope:chat.UserListResponse)
+  uint64_t message_ids(int index) const;
+  void set_message_ids(int index, uint64_t value);
+  void add_message_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      message_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_message_ids();
+
+  // @@protoc_insertion_point(class_scope:chat.AckRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > message_ids_;
+    mutable std::atomic<int> _message_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateStatusRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpdateStatusRequest) */ {
+class DeliveryReceipt final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.DeliveryReceipt) */ {
  public:
-  inline UpdateStatusRequest() : UpdateStatusRequest(nullptr) {};
-  virtual ~UpdateStatusRequest();
+  inline DeliveryReceipt() : DeliveryReceipt(nullptr) {}
+  ~DeliveryReceipt() override;
+  explicit PROTOBUF_CONSTEXPR DeliveryReceipt(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UpdateStatusRequest(const UpdateStatusRequest& from);
-  UpdateStatusRequest(UpdateStatusRequest&& from) noexcept
-    : UpdateStatusRequest() {
+  DeliveryReceipt(const DeliveryReceipt& from);
+  DeliveryReceipt(DeliveryReceipt&& from) noexcept
+    : DeliveryReceipt() {
     *this = ::std::move(from);
   }
 
-  inline UpdateStatusRequest& operator=(const UpdateStatusRequest& from) {
+  inline DeliveryReceipt& operator=(const DeliveryReceipt& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UpdateStatusRequest& operator=(UpdateStatusRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline DeliveryReceipt& operator=(DeliveryReceipt&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1258,160 +1453,144 @@ class UpdateStatusRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UpdateStatusRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UpdateStatusRequest* internal_default_instance() {
-    return reinterpret_cast<const UpdateStatusRequest*>(
-               &_UpdateStatusRequest_default_instance_);
+  static const DeliveryReceipt& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeliveryReceipt* internal_default_instance() {
+    return reinterpret_cast<const DeliveryReceipt*>(
+               &_DeliveryReceipt_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(UpdateStatusRequest& a, UpdateStatusRequest& b) {
+  friend void swap(DeliveryReceipt& a, DeliveryReceipt& b) {
     a.Swap(&b);
   }
-  inline void Swap(UpdateStatusRequest* other) {
+  inline void Swap(DeliveryReceipt* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(UpdateStatusRequest* other) {
+  void UnsafeArenaSwap(DeliveryReceipt* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateStatusRequest* New() const final {
-    return CreateMaybeMessage<UpdateStatusRequest>(nullptr);
+  DeliveryReceipt* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeliveryReceipt>(arena);
   }
-
-  UpdateStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UpdateStatusRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeliveryReceipt& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeliveryReceipt& from) {
+    DeliveryReceipt::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UpdateStatusRequest& from);
-  void MergeFrom(const UpdateStatusRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UpdateStatusRequest* other);
+  void InternalSwap(DeliveryReceipt* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.UpdateStatusRequest";
+    return "chat.DeliveryReceipt";
   }
   protected:
-  explicit UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit DeliveryReceipt(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUsernameFieldNumber = 1,
-    kNewStatusFieldNumber = 2,
+    kDeliveredThroughFieldNumber = 1,
   };
-  // string username = 1;
-  void clear_username();
-  const std::string& username() const;
-  void set_username(const std::string& value);
-  void set_username(std::string&& value);
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  std::string* mutable_username();
-  std::string* release_username();
-  void set_allocated_username(std::string* username);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_username();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_username(
-      std::string* username);
-  private:
-  const std::string& _internal_username() const;
-  void _internal_set_username(const std::string& value);
-  std::string* _internal_mutable_username();
-  public:
-
-  // .chat.UserStatus new_status = 2;
-  void clear_new_status();
-  ::chat::UserStatus new_status() const;
-  void set_new_status(::chat::UserStatus value);
+  // uint64 delivered_through = 1;
+  void clear_delivered_through();
+  uint64_t delivered_through() const;
+  void set_delivered_through(uint64_t value);
   private:
-  ::chat::UserStatus _internal_new_status() const;
-  void _internal_set_new_status(::chat::UserStatus value);
+  uint64_t _internal_delivered_through() const;
+  void _internal_set_delivered_through(uint64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:chat.UpdateStatusRequest)
+  // @@protoc_insertion_point(class_scope:chat.DeliveryReceipt)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
-  int new_status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t delivered_through_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Request PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Request) */ {
+class UserListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListRequest) */ {
  public:
-  inline Request() : Request(nullptr) {};
-  virtual ~Request();
+  inline UserListRequest() : UserListRequest(nullptr) {}
+  ~UserListRequest() override;
+  explicit PROTOBUF_CONSTEXPR UserListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Request(const Request& from);
-  Request(Request&& from) noexcept
-    : Request() {
+  UserListRequest(const UserListRequest& from);
+  UserListRequest(UserListRequest&& from) noexcept
+    : UserListRequest() {
     *this = ::std::move(from);
   }
 
-  inline Request& operator=(const Request& from) {
+  inline UserListRequest& operator=(const UserListRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Request& operator=(Request&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline UserListRequest& operator=(UserListRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1422,257 +1601,214 @@ class Request PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Request& default_instance();
-
-  enum PayloadCase {
-    kRegisterUser = 2,
-    kSendMessage = 3,
-    kUpdateStatus = 4,
-    kGetUsers = 5,
-    kUnregisterUser = 6,
-    PAYLOAD_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Request* internal_default_instance() {
-    return reinterpret_cast<const Request*>(
-               &_Request_default_instance_);
+  static const UserListRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserListRequest* internal_default_instance() {
+    return reinterpret_cast<const UserListRequest*>(
+               &_UserListRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(Request& a, Request& b) {
+  friend void swap(UserListRequest& a, UserListRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(Request* other) {
+  inline void Swap(UserListRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Request* other) {
+  void UnsafeArenaSwap(UserListRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Request* New() const final {
-    return CreateMaybeMessage<Request>(nullptr);
+  UserListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserListRequest>(arena);
   }
-
-  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Request>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserListRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListRequest& from) {
+    UserListRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Request& from);
-  void MergeFrom(const Request& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Request* other);
+  void InternalSwap(UserListRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.Request";
+    return "chat.UserListRequest";
   }
   protected:
-  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kOperationFieldNumber = 1,
-    kRegisterUserFieldNumber = 2,
-    kSendMessageFieldNumber = 3,
-    kUpdateStatusFieldNumber = 4,
-    kGetUsersFieldNumber = 5,
-    kUnregisterUserFieldNumber = 6,
+    kUsernameFieldNumber = 1,
+    kCursorFieldNumber = 2,
+    kPrefixFieldNumber = 3,
+    kFilterStatusFieldNumber = 4,
+    kStatusFieldNumber = 5,
+    kLimitFieldNumber = 6,
   };
-  // .chat.Operation operation = 1;
-  void clear_operation();
-  ::chat::Operation operation() const;
-  void set_operation(::chat::Operation value);
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
   private:
-  ::chat::Operation _internal_operation() const;
-  void _internal_set_operation(::chat::Operation value);
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
   public:
 
-  // .chat.NewUserRequest register_user = 2;
-  bool has_register_user() const;
-  private:
-  bool _internal_has_register_user() const;
-  public:
-  void clear_register_user();
-  const ::chat::NewUserRequest& register_user() const;
-  ::chat::NewUserRequest* release_register_user();
-  ::chat::NewUserRequest* mutable_register_user();
-  void set_allocated_register_user(::chat::NewUserRequest* register_user);
+  // string cursor = 2;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
   private:
-  const ::chat::NewUserRequest& _internal_register_user() const;
-  ::chat::NewUserRequest* _internal_mutable_register_user();
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
   public:
-  void unsafe_arena_set_allocated_register_user(
-      ::chat::NewUserRequest* register_user);
-  ::chat::NewUserRequest* unsafe_arena_release_register_user();
 
-  // .chat.SendMessageRequest send_message = 3;
-  bool has_send_message() const;
-  private:
-  bool _internal_has_send_message() const;
-  public:
-  void clear_send_message();
-  const ::chat::SendMessageRequest& send_message() const;
-  ::chat::SendMessageRequest* release_send_message();
-  ::chat::SendMessageRequest* mutable_send_message();
-  void set_allocated_send_message(::chat::SendMessageRequest* send_message);
+  // string prefix = 3;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
   private:
-  const ::chat::SendMessageRequest& _internal_send_message() const;
-  ::chat::SendMessageRequest* _internal_mutable_send_message();
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
   public:
-  void unsafe_arena_set_allocated_send_message(
-      ::chat::SendMessageRequest* send_message);
-  ::chat::SendMessageRequest* unsafe_arena_release_send_message();
 
-  // .chat.UpdateStatusRequest update_status = 4;
-  bool has_update_status() const;
-  private:
-  bool _internal_has_update_status() const;
-  public:
-  void clear_update_status();
-  const ::chat::UpdateStatusRequest& update_status() const;
-  ::chat::UpdateStatusRequest* release_update_status();
-  ::chat::UpdateStatusRequest* mutable_update_status();
-  void set_allocated_update_status(::chat::UpdateStatusRequest* update_status);
+  // bool filter_status = 4;
+  void clear_filter_status();
+  bool filter_status() const;
+  void set_filter_status(bool value);
   private:
-  const ::chat::UpdateStatusRequest& _internal_update_status() const;
-  ::chat::UpdateStatusRequest* _internal_mutable_update_status();
+  bool _internal_filter_status() const;
+  void _internal_set_filter_status(bool value);
   public:
-  void unsafe_arena_set_allocated_update_status(
-      ::chat::UpdateStatusRequest* update_status);
-  ::chat::UpdateStatusRequest* unsafe_arena_release_update_status();
 
-  // .chat.UserListRequest get_users = 5;
-  bool has_get_users() const;
-  private:
-  bool _internal_has_get_users() const;
-  public:
-  void clear_get_users();
-  const ::chat::UserListRequest& get_users() const;
-  ::chat::UserListRequest* release_get_users();
-  ::chat::UserListRequest* mutable_get_users();
-  void set_allocated_get_users(::chat::UserListRequest* get_users);
+  // .chat.UserStatus status = 5;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
   private:
-  const ::chat::UserListRequest& _internal_get_users() const;
-  ::chat::UserListRequest* _internal_mutable_get_users();
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
   public:
-  void unsafe_arena_set_allocated_get_users(
-      ::chat::UserListRequest* get_users);
-  ::chat::UserListRequest* unsafe_arena_release_get_users();
 
-  // .chat.User unregister_user = 6;
-  bool has_unregister_user() const;
+  // uint32 limit = 6;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
   private:
-  bool _internal_has_unregister_user() const;
-  public:
-  void clear_unregister_user();
-  const ::chat::User& unregister_user() const;
-  ::chat::User* release_unregister_user();
-  ::chat::User* mutable_unregister_user();
-  void set_allocated_unregister_user(::chat::User* unregister_user);
-  private:
-  const ::chat::User& _internal_unregister_user() const;
-  ::chat::User* _internal_mutable_unregister_user();
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_unregister_user(
-      ::chat::User* unregister_user);
-  ::chat::User* unsafe_arena_release_unregister_user();
 
-  void clear_payload();
-  PayloadCase payload_case() const;
-  // @@protoc_insertion_point(class_scope:chat.Request)
+  // @@protoc_insertion_point(class_scope:chat.UserListRequest)
  private:
   class _Internal;
-  void set_has_register_user();
-  void set_has_send_message();
-  void set_has_update_status();
-  void set_has_get_users();
-  void set_has_unregister_user();
-
-  inline bool has_payload() const;
-  inline void clear_has_payload();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  int operation_;
-  union PayloadUnion {
-    PayloadUnion() {}
-    ::chat::NewUserRequest* register_user_;
-    ::chat::SendMessageRequest* send_message_;
-    ::chat::UpdateStatusRequest* update_status_;
-    ::chat::UserListRequest* get_users_;
-    ::chat::User* unregister_user_;
-  } payload_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
-
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    bool filter_status_;
+    int status_;
+    uint32_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Response PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Response) */ {
+class UserListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListResponse) */ {
  public:
-  inline Response() : Response(nullptr) {};
-  virtual ~Response();
+  inline UserListResponse() : UserListResponse(nullptr) {}
+  ~UserListResponse() override;
+  explicit PROTOBUF_CONSTEXPR UserListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Response(const Response& from);
-  Response(Response&& from) noexcept
-    : Response() {
+  UserListResponse(const UserListResponse& from);
+  UserListResponse(UserListResponse&& from) noexcept
+    : UserListResponse() {
     *this = ::std::move(from);
   }
 
-  inline Response& operator=(const Response& from) {
+  inline UserListResponse& operator=(const UserListResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Response& operator=(Response&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline UserListResponse& operator=(UserListResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1683,1687 +1819,9057 @@ class Response PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Response& default_instance();
-
-  enum ResultCase {
-    kUserList = 4,
-    kIncomingMessage = 5,
-    RESULT_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Response* internal_default_instance() {
-    return reinterpret_cast<const Response*>(
-               &_Response_default_instance_);
+  static const UserListResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserListResponse* internal_default_instance() {
+    return reinterpret_cast<const UserListResponse*>(
+               &_UserListResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(Response& a, Response& b) {
+  friend void swap(UserListResponse& a, UserListResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(Response* other) {
+  inline void Swap(UserListResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Response* other) {
+  void UnsafeArenaSwap(UserListResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Response* New() const final {
-    return CreateMaybeMessage<Response>(nullptr);
+  UserListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserListResponse>(arena);
   }
-
-  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Response>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserListResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListResponse& from) {
+    UserListResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Response& from);
-  void MergeFrom(const Response& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Response* other);
+  void InternalSwap(UserListResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "chat.Response";
+    return "chat.UserListResponse";
   }
   protected:
-  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_chat_2eproto);
-    return ::descriptor_table_chat_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 3,
-    kOperationFieldNumber = 1,
-    kStatusCodeFieldNumber = 2,
-    kUserListFieldNumber = 4,
-    kIncomingMessageFieldNumber = 5,
+    kUsersFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kTypeFieldNumber = 2,
   };
-  // string message = 3;
-  void clear_message();
-  const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
-  std::string* mutable_message();
-  std::string* release_message();
-  void set_allocated_message(std::string* message);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_message();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_message(
-      std::string* message);
+  // repeated .chat.User users = 1;
+  int users_size() const;
   private:
-  const std::string& _internal_message() const;
-  void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  int _internal_users_size() const;
   public:
-
-  // .chat.Operation operation = 1;
-  void clear_operation();
-  ::chat::Operation operation() const;
-  void set_operation(::chat::Operation value);
+  void clear_users();
+  ::chat::User* mutable_users(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+      mutable_users();
   private:
-  ::chat::Operation _internal_operation() const;
-  void _internal_set_operation(::chat::Operation value);
+  const ::chat::User& _internal_users(int index) const;
+  ::chat::User* _internal_add_users();
   public:
+  const ::chat::User& users(int index) const;
+  ::chat::User* add_users();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+      users() const;
 
-  // .chat.StatusCode status_code = 2;
-  void clear_status_code();
-  ::chat::StatusCode status_code() const;
-  void set_status_code(::chat::StatusCode value);
+  // string next_cursor = 3;
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
   private:
-  ::chat::StatusCode _internal_status_code() const;
-  void _internal_set_status_code(::chat::StatusCode value);
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
   public:
 
-  // .chat.UserListResponse user_list = 4;
-  bool has_user_list() const;
-  private:
-  bool _internal_has_user_list() const;
-  public:
-  void clear_user_list();
-  const ::chat::UserListResponse& user_list() const;
-  ::chat::UserListResponse* release_user_list();
-  ::chat::UserListResponse* mutable_user_list();
-  void set_allocated_user_list(::chat::UserListResponse* user_list);
+  // .chat.UserListType type = 2;
+  void clear_type();
+  ::chat::UserListType type() const;
+  void set_type(::chat::UserListType value);
   private:
-  const ::chat::UserListResponse& _internal_user_list() const;
-  ::chat::UserListResponse* _internal_mutable_user_list();
+  ::chat::UserListType _internal_type() const;
+  void _internal_set_type(::chat::UserListType value);
   public:
-  void unsafe_arena_set_allocated_user_list(
-      ::chat::UserListResponse* user_list);
-  ::chat::UserListResponse* unsafe_arena_release_user_list();
 
-  // .chat.IncomingMessageResponse incoming_message = 5;
-  bool has_incoming_message() const;
+  // @@protoc_insertion_point(class_scope:chat.UserListResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceSubscribeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceSubscribeRequest) */ {
+ public:
+  inline PresenceSubscribeRequest() : PresenceSubscribeRequest(nullptr) {}
+  ~PresenceSubscribeRequest() override;
+  explicit PROTOBUF_CONSTEXPR PresenceSubscribeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceSubscribeRequest(const PresenceSubscribeRequest& from);
+  PresenceSubscribeRequest(PresenceSubscribeRequest&& from) noexcept
+    : PresenceSubscribeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceSubscribeRequest& operator=(const PresenceSubscribeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceSubscribeRequest& operator=(PresenceSubscribeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceSubscribeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceSubscribeRequest* internal_default_instance() {
+    return reinterpret_cast<const PresenceSubscribeRequest*>(
+               &_PresenceSubscribeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PresenceSubscribeRequest& a, PresenceSubscribeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceSubscribeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceSubscribeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceSubscribeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceSubscribeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceSubscribeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceSubscribeRequest& from) {
+    PresenceSubscribeRequest::MergeImpl(*this, from);
+  }
   private:
-  bool _internal_has_incoming_message() const;
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  void clear_incoming_message();
-  const ::chat::IncomingMessageResponse& incoming_message() const;
-  ::chat::IncomingMessageResponse* release_incoming_message();
-  ::chat::IncomingMessageResponse* mutable_incoming_message();
-  void set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  const ::chat::IncomingMessageResponse& _internal_incoming_message() const;
-  ::chat::IncomingMessageResponse* _internal_mutable_incoming_message();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceSubscribeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceSubscribeRequest";
+  }
+  protected:
+  explicit PresenceSubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  void unsafe_arena_set_allocated_incoming_message(
-      ::chat::IncomingMessageResponse* incoming_message);
-  ::chat::IncomingMessageResponse* unsafe_arena_release_incoming_message();
 
-  void clear_result();
-  ResultCase result_case() const;
-  // @@protoc_insertion_point(class_scope:chat.Response)
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUnsubscribeFieldNumber = 1,
+  };
+  // bool unsubscribe = 1;
+  void clear_unsubscribe();
+  bool unsubscribe() const;
+  void set_unsubscribe(bool value);
+  private:
+  bool _internal_unsubscribe() const;
+  void _internal_set_unsubscribe(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceSubscribeRequest)
  private:
   class _Internal;
-  void set_has_user_list();
-  void set_has_incoming_message();
-
-  inline bool has_result() const;
-  inline void clear_has_result();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  int operation_;
-  int status_code_;
-  union ResultUnion {
-    ResultUnion() {}
-    ::chat::UserListResponse* user_list_;
-    ::chat::IncomingMessageResponse* incoming_message_;
-  } result_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    bool unsubscribe_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceDelta) */ {
+ public:
+  inline PresenceDelta() : PresenceDelta(nullptr) {}
+  ~PresenceDelta() override;
+  explicit PROTOBUF_CONSTEXPR PresenceDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceDelta(const PresenceDelta& from);
+  PresenceDelta(PresenceDelta&& from) noexcept
+    : PresenceDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceDelta& operator=(const PresenceDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceDelta& operator=(PresenceDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceDelta* internal_default_instance() {
+    return reinterpret_cast<const PresenceDelta*>(
+               &_PresenceDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
+  friend void swap(PresenceDelta& a, PresenceDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceDelta& from) {
+    PresenceDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceDelta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceDelta";
+  }
+  protected:
+  explicit PresenceDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserFieldNumber = 2,
+    kVersionFieldNumber = 3,
+    kEventFieldNumber = 1,
+  };
+  // .chat.User user = 2;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::chat::User& user() const;
+  PROTOBUF_NODISCARD ::chat::User* release_user();
+  ::chat::User* mutable_user();
+  void set_allocated_user(::chat::User* user);
+  private:
+  const ::chat::User& _internal_user() const;
+  ::chat::User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::chat::User* user);
+  ::chat::User* unsafe_arena_release_user();
+
+  // uint64 version = 3;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // .chat.PresenceEvent event = 1;
+  void clear_event();
+  ::chat::PresenceEvent event() const;
+  void set_event(::chat::PresenceEvent value);
+  private:
+  ::chat::PresenceEvent _internal_event() const;
+  void _internal_set_event(::chat::PresenceEvent value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::chat::User* user_;
+    uint64_t version_;
+    int event_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_chat_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PresenceUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceUpdate) */ {
+ public:
+  inline PresenceUpdate() : PresenceUpdate(nullptr) {}
+  ~PresenceUpdate() override;
+  explicit PROTOBUF_CONSTEXPR PresenceUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  PresenceUpdate(const PresenceUpdate& from);
+  PresenceUpdate(PresenceUpdate&& from) noexcept
+    : PresenceUpdate() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// User
+  inline PresenceUpdate& operator=(const PresenceUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceUpdate& operator=(PresenceUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string username = 1;
-inline void User::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& User::username() const {
-  // @@protoc_insertion_point(field_get:chat.User.username)
-  return _internal_username();
-}
-inline void User::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.User.username)
-}
-inline std::string* User::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.User.username)
-  return _internal_mutable_username();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceUpdate* internal_default_instance() {
+    return reinterpret_cast<const PresenceUpdate*>(
+               &_PresenceUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(PresenceUpdate& a, PresenceUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceUpdate& from) {
+    PresenceUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceUpdate";
+  }
+  protected:
+  explicit PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeltasFieldNumber = 3,
+    kVersionFieldNumber = 1,
+    kSnapshotFieldNumber = 2,
+  };
+  // repeated .chat.PresenceDelta deltas = 3;
+  int deltas_size() const;
+  private:
+  int _internal_deltas_size() const;
+  public:
+  void clear_deltas();
+  ::chat::PresenceDelta* mutable_deltas(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >*
+      mutable_deltas();
+  private:
+  const ::chat::PresenceDelta& _internal_deltas(int index) const;
+  ::chat::PresenceDelta* _internal_add_deltas();
+  public:
+  const ::chat::PresenceDelta& deltas(int index) const;
+  ::chat::PresenceDelta* add_deltas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >&
+      deltas() const;
+
+  // uint64 version = 1;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // bool snapshot = 2;
+  void clear_snapshot();
+  bool snapshot() const;
+  void set_snapshot(bool value);
+  private:
+  bool _internal_snapshot() const;
+  void _internal_set_snapshot(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta > deltas_;
+    uint64_t version_;
+    bool snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.TransferStart) */ {
+ public:
+  inline TransferStart() : TransferStart(nullptr) {}
+  ~TransferStart() override;
+  explicit PROTOBUF_CONSTEXPR TransferStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferStart(const TransferStart& from);
+  TransferStart(TransferStart&& from) noexcept
+    : TransferStart() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferStart& operator=(const TransferStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferStart& operator=(TransferStart&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferStart& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferStart* internal_default_instance() {
+    return reinterpret_cast<const TransferStart*>(
+               &_TransferStart_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TransferStart& a, TransferStart& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferStart>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferStart& from) {
+    TransferStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferStart* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.TransferStart";
+  }
+  protected:
+  explicit TransferStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecipientFieldNumber = 2,
+    kChannelFieldNumber = 3,
+    kNameFieldNumber = 4,
+    kSenderFieldNumber = 6,
+    kTransferIdFieldNumber = 1,
+    kTotalSizeFieldNumber = 5,
+    kTypeFieldNumber = 7,
+  };
+  // string recipient = 2;
+  void clear_recipient();
+  const std::string& recipient() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* recipient);
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
+  std::string* _internal_mutable_recipient();
+  public:
+
+  // string channel = 3;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // string name = 4;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string sender = 6;
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
+  private:
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
+  public:
+
+  // uint64 transfer_id = 1;
+  void clear_transfer_id();
+  uint64_t transfer_id() const;
+  void set_transfer_id(uint64_t value);
+  private:
+  uint64_t _internal_transfer_id() const;
+  void _internal_set_transfer_id(uint64_t value);
+  public:
+
+  // uint64 total_size = 5;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
+  private:
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
+  public:
+
+  // .chat.MessageType type = 7;
+  void clear_type();
+  ::chat::MessageType type() const;
+  void set_type(::chat::MessageType value);
+  private:
+  ::chat::MessageType _internal_type() const;
+  void _internal_set_type(::chat::MessageType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.TransferStart)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    uint64_t transfer_id_;
+    uint64_t total_size_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.TransferChunk) */ {
+ public:
+  inline TransferChunk() : TransferChunk(nullptr) {}
+  ~TransferChunk() override;
+  explicit PROTOBUF_CONSTEXPR TransferChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferChunk(const TransferChunk& from);
+  TransferChunk(TransferChunk&& from) noexcept
+    : TransferChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferChunk& operator=(const TransferChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferChunk& operator=(TransferChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferChunk* internal_default_instance() {
+    return reinterpret_cast<const TransferChunk*>(
+               &_TransferChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(TransferChunk& a, TransferChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferChunk& from) {
+    TransferChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.TransferChunk";
+  }
+  protected:
+  explicit TransferChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kTransferIdFieldNumber = 1,
+    kSequenceFieldNumber = 2,
+    kLastFieldNumber = 4,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // uint64 transfer_id = 1;
+  void clear_transfer_id();
+  uint64_t transfer_id() const;
+  void set_transfer_id(uint64_t value);
+  private:
+  uint64_t _internal_transfer_id() const;
+  void _internal_set_transfer_id(uint64_t value);
+  public:
+
+  // uint32 sequence = 2;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
+  private:
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
+  public:
+
+  // bool last = 4;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.TransferChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t transfer_id_;
+    uint32_t sequence_;
+    bool last_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferCredit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.TransferCredit) */ {
+ public:
+  inline TransferCredit() : TransferCredit(nullptr) {}
+  ~TransferCredit() override;
+  explicit PROTOBUF_CONSTEXPR TransferCredit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferCredit(const TransferCredit& from);
+  TransferCredit(TransferCredit&& from) noexcept
+    : TransferCredit() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferCredit& operator=(const TransferCredit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferCredit& operator=(TransferCredit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferCredit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferCredit* internal_default_instance() {
+    return reinterpret_cast<const TransferCredit*>(
+               &_TransferCredit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(TransferCredit& a, TransferCredit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferCredit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferCredit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferCredit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferCredit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferCredit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferCredit& from) {
+    TransferCredit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferCredit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.TransferCredit";
+  }
+  protected:
+  explicit TransferCredit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTransferIdFieldNumber = 1,
+    kChunksFieldNumber = 2,
+  };
+  // uint64 transfer_id = 1;
+  void clear_transfer_id();
+  uint64_t transfer_id() const;
+  void set_transfer_id(uint64_t value);
+  private:
+  uint64_t _internal_transfer_id() const;
+  void _internal_set_transfer_id(uint64_t value);
+  public:
+
+  // uint32 chunks = 2;
+  void clear_chunks();
+  uint32_t chunks() const;
+  void set_chunks(uint32_t value);
+  private:
+  uint32_t _internal_chunks() const;
+  void _internal_set_chunks(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.TransferCredit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t transfer_id_;
+    uint32_t chunks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerShutdown final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ServerShutdown) */ {
+ public:
+  inline ServerShutdown() : ServerShutdown(nullptr) {}
+  ~ServerShutdown() override;
+  explicit PROTOBUF_CONSTEXPR ServerShutdown(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerShutdown(const ServerShutdown& from);
+  ServerShutdown(ServerShutdown&& from) noexcept
+    : ServerShutdown() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerShutdown& operator=(const ServerShutdown& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerShutdown& operator=(ServerShutdown&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerShutdown& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerShutdown* internal_default_instance() {
+    return reinterpret_cast<const ServerShutdown*>(
+               &_ServerShutdown_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ServerShutdown& a, ServerShutdown& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerShutdown* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerShutdown* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerShutdown* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerShutdown>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerShutdown& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerShutdown& from) {
+    ServerShutdown::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerShutdown* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ServerShutdown";
+  }
+  protected:
+  explicit ServerShutdown(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReconnectAfterMsFieldNumber = 1,
+  };
+  // uint32 reconnect_after_ms = 1;
+  void clear_reconnect_after_ms();
+  uint32_t reconnect_after_ms() const;
+  void set_reconnect_after_ms(uint32_t value);
+  private:
+  uint32_t _internal_reconnect_after_ms() const;
+  void _internal_set_reconnect_after_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ServerShutdown)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t reconnect_after_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpgradeSession final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpgradeSession) */ {
+ public:
+  inline UpgradeSession() : UpgradeSession(nullptr) {}
+  ~UpgradeSession() override;
+  explicit PROTOBUF_CONSTEXPR UpgradeSession(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpgradeSession(const UpgradeSession& from);
+  UpgradeSession(UpgradeSession&& from) noexcept
+    : UpgradeSession() {
+    *this = ::std::move(from);
+  }
+
+  inline UpgradeSession& operator=(const UpgradeSession& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpgradeSession& operator=(UpgradeSession&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpgradeSession& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpgradeSession* internal_default_instance() {
+    return reinterpret_cast<const UpgradeSession*>(
+               &_UpgradeSession_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(UpgradeSession& a, UpgradeSession& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpgradeSession* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpgradeSession* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpgradeSession* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpgradeSession>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpgradeSession& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpgradeSession& from) {
+    UpgradeSession::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpgradeSession* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UpgradeSession";
+  }
+  protected:
+  explicit UpgradeSession(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelsFieldNumber = 6,
+    kUsernameFieldNumber = 1,
+    kIpFieldNumber = 8,
+    kPeerNodeFieldNumber = 9,
+    kStatusFieldNumber = 2,
+    kCodecFieldNumber = 4,
+    kAckModeFieldNumber = 3,
+    kPresenceFieldNumber = 5,
+    kSharedMemoryFieldNumber = 10,
+    kPendingInputFieldNumber = 7,
+  };
+  // repeated string channels = 6;
+  int channels_size() const;
+  private:
+  int _internal_channels_size() const;
+  public:
+  void clear_channels();
+  const std::string& channels(int index) const;
+  std::string* mutable_channels(int index);
+  void set_channels(int index, const std::string& value);
+  void set_channels(int index, std::string&& value);
+  void set_channels(int index, const char* value);
+  void set_channels(int index, const char* value, size_t size);
+  std::string* add_channels();
+  void add_channels(const std::string& value);
+  void add_channels(std::string&& value);
+  void add_channels(const char* value);
+  void add_channels(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& channels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_channels();
+  private:
+  const std::string& _internal_channels(int index) const;
+  std::string* _internal_add_channels();
+  public:
+
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string ip = 8;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // string peer_node = 9;
+  void clear_peer_node();
+  const std::string& peer_node() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_peer_node(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_peer_node();
+  PROTOBUF_NODISCARD std::string* release_peer_node();
+  void set_allocated_peer_node(std::string* peer_node);
+  private:
+  const std::string& _internal_peer_node() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_peer_node(const std::string& value);
+  std::string* _internal_mutable_peer_node();
+  public:
+
+  // .chat.UserStatus status = 2;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // .chat.Codec codec = 4;
+  void clear_codec();
+  ::chat::Codec codec() const;
+  void set_codec(::chat::Codec value);
+  private:
+  ::chat::Codec _internal_codec() const;
+  void _internal_set_codec(::chat::Codec value);
+  public:
+
+  // bool ack_mode = 3;
+  void clear_ack_mode();
+  bool ack_mode() const;
+  void set_ack_mode(bool value);
+  private:
+  bool _internal_ack_mode() const;
+  void _internal_set_ack_mode(bool value);
+  public:
+
+  // bool presence = 5;
+  void clear_presence();
+  bool presence() const;
+  void set_presence(bool value);
+  private:
+  bool _internal_presence() const;
+  void _internal_set_presence(bool value);
+  public:
+
+  // bool shared_memory = 10;
+  void clear_shared_memory();
+  bool shared_memory() const;
+  void set_shared_memory(bool value);
+  private:
+  bool _internal_shared_memory() const;
+  void _internal_set_shared_memory(bool value);
+  public:
+
+  // uint32 pending_input = 7;
+  void clear_pending_input();
+  uint32_t pending_input() const;
+  void set_pending_input(uint32_t value);
+  private:
+  uint32_t _internal_pending_input() const;
+  void _internal_set_pending_input(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UpgradeSession)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> channels_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr peer_node_;
+    int status_;
+    int codec_;
+    bool ack_mode_;
+    bool presence_;
+    bool shared_memory_;
+    uint32_t pending_input_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpgradeDone final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpgradeDone) */ {
+ public:
+  inline UpgradeDone() : UpgradeDone(nullptr) {}
+  ~UpgradeDone() override;
+  explicit PROTOBUF_CONSTEXPR UpgradeDone(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpgradeDone(const UpgradeDone& from);
+  UpgradeDone(UpgradeDone&& from) noexcept
+    : UpgradeDone() {
+    *this = ::std::move(from);
+  }
+
+  inline UpgradeDone& operator=(const UpgradeDone& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpgradeDone& operator=(UpgradeDone&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpgradeDone& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpgradeDone* internal_default_instance() {
+    return reinterpret_cast<const UpgradeDone*>(
+               &_UpgradeDone_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(UpgradeDone& a, UpgradeDone& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpgradeDone* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpgradeDone* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpgradeDone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpgradeDone>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpgradeDone& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpgradeDone& from) {
+    UpgradeDone::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpgradeDone* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UpgradeDone";
+  }
+  protected:
+  explicit UpgradeDone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRegistryVersionFieldNumber = 1,
+    kIncarnationFieldNumber = 2,
+  };
+  // uint64 registry_version = 1;
+  void clear_registry_version();
+  uint64_t registry_version() const;
+  void set_registry_version(uint64_t value);
+  private:
+  uint64_t _internal_registry_version() const;
+  void _internal_set_registry_version(uint64_t value);
+  public:
+
+  // uint64 incarnation = 2;
+  void clear_incarnation();
+  uint64_t incarnation() const;
+  void set_incarnation(uint64_t value);
+  private:
+  uint64_t _internal_incarnation() const;
+  void _internal_set_incarnation(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UpgradeDone)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t registry_version_;
+    uint64_t incarnation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpgradeRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpgradeRecord) */ {
+ public:
+  inline UpgradeRecord() : UpgradeRecord(nullptr) {}
+  ~UpgradeRecord() override;
+  explicit PROTOBUF_CONSTEXPR UpgradeRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpgradeRecord(const UpgradeRecord& from);
+  UpgradeRecord(UpgradeRecord&& from) noexcept
+    : UpgradeRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline UpgradeRecord& operator=(const UpgradeRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpgradeRecord& operator=(UpgradeRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpgradeRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  enum RecordCase {
+    kListener = 1,
+    kSession = 2,
+    kDone = 3,
+    kRequest = 4,
+    RECORD_NOT_SET = 0,
+  };
+
+  static inline const UpgradeRecord* internal_default_instance() {
+    return reinterpret_cast<const UpgradeRecord*>(
+               &_UpgradeRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(UpgradeRecord& a, UpgradeRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpgradeRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpgradeRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpgradeRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpgradeRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpgradeRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpgradeRecord& from) {
+    UpgradeRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpgradeRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UpgradeRecord";
+  }
+  protected:
+  explicit UpgradeRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kListenerFieldNumber = 1,
+    kSessionFieldNumber = 2,
+    kDoneFieldNumber = 3,
+    kRequestFieldNumber = 4,
+  };
+  // bool listener = 1;
+  bool has_listener() const;
+  private:
+  bool _internal_has_listener() const;
+  public:
+  void clear_listener();
+  bool listener() const;
+  void set_listener(bool value);
+  private:
+  bool _internal_listener() const;
+  void _internal_set_listener(bool value);
+  public:
+
+  // .chat.UpgradeSession session = 2;
+  bool has_session() const;
+  private:
+  bool _internal_has_session() const;
+  public:
+  void clear_session();
+  const ::chat::UpgradeSession& session() const;
+  PROTOBUF_NODISCARD ::chat::UpgradeSession* release_session();
+  ::chat::UpgradeSession* mutable_session();
+  void set_allocated_session(::chat::UpgradeSession* session);
+  private:
+  const ::chat::UpgradeSession& _internal_session() const;
+  ::chat::UpgradeSession* _internal_mutable_session();
+  public:
+  void unsafe_arena_set_allocated_session(
+      ::chat::UpgradeSession* session);
+  ::chat::UpgradeSession* unsafe_arena_release_session();
+
+  // .chat.UpgradeDone done = 3;
+  bool has_done() const;
+  private:
+  bool _internal_has_done() const;
+  public:
+  void clear_done();
+  const ::chat::UpgradeDone& done() const;
+  PROTOBUF_NODISCARD ::chat::UpgradeDone* release_done();
+  ::chat::UpgradeDone* mutable_done();
+  void set_allocated_done(::chat::UpgradeDone* done);
+  private:
+  const ::chat::UpgradeDone& _internal_done() const;
+  ::chat::UpgradeDone* _internal_mutable_done();
+  public:
+  void unsafe_arena_set_allocated_done(
+      ::chat::UpgradeDone* done);
+  ::chat::UpgradeDone* unsafe_arena_release_done();
+
+  // bool request = 4;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  bool request() const;
+  void set_request(bool value);
+  private:
+  bool _internal_request() const;
+  void _internal_set_request(bool value);
+  public:
+
+  void clear_record();
+  RecordCase record_case() const;
+  // @@protoc_insertion_point(class_scope:chat.UpgradeRecord)
+ private:
+  class _Internal;
+  void set_has_listener();
+  void set_has_session();
+  void set_has_done();
+  void set_has_request();
+
+  inline bool has_record() const;
+  inline void clear_has_record();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union RecordUnion {
+      constexpr RecordUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      bool listener_;
+      ::chat::UpgradeSession* session_;
+      ::chat::UpgradeDone* done_;
+      bool request_;
+    } record_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceEntry) */ {
+ public:
+  inline PresenceEntry() : PresenceEntry(nullptr) {}
+  ~PresenceEntry() override;
+  explicit PROTOBUF_CONSTEXPR PresenceEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceEntry(const PresenceEntry& from);
+  PresenceEntry(PresenceEntry&& from) noexcept
+    : PresenceEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceEntry& operator=(const PresenceEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceEntry& operator=(PresenceEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceEntry* internal_default_instance() {
+    return reinterpret_cast<const PresenceEntry*>(
+               &_PresenceEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(PresenceEntry& a, PresenceEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceEntry& from) {
+    PresenceEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceEntry";
+  }
+  protected:
+  explicit PresenceEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kNodeFieldNumber = 2,
+    kVersionFieldNumber = 4,
+    kStatusFieldNumber = 3,
+    kRemovedFieldNumber = 5,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string node = 2;
+  void clear_node();
+  const std::string& node() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node();
+  PROTOBUF_NODISCARD std::string* release_node();
+  void set_allocated_node(std::string* node);
+  private:
+  const std::string& _internal_node() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node(const std::string& value);
+  std::string* _internal_mutable_node();
+  public:
+
+  // uint64 version = 4;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // .chat.UserStatus status = 3;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // bool removed = 5;
+  void clear_removed();
+  bool removed() const;
+  void set_removed(bool value);
+  private:
+  bool _internal_removed() const;
+  void _internal_set_removed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_;
+    uint64_t version_;
+    int status_;
+    bool removed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NodeVersion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.NodeVersion) */ {
+ public:
+  inline NodeVersion() : NodeVersion(nullptr) {}
+  ~NodeVersion() override;
+  explicit PROTOBUF_CONSTEXPR NodeVersion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NodeVersion(const NodeVersion& from);
+  NodeVersion(NodeVersion&& from) noexcept
+    : NodeVersion() {
+    *this = ::std::move(from);
+  }
+
+  inline NodeVersion& operator=(const NodeVersion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NodeVersion& operator=(NodeVersion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeVersion& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NodeVersion* internal_default_instance() {
+    return reinterpret_cast<const NodeVersion*>(
+               &_NodeVersion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(NodeVersion& a, NodeVersion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NodeVersion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeVersion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NodeVersion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NodeVersion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NodeVersion& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeVersion& from) {
+    NodeVersion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NodeVersion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.NodeVersion";
+  }
+  protected:
+  explicit NodeVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeFieldNumber = 1,
+    kIncarnationFieldNumber = 2,
+    kVersionFieldNumber = 3,
+    kReplaceFieldNumber = 4,
+  };
+  // string node = 1;
+  void clear_node();
+  const std::string& node() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node();
+  PROTOBUF_NODISCARD std::string* release_node();
+  void set_allocated_node(std::string* node);
+  private:
+  const std::string& _internal_node() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node(const std::string& value);
+  std::string* _internal_mutable_node();
+  public:
+
+  // uint64 incarnation = 2;
+  void clear_incarnation();
+  uint64_t incarnation() const;
+  void set_incarnation(uint64_t value);
+  private:
+  uint64_t _internal_incarnation() const;
+  void _internal_set_incarnation(uint64_t value);
+  public:
+
+  // uint64 version = 3;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // bool replace = 4;
+  void clear_replace();
+  bool replace() const;
+  void set_replace(bool value);
+  private:
+  bool _internal_replace() const;
+  void _internal_set_replace(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.NodeVersion)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_;
+    uint64_t incarnation_;
+    uint64_t version_;
+    bool replace_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ForwardedMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ForwardedMessage) */ {
+ public:
+  inline ForwardedMessage() : ForwardedMessage(nullptr) {}
+  ~ForwardedMessage() override;
+  explicit PROTOBUF_CONSTEXPR ForwardedMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ForwardedMessage(const ForwardedMessage& from);
+  ForwardedMessage(ForwardedMessage&& from) noexcept
+    : ForwardedMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ForwardedMessage& operator=(const ForwardedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ForwardedMessage& operator=(ForwardedMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ForwardedMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ForwardedMessage* internal_default_instance() {
+    return reinterpret_cast<const ForwardedMessage*>(
+               &_ForwardedMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(ForwardedMessage& a, ForwardedMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ForwardedMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ForwardedMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ForwardedMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ForwardedMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ForwardedMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ForwardedMessage& from) {
+    ForwardedMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ForwardedMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ForwardedMessage";
+  }
+  protected:
+  explicit ForwardedMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecipientFieldNumber = 1,
+    kSenderFieldNumber = 2,
+    kContentFieldNumber = 3,
+  };
+  // string recipient = 1;
+  void clear_recipient();
+  const std::string& recipient() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* recipient);
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
+  std::string* _internal_mutable_recipient();
+  public:
+
+  // string sender = 2;
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
+  private:
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
+  public:
+
+  // string content = 3;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ForwardedMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PeerBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PeerBatch) */ {
+ public:
+  inline PeerBatch() : PeerBatch(nullptr) {}
+  ~PeerBatch() override;
+  explicit PROTOBUF_CONSTEXPR PeerBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PeerBatch(const PeerBatch& from);
+  PeerBatch(PeerBatch&& from) noexcept
+    : PeerBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline PeerBatch& operator=(const PeerBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PeerBatch& operator=(PeerBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PeerBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerBatch* internal_default_instance() {
+    return reinterpret_cast<const PeerBatch*>(
+               &_PeerBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(PeerBatch& a, PeerBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PeerBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PeerBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PeerBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerBatch& from) {
+    PeerBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PeerBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PeerBatch";
+  }
+  protected:
+  explicit PeerBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPresenceFieldNumber = 3,
+    kMessagesFieldNumber = 4,
+    kDigestFieldNumber = 6,
+    kNodeFieldNumber = 1,
+    kSecretFieldNumber = 7,
+    kClockFieldNumber = 5,
+    kSnapshotFieldNumber = 2,
+  };
+  // repeated .chat.PresenceEntry presence = 3;
+  int presence_size() const;
+  private:
+  int _internal_presence_size() const;
+  public:
+  void clear_presence();
+  ::chat::PresenceEntry* mutable_presence(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >*
+      mutable_presence();
+  private:
+  const ::chat::PresenceEntry& _internal_presence(int index) const;
+  ::chat::PresenceEntry* _internal_add_presence();
+  public:
+  const ::chat::PresenceEntry& presence(int index) const;
+  ::chat::PresenceEntry* add_presence();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >&
+      presence() const;
+
+  // repeated .chat.ForwardedMessage messages = 4;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::chat::ForwardedMessage* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ForwardedMessage >*
+      mutable_messages();
+  private:
+  const ::chat::ForwardedMessage& _internal_messages(int index) const;
+  ::chat::ForwardedMessage* _internal_add_messages();
+  public:
+  const ::chat::ForwardedMessage& messages(int index) const;
+  ::chat::ForwardedMessage* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ForwardedMessage >&
+      messages() const;
+
+  // repeated .chat.NodeVersion digest = 6;
+  int digest_size() const;
+  private:
+  int _internal_digest_size() const;
+  public:
+  void clear_digest();
+  ::chat::NodeVersion* mutable_digest(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::NodeVersion >*
+      mutable_digest();
+  private:
+  const ::chat::NodeVersion& _internal_digest(int index) const;
+  ::chat::NodeVersion* _internal_add_digest();
+  public:
+  const ::chat::NodeVersion& digest(int index) const;
+  ::chat::NodeVersion* add_digest();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::NodeVersion >&
+      digest() const;
+
+  // string node = 1;
+  void clear_node();
+  const std::string& node() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node();
+  PROTOBUF_NODISCARD std::string* release_node();
+  void set_allocated_node(std::string* node);
+  private:
+  const std::string& _internal_node() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node(const std::string& value);
+  std::string* _internal_mutable_node();
+  public:
+
+  // string secret = 7;
+  void clear_secret();
+  const std::string& secret() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_secret(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_secret();
+  PROTOBUF_NODISCARD std::string* release_secret();
+  void set_allocated_secret(std::string* secret);
+  private:
+  const std::string& _internal_secret() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_secret(const std::string& value);
+  std::string* _internal_mutable_secret();
+  public:
+
+  // .chat.NodeVersion clock = 5;
+  bool has_clock() const;
+  private:
+  bool _internal_has_clock() const;
+  public:
+  void clear_clock();
+  const ::chat::NodeVersion& clock() const;
+  PROTOBUF_NODISCARD ::chat::NodeVersion* release_clock();
+  ::chat::NodeVersion* mutable_clock();
+  void set_allocated_clock(::chat::NodeVersion* clock);
+  private:
+  const ::chat::NodeVersion& _internal_clock() const;
+  ::chat::NodeVersion* _internal_mutable_clock();
+  public:
+  void unsafe_arena_set_allocated_clock(
+      ::chat::NodeVersion* clock);
+  ::chat::NodeVersion* unsafe_arena_release_clock();
+
+  // bool snapshot = 2;
+  void clear_snapshot();
+  bool snapshot() const;
+  void set_snapshot(bool value);
+  private:
+  bool _internal_snapshot() const;
+  void _internal_set_snapshot(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PeerBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry > presence_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ForwardedMessage > messages_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::NodeVersion > digest_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr secret_;
+    ::chat::NodeVersion* clock_;
+    bool snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GossipUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.GossipUpdate) */ {
+ public:
+  inline GossipUpdate() : GossipUpdate(nullptr) {}
+  ~GossipUpdate() override;
+  explicit PROTOBUF_CONSTEXPR GossipUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GossipUpdate(const GossipUpdate& from);
+  GossipUpdate(GossipUpdate&& from) noexcept
+    : GossipUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline GossipUpdate& operator=(const GossipUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GossipUpdate& operator=(GossipUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GossipUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GossipUpdate* internal_default_instance() {
+    return reinterpret_cast<const GossipUpdate*>(
+               &_GossipUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(GossipUpdate& a, GossipUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GossipUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GossipUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GossipUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GossipUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GossipUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GossipUpdate& from) {
+    GossipUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GossipUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.GossipUpdate";
+  }
+  protected:
+  explicit GossipUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 2,
+    kNodeFieldNumber = 1,
+  };
+  // repeated .chat.PresenceEntry entries = 2;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::chat::PresenceEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >*
+      mutable_entries();
+  private:
+  const ::chat::PresenceEntry& _internal_entries(int index) const;
+  ::chat::PresenceEntry* _internal_add_entries();
+  public:
+  const ::chat::PresenceEntry& entries(int index) const;
+  ::chat::PresenceEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >&
+      entries() const;
+
+  // .chat.NodeVersion node = 1;
+  bool has_node() const;
+  private:
+  bool _internal_has_node() const;
+  public:
+  void clear_node();
+  const ::chat::NodeVersion& node() const;
+  PROTOBUF_NODISCARD ::chat::NodeVersion* release_node();
+  ::chat::NodeVersion* mutable_node();
+  void set_allocated_node(::chat::NodeVersion* node);
+  private:
+  const ::chat::NodeVersion& _internal_node() const;
+  ::chat::NodeVersion* _internal_mutable_node();
+  public:
+  void unsafe_arena_set_allocated_node(
+      ::chat::NodeVersion* node);
+  ::chat::NodeVersion* unsafe_arena_release_node();
+
+  // @@protoc_insertion_point(class_scope:chat.GossipUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry > entries_;
+    ::chat::NodeVersion* node_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpdateStatusRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpdateStatusRequest) */ {
+ public:
+  inline UpdateStatusRequest() : UpdateStatusRequest(nullptr) {}
+  ~UpdateStatusRequest() override;
+  explicit PROTOBUF_CONSTEXPR UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpdateStatusRequest(const UpdateStatusRequest& from);
+  UpdateStatusRequest(UpdateStatusRequest&& from) noexcept
+    : UpdateStatusRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UpdateStatusRequest& operator=(const UpdateStatusRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpdateStatusRequest& operator=(UpdateStatusRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateStatusRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateStatusRequest* internal_default_instance() {
+    return reinterpret_cast<const UpdateStatusRequest*>(
+               &_UpdateStatusRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(UpdateStatusRequest& a, UpdateStatusRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpdateStatusRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateStatusRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpdateStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateStatusRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateStatusRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateStatusRequest& from) {
+    UpdateStatusRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpdateStatusRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UpdateStatusRequest";
+  }
+  protected:
+  explicit UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kNewStatusFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .chat.UserStatus new_status = 2;
+  void clear_new_status();
+  ::chat::UserStatus new_status() const;
+  void set_new_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_new_status() const;
+  void _internal_set_new_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UpdateStatusRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int new_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  enum PayloadCase {
+    kRegisterUser = 2,
+    kSendMessage = 3,
+    kUpdateStatus = 4,
+    kGetUsers = 5,
+    kUnregisterUser = 6,
+    kAck = 7,
+    kChannel = 8,
+    kSubscribePresence = 9,
+    kTransferStart = 10,
+    kTransferChunk = 11,
+    kPeerBatch = 12,
+    PAYLOAD_NOT_SET = 0,
+  };
+
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 1,
+    kRegisterUserFieldNumber = 2,
+    kSendMessageFieldNumber = 3,
+    kUpdateStatusFieldNumber = 4,
+    kGetUsersFieldNumber = 5,
+    kUnregisterUserFieldNumber = 6,
+    kAckFieldNumber = 7,
+    kChannelFieldNumber = 8,
+    kSubscribePresenceFieldNumber = 9,
+    kTransferStartFieldNumber = 10,
+    kTransferChunkFieldNumber = 11,
+    kPeerBatchFieldNumber = 12,
+  };
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.NewUserRequest register_user = 2;
+  bool has_register_user() const;
+  private:
+  bool _internal_has_register_user() const;
+  public:
+  void clear_register_user();
+  const ::chat::NewUserRequest& register_user() const;
+  PROTOBUF_NODISCARD ::chat::NewUserRequest* release_register_user();
+  ::chat::NewUserRequest* mutable_register_user();
+  void set_allocated_register_user(::chat::NewUserRequest* register_user);
+  private:
+  const ::chat::NewUserRequest& _internal_register_user() const;
+  ::chat::NewUserRequest* _internal_mutable_register_user();
+  public:
+  void unsafe_arena_set_allocated_register_user(
+      ::chat::NewUserRequest* register_user);
+  ::chat::NewUserRequest* unsafe_arena_release_register_user();
+
+  // .chat.SendMessageRequest send_message = 3;
+  bool has_send_message() const;
+  private:
+  bool _internal_has_send_message() const;
+  public:
+  void clear_send_message();
+  const ::chat::SendMessageRequest& send_message() const;
+  PROTOBUF_NODISCARD ::chat::SendMessageRequest* release_send_message();
+  ::chat::SendMessageRequest* mutable_send_message();
+  void set_allocated_send_message(::chat::SendMessageRequest* send_message);
+  private:
+  const ::chat::SendMessageRequest& _internal_send_message() const;
+  ::chat::SendMessageRequest* _internal_mutable_send_message();
+  public:
+  void unsafe_arena_set_allocated_send_message(
+      ::chat::SendMessageRequest* send_message);
+  ::chat::SendMessageRequest* unsafe_arena_release_send_message();
+
+  // .chat.UpdateStatusRequest update_status = 4;
+  bool has_update_status() const;
+  private:
+  bool _internal_has_update_status() const;
+  public:
+  void clear_update_status();
+  const ::chat::UpdateStatusRequest& update_status() const;
+  PROTOBUF_NODISCARD ::chat::UpdateStatusRequest* release_update_status();
+  ::chat::UpdateStatusRequest* mutable_update_status();
+  void set_allocated_update_status(::chat::UpdateStatusRequest* update_status);
+  private:
+  const ::chat::UpdateStatusRequest& _internal_update_status() const;
+  ::chat::UpdateStatusRequest* _internal_mutable_update_status();
+  public:
+  void unsafe_arena_set_allocated_update_status(
+      ::chat::UpdateStatusRequest* update_status);
+  ::chat::UpdateStatusRequest* unsafe_arena_release_update_status();
+
+  // .chat.UserListRequest get_users = 5;
+  bool has_get_users() const;
+  private:
+  bool _internal_has_get_users() const;
+  public:
+  void clear_get_users();
+  const ::chat::UserListRequest& get_users() const;
+  PROTOBUF_NODISCARD ::chat::UserListRequest* release_get_users();
+  ::chat::UserListRequest* mutable_get_users();
+  void set_allocated_get_users(::chat::UserListRequest* get_users);
+  private:
+  const ::chat::UserListRequest& _internal_get_users() const;
+  ::chat::UserListRequest* _internal_mutable_get_users();
+  public:
+  void unsafe_arena_set_allocated_get_users(
+      ::chat::UserListRequest* get_users);
+  ::chat::UserListRequest* unsafe_arena_release_get_users();
+
+  // .chat.User unregister_user = 6;
+  bool has_unregister_user() const;
+  private:
+  bool _internal_has_unregister_user() const;
+  public:
+  void clear_unregister_user();
+  const ::chat::User& unregister_user() const;
+  PROTOBUF_NODISCARD ::chat::User* release_unregister_user();
+  ::chat::User* mutable_unregister_user();
+  void set_allocated_unregister_user(::chat::User* unregister_user);
+  private:
+  const ::chat::User& _internal_unregister_user() const;
+  ::chat::User* _internal_mutable_unregister_user();
+  public:
+  void unsafe_arena_set_allocated_unregister_user(
+      ::chat::User* unregister_user);
+  ::chat::User* unsafe_arena_release_unregister_user();
+
+  // .chat.AckRequest ack = 7;
+  bool has_ack() const;
+  private:
+  bool _internal_has_ack() const;
+  public:
+  void clear_ack();
+  const ::chat::AckRequest& ack() const;
+  PROTOBUF_NODISCARD ::chat::AckRequest* release_ack();
+  ::chat::AckRequest* mutable_ack();
+  void set_allocated_ack(::chat::AckRequest* ack);
+  private:
+  const ::chat::AckRequest& _internal_ack() const;
+  ::chat::AckRequest* _internal_mutable_ack();
+  public:
+  void unsafe_arena_set_allocated_ack(
+      ::chat::AckRequest* ack);
+  ::chat::AckRequest* unsafe_arena_release_ack();
+
+  // .chat.ChannelRequest channel = 8;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::chat::ChannelRequest& channel() const;
+  PROTOBUF_NODISCARD ::chat::ChannelRequest* release_channel();
+  ::chat::ChannelRequest* mutable_channel();
+  void set_allocated_channel(::chat::ChannelRequest* channel);
+  private:
+  const ::chat::ChannelRequest& _internal_channel() const;
+  ::chat::ChannelRequest* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::chat::ChannelRequest* channel);
+  ::chat::ChannelRequest* unsafe_arena_release_channel();
+
+  // .chat.PresenceSubscribeRequest subscribe_presence = 9;
+  bool has_subscribe_presence() const;
+  private:
+  bool _internal_has_subscribe_presence() const;
+  public:
+  void clear_subscribe_presence();
+  const ::chat::PresenceSubscribeRequest& subscribe_presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceSubscribeRequest* release_subscribe_presence();
+  ::chat::PresenceSubscribeRequest* mutable_subscribe_presence();
+  void set_allocated_subscribe_presence(::chat::PresenceSubscribeRequest* subscribe_presence);
+  private:
+  const ::chat::PresenceSubscribeRequest& _internal_subscribe_presence() const;
+  ::chat::PresenceSubscribeRequest* _internal_mutable_subscribe_presence();
+  public:
+  void unsafe_arena_set_allocated_subscribe_presence(
+      ::chat::PresenceSubscribeRequest* subscribe_presence);
+  ::chat::PresenceSubscribeRequest* unsafe_arena_release_subscribe_presence();
+
+  // .chat.TransferStart transfer_start = 10;
+  bool has_transfer_start() const;
+  private:
+  bool _internal_has_transfer_start() const;
+  public:
+  void clear_transfer_start();
+  const ::chat::TransferStart& transfer_start() const;
+  PROTOBUF_NODISCARD ::chat::TransferStart* release_transfer_start();
+  ::chat::TransferStart* mutable_transfer_start();
+  void set_allocated_transfer_start(::chat::TransferStart* transfer_start);
+  private:
+  const ::chat::TransferStart& _internal_transfer_start() const;
+  ::chat::TransferStart* _internal_mutable_transfer_start();
+  public:
+  void unsafe_arena_set_allocated_transfer_start(
+      ::chat::TransferStart* transfer_start);
+  ::chat::TransferStart* unsafe_arena_release_transfer_start();
+
+  // .chat.TransferChunk transfer_chunk = 11;
+  bool has_transfer_chunk() const;
+  private:
+  bool _internal_has_transfer_chunk() const;
+  public:
+  void clear_transfer_chunk();
+  const ::chat::TransferChunk& transfer_chunk() const;
+  PROTOBUF_NODISCARD ::chat::TransferChunk* release_transfer_chunk();
+  ::chat::TransferChunk* mutable_transfer_chunk();
+  void set_allocated_transfer_chunk(::chat::TransferChunk* transfer_chunk);
+  private:
+  const ::chat::TransferChunk& _internal_transfer_chunk() const;
+  ::chat::TransferChunk* _internal_mutable_transfer_chunk();
+  public:
+  void unsafe_arena_set_allocated_transfer_chunk(
+      ::chat::TransferChunk* transfer_chunk);
+  ::chat::TransferChunk* unsafe_arena_release_transfer_chunk();
+
+  // .chat.PeerBatch peer_batch = 12;
+  bool has_peer_batch() const;
+  private:
+  bool _internal_has_peer_batch() const;
+  public:
+  void clear_peer_batch();
+  const ::chat::PeerBatch& peer_batch() const;
+  PROTOBUF_NODISCARD ::chat::PeerBatch* release_peer_batch();
+  ::chat::PeerBatch* mutable_peer_batch();
+  void set_allocated_peer_batch(::chat::PeerBatch* peer_batch);
+  private:
+  const ::chat::PeerBatch& _internal_peer_batch() const;
+  ::chat::PeerBatch* _internal_mutable_peer_batch();
+  public:
+  void unsafe_arena_set_allocated_peer_batch(
+      ::chat::PeerBatch* peer_batch);
+  ::chat::PeerBatch* unsafe_arena_release_peer_batch();
+
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Request)
+ private:
+  class _Internal;
+  void set_has_register_user();
+  void set_has_send_message();
+  void set_has_update_status();
+  void set_has_get_users();
+  void set_has_unregister_user();
+  void set_has_ack();
+  void set_has_channel();
+  void set_has_subscribe_presence();
+  void set_has_transfer_start();
+  void set_has_transfer_chunk();
+  void set_has_peer_batch();
+
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int operation_;
+    union PayloadUnion {
+      constexpr PayloadUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::NewUserRequest* register_user_;
+      ::chat::SendMessageRequest* send_message_;
+      ::chat::UpdateStatusRequest* update_status_;
+      ::chat::UserListRequest* get_users_;
+      ::chat::User* unregister_user_;
+      ::chat::AckRequest* ack_;
+      ::chat::ChannelRequest* channel_;
+      ::chat::PresenceSubscribeRequest* subscribe_presence_;
+      ::chat::TransferStart* transfer_start_;
+      ::chat::TransferChunk* transfer_chunk_;
+      ::chat::PeerBatch* peer_batch_;
+    } payload_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Response) */ {
+ public:
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ResultCase {
+    kUserList = 4,
+    kIncomingMessage = 5,
+    kDeliveryReceipt = 6,
+    kPresence = 8,
+    kTransferStart = 10,
+    kTransferChunk = 11,
+    kTransferCredit = 12,
+    kServerShutdown = 13,
+    kGossip = 15,
+    RESULT_NOT_SET = 0,
+  };
+
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 3,
+    kRedirectFieldNumber = 14,
+    kOperationFieldNumber = 1,
+    kStatusCodeFieldNumber = 2,
+    kMessageIdFieldNumber = 7,
+    kCodecFieldNumber = 9,
+    kUserListFieldNumber = 4,
+    kIncomingMessageFieldNumber = 5,
+    kDeliveryReceiptFieldNumber = 6,
+    kPresenceFieldNumber = 8,
+    kTransferStartFieldNumber = 10,
+    kTransferChunkFieldNumber = 11,
+    kTransferCreditFieldNumber = 12,
+    kServerShutdownFieldNumber = 13,
+    kGossipFieldNumber = 15,
+  };
+  // string message = 3;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // string redirect = 14;
+  void clear_redirect();
+  const std::string& redirect() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_redirect(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_redirect();
+  PROTOBUF_NODISCARD std::string* release_redirect();
+  void set_allocated_redirect(std::string* redirect);
+  private:
+  const std::string& _internal_redirect() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_redirect(const std::string& value);
+  std::string* _internal_mutable_redirect();
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.StatusCode status_code = 2;
+  void clear_status_code();
+  ::chat::StatusCode status_code() const;
+  void set_status_code(::chat::StatusCode value);
+  private:
+  ::chat::StatusCode _internal_status_code() const;
+  void _internal_set_status_code(::chat::StatusCode value);
+  public:
+
+  // uint64 message_id = 7;
+  void clear_message_id();
+  uint64_t message_id() const;
+  void set_message_id(uint64_t value);
+  private:
+  uint64_t _internal_message_id() const;
+  void _internal_set_message_id(uint64_t value);
+  public:
+
+  // .chat.Codec codec = 9;
+  void clear_codec();
+  ::chat::Codec codec() const;
+  void set_codec(::chat::Codec value);
+  private:
+  ::chat::Codec _internal_codec() const;
+  void _internal_set_codec(::chat::Codec value);
+  public:
+
+  // .chat.UserListResponse user_list = 4;
+  bool has_user_list() const;
+  private:
+  bool _internal_has_user_list() const;
+  public:
+  void clear_user_list();
+  const ::chat::UserListResponse& user_list() const;
+  PROTOBUF_NODISCARD ::chat::UserListResponse* release_user_list();
+  ::chat::UserListResponse* mutable_user_list();
+  void set_allocated_user_list(::chat::UserListResponse* user_list);
+  private:
+  const ::chat::UserListResponse& _internal_user_list() const;
+  ::chat::UserListResponse* _internal_mutable_user_list();
+  public:
+  void unsafe_arena_set_allocated_user_list(
+      ::chat::UserListResponse* user_list);
+  ::chat::UserListResponse* unsafe_arena_release_user_list();
+
+  // .chat.IncomingMessageResponse incoming_message = 5;
+  bool has_incoming_message() const;
+  private:
+  bool _internal_has_incoming_message() const;
+  public:
+  void clear_incoming_message();
+  const ::chat::IncomingMessageResponse& incoming_message() const;
+  PROTOBUF_NODISCARD ::chat::IncomingMessageResponse* release_incoming_message();
+  ::chat::IncomingMessageResponse* mutable_incoming_message();
+  void set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message);
+  private:
+  const ::chat::IncomingMessageResponse& _internal_incoming_message() const;
+  ::chat::IncomingMessageResponse* _internal_mutable_incoming_message();
+  public:
+  void unsafe_arena_set_allocated_incoming_message(
+      ::chat::IncomingMessageResponse* incoming_message);
+  ::chat::IncomingMessageResponse* unsafe_arena_release_incoming_message();
+
+  // .chat.DeliveryReceipt delivery_receipt = 6;
+  bool has_delivery_receipt() const;
+  private:
+  bool _internal_has_delivery_receipt() const;
+  public:
+  void clear_delivery_receipt();
+  const ::chat::DeliveryReceipt& delivery_receipt() const;
+  PROTOBUF_NODISCARD ::chat::DeliveryReceipt* release_delivery_receipt();
+  ::chat::DeliveryReceipt* mutable_delivery_receipt();
+  void set_allocated_delivery_receipt(::chat::DeliveryReceipt* delivery_receipt);
+  private:
+  const ::chat::DeliveryReceipt& _internal_delivery_receipt() const;
+  ::chat::DeliveryReceipt* _internal_mutable_delivery_receipt();
+  public:
+  void unsafe_arena_set_allocated_delivery_receipt(
+      ::chat::DeliveryReceipt* delivery_receipt);
+  ::chat::DeliveryReceipt* unsafe_arena_release_delivery_receipt();
+
+  // .chat.PresenceUpdate presence = 8;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  const ::chat::PresenceUpdate& presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceUpdate* release_presence();
+  ::chat::PresenceUpdate* mutable_presence();
+  void set_allocated_presence(::chat::PresenceUpdate* presence);
+  private:
+  const ::chat::PresenceUpdate& _internal_presence() const;
+  ::chat::PresenceUpdate* _internal_mutable_presence();
+  public:
+  void unsafe_arena_set_allocated_presence(
+      ::chat::PresenceUpdate* presence);
+  ::chat::PresenceUpdate* unsafe_arena_release_presence();
+
+  // .chat.TransferStart transfer_start = 10;
+  bool has_transfer_start() const;
+  private:
+  bool _internal_has_transfer_start() const;
+  public:
+  void clear_transfer_start();
+  const ::chat::TransferStart& transfer_start() const;
+  PROTOBUF_NODISCARD ::chat::TransferStart* release_transfer_start();
+  ::chat::TransferStart* mutable_transfer_start();
+  void set_allocated_transfer_start(::chat::TransferStart* transfer_start);
+  private:
+  const ::chat::TransferStart& _internal_transfer_start() const;
+  ::chat::TransferStart* _internal_mutable_transfer_start();
+  public:
+  void unsafe_arena_set_allocated_transfer_start(
+      ::chat::TransferStart* transfer_start);
+  ::chat::TransferStart* unsafe_arena_release_transfer_start();
+
+  // .chat.TransferChunk transfer_chunk = 11;
+  bool has_transfer_chunk() const;
+  private:
+  bool _internal_has_transfer_chunk() const;
+  public:
+  void clear_transfer_chunk();
+  const ::chat::TransferChunk& transfer_chunk() const;
+  PROTOBUF_NODISCARD ::chat::TransferChunk* release_transfer_chunk();
+  ::chat::TransferChunk* mutable_transfer_chunk();
+  void set_allocated_transfer_chunk(::chat::TransferChunk* transfer_chunk);
+  private:
+  const ::chat::TransferChunk& _internal_transfer_chunk() const;
+  ::chat::TransferChunk* _internal_mutable_transfer_chunk();
+  public:
+  void unsafe_arena_set_allocated_transfer_chunk(
+      ::chat::TransferChunk* transfer_chunk);
+  ::chat::TransferChunk* unsafe_arena_release_transfer_chunk();
+
+  // .chat.TransferCredit transfer_credit = 12;
+  bool has_transfer_credit() const;
+  private:
+  bool _internal_has_transfer_credit() const;
+  public:
+  void clear_transfer_credit();
+  const ::chat::TransferCredit& transfer_credit() const;
+  PROTOBUF_NODISCARD ::chat::TransferCredit* release_transfer_credit();
+  ::chat::TransferCredit* mutable_transfer_credit();
+  void set_allocated_transfer_credit(::chat::TransferCredit* transfer_credit);
+  private:
+  const ::chat::TransferCredit& _internal_transfer_credit() const;
+  ::chat::TransferCredit* _internal_mutable_transfer_credit();
+  public:
+  void unsafe_arena_set_allocated_transfer_credit(
+      ::chat::TransferCredit* transfer_credit);
+  ::chat::TransferCredit* unsafe_arena_release_transfer_credit();
+
+  // .chat.ServerShutdown server_shutdown = 13;
+  bool has_server_shutdown() const;
+  private:
+  bool _internal_has_server_shutdown() const;
+  public:
+  void clear_server_shutdown();
+  const ::chat::ServerShutdown& server_shutdown() const;
+  PROTOBUF_NODISCARD ::chat::ServerShutdown* release_server_shutdown();
+  ::chat::ServerShutdown* mutable_server_shutdown();
+  void set_allocated_server_shutdown(::chat::ServerShutdown* server_shutdown);
+  private:
+  const ::chat::ServerShutdown& _internal_server_shutdown() const;
+  ::chat::ServerShutdown* _internal_mutable_server_shutdown();
+  public:
+  void unsafe_arena_set_allocated_server_shutdown(
+      ::chat::ServerShutdown* server_shutdown);
+  ::chat::ServerShutdown* unsafe_arena_release_server_shutdown();
+
+  // .chat.GossipUpdate gossip = 15;
+  bool has_gossip() const;
+  private:
+  bool _internal_has_gossip() const;
+  public:
+  void clear_gossip();
+  const ::chat::GossipUpdate& gossip() const;
+  PROTOBUF_NODISCARD ::chat::GossipUpdate* release_gossip();
+  ::chat::GossipUpdate* mutable_gossip();
+  void set_allocated_gossip(::chat::GossipUpdate* gossip);
+  private:
+  const ::chat::GossipUpdate& _internal_gossip() const;
+  ::chat::GossipUpdate* _internal_mutable_gossip();
+  public:
+  void unsafe_arena_set_allocated_gossip(
+      ::chat::GossipUpdate* gossip);
+  ::chat::GossipUpdate* unsafe_arena_release_gossip();
+
+  void clear_result();
+  ResultCase result_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Response)
+ private:
+  class _Internal;
+  void set_has_user_list();
+  void set_has_incoming_message();
+  void set_has_delivery_receipt();
+  void set_has_presence();
+  void set_has_transfer_start();
+  void set_has_transfer_chunk();
+  void set_has_transfer_credit();
+  void set_has_server_shutdown();
+  void set_has_gossip();
+
+  inline bool has_result() const;
+  inline void clear_has_result();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr redirect_;
+    int operation_;
+    int status_code_;
+    uint64_t message_id_;
+    int codec_;
+    union ResultUnion {
+      constexpr ResultUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::UserListResponse* user_list_;
+      ::chat::IncomingMessageResponse* incoming_message_;
+      ::chat::DeliveryReceipt* delivery_receipt_;
+      ::chat::PresenceUpdate* presence_;
+      ::chat::TransferStart* transfer_start_;
+      ::chat::TransferChunk* transfer_chunk_;
+      ::chat::TransferCredit* transfer_credit_;
+      ::chat::ServerShutdown* server_shutdown_;
+      ::chat::GossipUpdate* gossip_;
+    } result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// User
+
+// string username = 1;
+inline void User::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& User::username() const {
+  // @@protoc_insertion_point(field_get:chat.User.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.User.username)
+}
+inline std::string* User::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.User.username)
+  return _s;
+}
+inline const std::string& User::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void User::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_username() {
+  // @@protoc_insertion_point(field_release:chat.User.username)
+  return _impl_.username_.Release();
+}
+inline void User::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.User.username)
+}
+
+// .chat.UserStatus status = 2;
+inline void User::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus User::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus User::status() const {
+  // @@protoc_insertion_point(field_get:chat.User.status)
+  return _internal_status();
+}
+inline void User::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void User::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.User.status)
+}
+
+// -------------------------------------------------------------------
+
+// NewUserRequest
+
+// string username = 1;
+inline void NewUserRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& NewUserRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewUserRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.username)
+}
+inline std::string* NewUserRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.NewUserRequest.username)
+  return _s;
+}
+inline const std::string& NewUserRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void NewUserRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.NewUserRequest.username)
+  return _impl_.username_.Release();
+}
+inline void NewUserRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.NewUserRequest.username)
+}
+
+// bool ack_mode = 2;
+inline void NewUserRequest::clear_ack_mode() {
+  _impl_.ack_mode_ = false;
+}
+inline bool NewUserRequest::_internal_ack_mode() const {
+  return _impl_.ack_mode_;
+}
+inline bool NewUserRequest::ack_mode() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.ack_mode)
+  return _internal_ack_mode();
+}
+inline void NewUserRequest::_internal_set_ack_mode(bool value) {
+  
+  _impl_.ack_mode_ = value;
+}
+inline void NewUserRequest::set_ack_mode(bool value) {
+  _internal_set_ack_mode(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.ack_mode)
+}
+
+// repeated .chat.Codec codecs = 3;
+inline int NewUserRequest::_internal_codecs_size() const {
+  return _impl_.codecs_.size();
+}
+inline int NewUserRequest::codecs_size() const {
+  return _internal_codecs_size();
+}
+inline void NewUserRequest::clear_codecs() {
+  _impl_.codecs_.Clear();
+}
+inline ::chat::Codec NewUserRequest::_internal_codecs(int index) const {
+  return static_cast< ::chat::Codec >(_impl_.codecs_.Get(index));
+}
+inline ::chat::Codec NewUserRequest::codecs(int index) const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.codecs)
+  return _internal_codecs(index);
+}
+inline void NewUserRequest::set_codecs(int index, ::chat::Codec value) {
+  _impl_.codecs_.Set(index, value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.codecs)
+}
+inline void NewUserRequest::_internal_add_codecs(::chat::Codec value) {
+  _impl_.codecs_.Add(value);
+}
+inline void NewUserRequest::add_codecs(::chat::Codec value) {
+  _internal_add_codecs(value);
+  // @@protoc_insertion_point(field_add:chat.NewUserRequest.codecs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+NewUserRequest::codecs() const {
+  // @@protoc_insertion_point(field_list:chat.NewUserRequest.codecs)
+  return _impl_.codecs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+NewUserRequest::_internal_mutable_codecs() {
+  return &_impl_.codecs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+NewUserRequest::mutable_codecs() {
+  // @@protoc_insertion_point(field_mutable_list:chat.NewUserRequest.codecs)
+  return _internal_mutable_codecs();
+}
+
+// -------------------------------------------------------------------
+
+// SendMessageRequest
+
+// string recipient = 1;
+inline void SendMessageRequest::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient)
+}
+inline std::string* SendMessageRequest::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.recipient)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void SendMessageRequest::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void SendMessageRequest::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.recipient)
+}
+
+// string content = 2;
+inline void SendMessageRequest::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::content() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.content)
+}
+inline std::string* SendMessageRequest::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.content)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SendMessageRequest::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_content() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.content)
+  return _impl_.content_.Release();
+}
+inline void SendMessageRequest::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.content)
+}
+
+// string channel = 3;
+inline void SendMessageRequest::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::channel() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.channel)
+}
+inline std::string* SendMessageRequest::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.channel)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void SendMessageRequest::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.channel)
+  return _impl_.channel_.Release();
+}
+inline void SendMessageRequest::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.channel)
+}
+
+// -------------------------------------------------------------------
+
+// IncomingMessageResponse
+
+// string sender = 1;
+inline void IncomingMessageResponse::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::sender() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender)
+}
+inline std::string* IncomingMessageResponse::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.sender)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.sender)
+  return _impl_.sender_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.sender)
+}
+
+// string content = 2;
+inline void IncomingMessageResponse::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::content() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.content)
+}
+inline std::string* IncomingMessageResponse::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.content)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_content() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.content)
+  return _impl_.content_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.content)
+}
+
+// .chat.MessageType type = 3;
+inline void IncomingMessageResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::MessageType IncomingMessageResponse::_internal_type() const {
+  return static_cast< ::chat::MessageType >(_impl_.type_);
+}
+inline ::chat::MessageType IncomingMessageResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.type)
+  return _internal_type();
+}
+inline void IncomingMessageResponse::_internal_set_type(::chat::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void IncomingMessageResponse::set_type(::chat::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.type)
+}
+
+// uint64 message_id = 4;
+inline void IncomingMessageResponse::clear_message_id() {
+  _impl_.message_id_ = uint64_t{0u};
+}
+inline uint64_t IncomingMessageResponse::_internal_message_id() const {
+  return _impl_.message_id_;
+}
+inline uint64_t IncomingMessageResponse::message_id() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.message_id)
+  return _internal_message_id();
+}
+inline void IncomingMessageResponse::_internal_set_message_id(uint64_t value) {
+  
+  _impl_.message_id_ = value;
+}
+inline void IncomingMessageResponse::set_message_id(uint64_t value) {
+  _internal_set_message_id(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.message_id)
+}
+
+// string channel = 5;
+inline void IncomingMessageResponse::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::channel() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.channel)
+}
+inline std::string* IncomingMessageResponse::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.channel)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.channel)
+  return _impl_.channel_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.channel)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelRequest
+
+// string channel = 1;
+inline void ChannelRequest::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& ChannelRequest::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelRequest.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelRequest::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelRequest.channel)
+}
+inline std::string* ChannelRequest::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelRequest.channel)
+  return _s;
+}
+inline const std::string& ChannelRequest::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelRequest::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelRequest::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelRequest::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelRequest.channel)
+  return _impl_.channel_.Release();
+}
+inline void ChannelRequest::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelRequest.channel)
+}
+
+// -------------------------------------------------------------------
+
+// AckRequest
+
+// repeated uint64 message_ids = 1;
+inline int AckRequest::_internal_message_ids_size() const {
+  return _impl_.message_ids_.size();
+}
+inline int AckRequest::message_ids_size() const {
+  return _internal_message_ids_size();
+}
+inline void AckRequest::clear_message_ids() {
+  _impl_.message_ids_.Clear();
+}
+inline uint64_t AckRequest::_internal_message_ids(int index) const {
+  return _impl_.message_ids_.Get(index);
+}
+inline uint64_t AckRequest::message_ids(int index) const {
+  // @@protoc_insertion_point(field_get:chat.AckRequest.message_ids)
+  return _internal_message_ids(index);
+}
+inline void AckRequest::set_message_ids(int index, uint64_t value) {
+  _impl_.message_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:chat.AckRequest.message_ids)
+}
+inline void AckRequest::_internal_add_message_ids(uint64_t value) {
+  _impl_.message_ids_.Add(value);
+}
+inline void AckRequest::add_message_ids(uint64_t value) {
+  _internal_add_message_ids(value);
+  // @@protoc_insertion_point(field_add:chat.AckRequest.message_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+AckRequest::_internal_message_ids() const {
+  return _impl_.message_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+AckRequest::message_ids() const {
+  // @@protoc_insertion_point(field_list:chat.AckRequest.message_ids)
+  return _internal_message_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+AckRequest::_internal_mutable_message_ids() {
+  return &_impl_.message_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+AckRequest::mutable_message_ids() {
+  // @@protoc_insertion_point(field_mutable_list:chat.AckRequest.message_ids)
+  return _internal_mutable_message_ids();
+}
+
+// -------------------------------------------------------------------
+
+// DeliveryReceipt
+
+// uint64 delivered_through = 1;
+inline void DeliveryReceipt::clear_delivered_through() {
+  _impl_.delivered_through_ = uint64_t{0u};
+}
+inline uint64_t DeliveryReceipt::_internal_delivered_through() const {
+  return _impl_.delivered_through_;
+}
+inline uint64_t DeliveryReceipt::delivered_through() const {
+  // @@protoc_insertion_point(field_get:chat.DeliveryReceipt.delivered_through)
+  return _internal_delivered_through();
+}
+inline void DeliveryReceipt::_internal_set_delivered_through(uint64_t value) {
+  
+  _impl_.delivered_through_ = value;
+}
+inline void DeliveryReceipt::set_delivered_through(uint64_t value) {
+  _internal_set_delivered_through(value);
+  // @@protoc_insertion_point(field_set:chat.DeliveryReceipt.delivered_through)
+}
+
+// -------------------------------------------------------------------
+
+// UserListRequest
+
+// string username = 1;
+inline void UserListRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.username)
+}
+inline std::string* UserListRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.username)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UserListRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UserListRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.username)
+}
+
+// string cursor = 2;
+inline void UserListRequest::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::cursor() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.cursor)
+}
+inline std::string* UserListRequest::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.cursor)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void UserListRequest::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_cursor() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void UserListRequest::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.cursor)
+}
+
+// string prefix = 3;
+inline void UserListRequest::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::prefix() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.prefix)
+}
+inline std::string* UserListRequest::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.prefix)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void UserListRequest::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_prefix() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.prefix)
+  return _impl_.prefix_.Release();
+}
+inline void UserListRequest::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.prefix)
+}
+
+// bool filter_status = 4;
+inline void UserListRequest::clear_filter_status() {
+  _impl_.filter_status_ = false;
+}
+inline bool UserListRequest::_internal_filter_status() const {
+  return _impl_.filter_status_;
+}
+inline bool UserListRequest::filter_status() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.filter_status)
+  return _internal_filter_status();
+}
+inline void UserListRequest::_internal_set_filter_status(bool value) {
+  
+  _impl_.filter_status_ = value;
+}
+inline void UserListRequest::set_filter_status(bool value) {
+  _internal_set_filter_status(value);
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.filter_status)
+}
+
+// .chat.UserStatus status = 5;
+inline void UserListRequest::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus UserListRequest::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus UserListRequest::status() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.status)
+  return _internal_status();
+}
+inline void UserListRequest::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void UserListRequest::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.status)
+}
+
+// uint32 limit = 6;
+inline void UserListRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t UserListRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t UserListRequest::limit() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.limit)
+  return _internal_limit();
+}
+inline void UserListRequest::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void UserListRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// UserListResponse
+
+// repeated .chat.User users = 1;
+inline int UserListResponse::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int UserListResponse::users_size() const {
+  return _internal_users_size();
+}
+inline void UserListResponse::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::chat::User* UserListResponse::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+UserListResponse::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:chat.UserListResponse.users)
+  return &_impl_.users_;
+}
+inline const ::chat::User& UserListResponse::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::chat::User& UserListResponse::users(int index) const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.users)
+  return _internal_users(index);
+}
+inline ::chat::User* UserListResponse::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::chat::User* UserListResponse::add_users() {
+  ::chat::User* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:chat.UserListResponse.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+UserListResponse::users() const {
+  // @@protoc_insertion_point(field_list:chat.UserListResponse.users)
+  return _impl_.users_;
+}
+
+// .chat.UserListType type = 2;
+inline void UserListResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::UserListType UserListResponse::_internal_type() const {
+  return static_cast< ::chat::UserListType >(_impl_.type_);
+}
+inline ::chat::UserListType UserListResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.type)
+  return _internal_type();
+}
+inline void UserListResponse::_internal_set_type(::chat::UserListType value) {
+  
+  _impl_.type_ = value;
+}
+inline void UserListResponse::set_type(::chat::UserListType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.type)
+}
+
+// string next_cursor = 3;
+inline void UserListResponse::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+}
+inline const std::string& UserListResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListResponse::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.next_cursor)
+}
+inline std::string* UserListResponse::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.next_cursor)
+  return _s;
+}
+inline const std::string& UserListResponse::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void UserListResponse::_internal_set_next_cursor(const std::string& value) {
+  
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListResponse::_internal_mutable_next_cursor() {
+  
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListResponse::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:chat.UserListResponse.next_cursor)
+  return _impl_.next_cursor_.Release();
+}
+inline void UserListResponse::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListResponse.next_cursor)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceSubscribeRequest
+
+// bool unsubscribe = 1;
+inline void PresenceSubscribeRequest::clear_unsubscribe() {
+  _impl_.unsubscribe_ = false;
+}
+inline bool PresenceSubscribeRequest::_internal_unsubscribe() const {
+  return _impl_.unsubscribe_;
+}
+inline bool PresenceSubscribeRequest::unsubscribe() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceSubscribeRequest.unsubscribe)
+  return _internal_unsubscribe();
+}
+inline void PresenceSubscribeRequest::_internal_set_unsubscribe(bool value) {
+  
+  _impl_.unsubscribe_ = value;
+}
+inline void PresenceSubscribeRequest::set_unsubscribe(bool value) {
+  _internal_set_unsubscribe(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceSubscribeRequest.unsubscribe)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceDelta
+
+// .chat.PresenceEvent event = 1;
+inline void PresenceDelta::clear_event() {
+  _impl_.event_ = 0;
+}
+inline ::chat::PresenceEvent PresenceDelta::_internal_event() const {
+  return static_cast< ::chat::PresenceEvent >(_impl_.event_);
+}
+inline ::chat::PresenceEvent PresenceDelta::event() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDelta.event)
+  return _internal_event();
+}
+inline void PresenceDelta::_internal_set_event(::chat::PresenceEvent value) {
+  
+  _impl_.event_ = value;
+}
+inline void PresenceDelta::set_event(::chat::PresenceEvent value) {
+  _internal_set_event(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceDelta.event)
+}
+
+// .chat.User user = 2;
+inline bool PresenceDelta::_internal_has_user() const {
+  return this != internal_default_instance() && _impl_.user_ != nullptr;
+}
+inline bool PresenceDelta::has_user() const {
+  return _internal_has_user();
+}
+inline void PresenceDelta::clear_user() {
+  if (GetArenaForAllocation() == nullptr && _impl_.user_ != nullptr) {
+    delete _impl_.user_;
+  }
+  _impl_.user_ = nullptr;
+}
+inline const ::chat::User& PresenceDelta::_internal_user() const {
+  const ::chat::User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::User&>(
+      ::chat::_User_default_instance_);
+}
+inline const ::chat::User& PresenceDelta::user() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDelta.user)
+  return _internal_user();
+}
+inline void PresenceDelta::unsafe_arena_set_allocated_user(
+    ::chat::User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.PresenceDelta.user)
+}
+inline ::chat::User* PresenceDelta::release_user() {
+  
+  ::chat::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::User* PresenceDelta::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:chat.PresenceDelta.user)
+  
+  ::chat::User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::chat::User* PresenceDelta::_internal_mutable_user() {
+  
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::chat::User* PresenceDelta::mutable_user() {
+  ::chat::User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceDelta.user)
+  return _msg;
+}
+inline void PresenceDelta::set_allocated_user(::chat::User* user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
+  if (user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceDelta.user)
+}
+
+// uint64 version = 3;
+inline void PresenceDelta::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PresenceDelta::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceDelta::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceDelta.version)
+  return _internal_version();
+}
+inline void PresenceDelta::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PresenceDelta::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceDelta.version)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceUpdate
+
+// uint64 version = 1;
+inline void PresenceUpdate::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PresenceUpdate::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceUpdate::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.version)
+  return _internal_version();
+}
+inline void PresenceUpdate::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PresenceUpdate::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.version)
+}
+
+// bool snapshot = 2;
+inline void PresenceUpdate::clear_snapshot() {
+  _impl_.snapshot_ = false;
+}
+inline bool PresenceUpdate::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline bool PresenceUpdate::snapshot() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.snapshot)
+  return _internal_snapshot();
+}
+inline void PresenceUpdate::_internal_set_snapshot(bool value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void PresenceUpdate::set_snapshot(bool value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.snapshot)
+}
+
+// repeated .chat.PresenceDelta deltas = 3;
+inline int PresenceUpdate::_internal_deltas_size() const {
+  return _impl_.deltas_.size();
+}
+inline int PresenceUpdate::deltas_size() const {
+  return _internal_deltas_size();
+}
+inline void PresenceUpdate::clear_deltas() {
+  _impl_.deltas_.Clear();
+}
+inline ::chat::PresenceDelta* PresenceUpdate::mutable_deltas(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PresenceUpdate.deltas)
+  return _impl_.deltas_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >*
+PresenceUpdate::mutable_deltas() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PresenceUpdate.deltas)
+  return &_impl_.deltas_;
+}
+inline const ::chat::PresenceDelta& PresenceUpdate::_internal_deltas(int index) const {
+  return _impl_.deltas_.Get(index);
+}
+inline const ::chat::PresenceDelta& PresenceUpdate::deltas(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.deltas)
+  return _internal_deltas(index);
+}
+inline ::chat::PresenceDelta* PresenceUpdate::_internal_add_deltas() {
+  return _impl_.deltas_.Add();
+}
+inline ::chat::PresenceDelta* PresenceUpdate::add_deltas() {
+  ::chat::PresenceDelta* _add = _internal_add_deltas();
+  // @@protoc_insertion_point(field_add:chat.PresenceUpdate.deltas)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceDelta >&
+PresenceUpdate::deltas() const {
+  // @@protoc_insertion_point(field_list:chat.PresenceUpdate.deltas)
+  return _impl_.deltas_;
+}
+
+// -------------------------------------------------------------------
+
+// TransferStart
+
+// uint64 transfer_id = 1;
+inline void TransferStart::clear_transfer_id() {
+  _impl_.transfer_id_ = uint64_t{0u};
+}
+inline uint64_t TransferStart::_internal_transfer_id() const {
+  return _impl_.transfer_id_;
+}
+inline uint64_t TransferStart::transfer_id() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.transfer_id)
+  return _internal_transfer_id();
+}
+inline void TransferStart::_internal_set_transfer_id(uint64_t value) {
+  
+  _impl_.transfer_id_ = value;
+}
+inline void TransferStart::set_transfer_id(uint64_t value) {
+  _internal_set_transfer_id(value);
+  // @@protoc_insertion_point(field_set:chat.TransferStart.transfer_id)
+}
+
+// string recipient = 2;
+inline void TransferStart::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& TransferStart::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferStart::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.TransferStart.recipient)
+}
+inline std::string* TransferStart::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.TransferStart.recipient)
+  return _s;
+}
+inline const std::string& TransferStart::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void TransferStart::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferStart::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferStart::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.TransferStart.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void TransferStart::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.TransferStart.recipient)
+}
+
+// string channel = 3;
+inline void TransferStart::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& TransferStart::channel() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferStart::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.TransferStart.channel)
+}
+inline std::string* TransferStart::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.TransferStart.channel)
+  return _s;
+}
+inline const std::string& TransferStart::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void TransferStart::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferStart::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferStart::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.TransferStart.channel)
+  return _impl_.channel_.Release();
+}
+inline void TransferStart::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.TransferStart.channel)
+}
+
+// string name = 4;
+inline void TransferStart::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& TransferStart::name() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferStart::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.TransferStart.name)
+}
+inline std::string* TransferStart::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.TransferStart.name)
+  return _s;
+}
+inline const std::string& TransferStart::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TransferStart::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferStart::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferStart::release_name() {
+  // @@protoc_insertion_point(field_release:chat.TransferStart.name)
+  return _impl_.name_.Release();
+}
+inline void TransferStart::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.TransferStart.name)
+}
+
+// uint64 total_size = 5;
+inline void TransferStart::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
+}
+inline uint64_t TransferStart::_internal_total_size() const {
+  return _impl_.total_size_;
+}
+inline uint64_t TransferStart::total_size() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.total_size)
+  return _internal_total_size();
+}
+inline void TransferStart::_internal_set_total_size(uint64_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void TransferStart::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:chat.TransferStart.total_size)
+}
+
+// string sender = 6;
+inline void TransferStart::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& TransferStart::sender() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferStart::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.TransferStart.sender)
+}
+inline std::string* TransferStart::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.TransferStart.sender)
+  return _s;
+}
+inline const std::string& TransferStart::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void TransferStart::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferStart::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferStart::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.TransferStart.sender)
+  return _impl_.sender_.Release();
+}
+inline void TransferStart::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.TransferStart.sender)
+}
+
+// .chat.MessageType type = 7;
+inline void TransferStart::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::MessageType TransferStart::_internal_type() const {
+  return static_cast< ::chat::MessageType >(_impl_.type_);
+}
+inline ::chat::MessageType TransferStart::type() const {
+  // @@protoc_insertion_point(field_get:chat.TransferStart.type)
+  return _internal_type();
+}
+inline void TransferStart::_internal_set_type(::chat::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void TransferStart::set_type(::chat::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.TransferStart.type)
+}
+
+// -------------------------------------------------------------------
+
+// TransferChunk
+
+// uint64 transfer_id = 1;
+inline void TransferChunk::clear_transfer_id() {
+  _impl_.transfer_id_ = uint64_t{0u};
+}
+inline uint64_t TransferChunk::_internal_transfer_id() const {
+  return _impl_.transfer_id_;
+}
+inline uint64_t TransferChunk::transfer_id() const {
+  // @@protoc_insertion_point(field_get:chat.TransferChunk.transfer_id)
+  return _internal_transfer_id();
+}
+inline void TransferChunk::_internal_set_transfer_id(uint64_t value) {
+  
+  _impl_.transfer_id_ = value;
+}
+inline void TransferChunk::set_transfer_id(uint64_t value) {
+  _internal_set_transfer_id(value);
+  // @@protoc_insertion_point(field_set:chat.TransferChunk.transfer_id)
+}
+
+// uint32 sequence = 2;
+inline void TransferChunk::clear_sequence() {
+  _impl_.sequence_ = 0u;
+}
+inline uint32_t TransferChunk::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint32_t TransferChunk::sequence() const {
+  // @@protoc_insertion_point(field_get:chat.TransferChunk.sequence)
+  return _internal_sequence();
+}
+inline void TransferChunk::_internal_set_sequence(uint32_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void TransferChunk::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:chat.TransferChunk.sequence)
+}
+
+// bytes data = 3;
+inline void TransferChunk::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& TransferChunk::data() const {
+  // @@protoc_insertion_point(field_get:chat.TransferChunk.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferChunk::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.TransferChunk.data)
+}
+inline std::string* TransferChunk::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:chat.TransferChunk.data)
+  return _s;
+}
+inline const std::string& TransferChunk::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void TransferChunk::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TransferChunk::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TransferChunk::release_data() {
+  // @@protoc_insertion_point(field_release:chat.TransferChunk.data)
+  return _impl_.data_.Release();
+}
+inline void TransferChunk::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.TransferChunk.data)
+}
+
+// bool last = 4;
+inline void TransferChunk::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool TransferChunk::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool TransferChunk::last() const {
+  // @@protoc_insertion_point(field_get:chat.TransferChunk.last)
+  return _internal_last();
+}
+inline void TransferChunk::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void TransferChunk::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:chat.TransferChunk.last)
+}
+
+// -------------------------------------------------------------------
+
+// TransferCredit
+
+// uint64 transfer_id = 1;
+inline void TransferCredit::clear_transfer_id() {
+  _impl_.transfer_id_ = uint64_t{0u};
+}
+inline uint64_t TransferCredit::_internal_transfer_id() const {
+  return _impl_.transfer_id_;
+}
+inline uint64_t TransferCredit::transfer_id() const {
+  // @@protoc_insertion_point(field_get:chat.TransferCredit.transfer_id)
+  return _internal_transfer_id();
+}
+inline void TransferCredit::_internal_set_transfer_id(uint64_t value) {
+  
+  _impl_.transfer_id_ = value;
+}
+inline void TransferCredit::set_transfer_id(uint64_t value) {
+  _internal_set_transfer_id(value);
+  // @@protoc_insertion_point(field_set:chat.TransferCredit.transfer_id)
+}
+
+// uint32 chunks = 2;
+inline void TransferCredit::clear_chunks() {
+  _impl_.chunks_ = 0u;
+}
+inline uint32_t TransferCredit::_internal_chunks() const {
+  return _impl_.chunks_;
+}
+inline uint32_t TransferCredit::chunks() const {
+  // @@protoc_insertion_point(field_get:chat.TransferCredit.chunks)
+  return _internal_chunks();
+}
+inline void TransferCredit::_internal_set_chunks(uint32_t value) {
+  
+  _impl_.chunks_ = value;
+}
+inline void TransferCredit::set_chunks(uint32_t value) {
+  _internal_set_chunks(value);
+  // @@protoc_insertion_point(field_set:chat.TransferCredit.chunks)
+}
+
+// -------------------------------------------------------------------
+
+// ServerShutdown
+
+// uint32 reconnect_after_ms = 1;
+inline void ServerShutdown::clear_reconnect_after_ms() {
+  _impl_.reconnect_after_ms_ = 0u;
+}
+inline uint32_t ServerShutdown::_internal_reconnect_after_ms() const {
+  return _impl_.reconnect_after_ms_;
+}
+inline uint32_t ServerShutdown::reconnect_after_ms() const {
+  // @@protoc_insertion_point(field_get:chat.ServerShutdown.reconnect_after_ms)
+  return _internal_reconnect_after_ms();
+}
+inline void ServerShutdown::_internal_set_reconnect_after_ms(uint32_t value) {
+  
+  _impl_.reconnect_after_ms_ = value;
+}
+inline void ServerShutdown::set_reconnect_after_ms(uint32_t value) {
+  _internal_set_reconnect_after_ms(value);
+  // @@protoc_insertion_point(field_set:chat.ServerShutdown.reconnect_after_ms)
+}
+
+// -------------------------------------------------------------------
+
+// UpgradeSession
+
+// string username = 1;
+inline void UpgradeSession::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UpgradeSession::username() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpgradeSession::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.username)
+}
+inline std::string* UpgradeSession::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UpgradeSession.username)
+  return _s;
+}
+inline const std::string& UpgradeSession::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UpgradeSession::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpgradeSession::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpgradeSession::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UpgradeSession.username)
+  return _impl_.username_.Release();
+}
+inline void UpgradeSession::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpgradeSession.username)
+}
+
+// .chat.UserStatus status = 2;
+inline void UpgradeSession::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus UpgradeSession::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus UpgradeSession::status() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.status)
+  return _internal_status();
+}
+inline void UpgradeSession::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void UpgradeSession::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.status)
+}
+
+// bool ack_mode = 3;
+inline void UpgradeSession::clear_ack_mode() {
+  _impl_.ack_mode_ = false;
+}
+inline bool UpgradeSession::_internal_ack_mode() const {
+  return _impl_.ack_mode_;
+}
+inline bool UpgradeSession::ack_mode() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.ack_mode)
+  return _internal_ack_mode();
+}
+inline void UpgradeSession::_internal_set_ack_mode(bool value) {
+  
+  _impl_.ack_mode_ = value;
+}
+inline void UpgradeSession::set_ack_mode(bool value) {
+  _internal_set_ack_mode(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.ack_mode)
+}
+
+// .chat.Codec codec = 4;
+inline void UpgradeSession::clear_codec() {
+  _impl_.codec_ = 0;
+}
+inline ::chat::Codec UpgradeSession::_internal_codec() const {
+  return static_cast< ::chat::Codec >(_impl_.codec_);
+}
+inline ::chat::Codec UpgradeSession::codec() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.codec)
+  return _internal_codec();
+}
+inline void UpgradeSession::_internal_set_codec(::chat::Codec value) {
+  
+  _impl_.codec_ = value;
+}
+inline void UpgradeSession::set_codec(::chat::Codec value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.codec)
+}
+
+// bool presence = 5;
+inline void UpgradeSession::clear_presence() {
+  _impl_.presence_ = false;
+}
+inline bool UpgradeSession::_internal_presence() const {
+  return _impl_.presence_;
+}
+inline bool UpgradeSession::presence() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.presence)
+  return _internal_presence();
+}
+inline void UpgradeSession::_internal_set_presence(bool value) {
+  
+  _impl_.presence_ = value;
+}
+inline void UpgradeSession::set_presence(bool value) {
+  _internal_set_presence(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.presence)
+}
+
+// repeated string channels = 6;
+inline int UpgradeSession::_internal_channels_size() const {
+  return _impl_.channels_.size();
+}
+inline int UpgradeSession::channels_size() const {
+  return _internal_channels_size();
+}
+inline void UpgradeSession::clear_channels() {
+  _impl_.channels_.Clear();
+}
+inline std::string* UpgradeSession::add_channels() {
+  std::string* _s = _internal_add_channels();
+  // @@protoc_insertion_point(field_add_mutable:chat.UpgradeSession.channels)
+  return _s;
+}
+inline const std::string& UpgradeSession::_internal_channels(int index) const {
+  return _impl_.channels_.Get(index);
+}
+inline const std::string& UpgradeSession::channels(int index) const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.channels)
+  return _internal_channels(index);
+}
+inline std::string* UpgradeSession::mutable_channels(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.UpgradeSession.channels)
+  return _impl_.channels_.Mutable(index);
+}
+inline void UpgradeSession::set_channels(int index, const std::string& value) {
+  _impl_.channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.channels)
+}
+inline void UpgradeSession::set_channels(int index, std::string&& value) {
+  _impl_.channels_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.channels)
+}
+inline void UpgradeSession::set_channels(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chat.UpgradeSession.channels)
+}
+inline void UpgradeSession::set_channels(int index, const char* value, size_t size) {
+  _impl_.channels_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chat.UpgradeSession.channels)
+}
+inline std::string* UpgradeSession::_internal_add_channels() {
+  return _impl_.channels_.Add();
+}
+inline void UpgradeSession::add_channels(const std::string& value) {
+  _impl_.channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chat.UpgradeSession.channels)
+}
+inline void UpgradeSession::add_channels(std::string&& value) {
+  _impl_.channels_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chat.UpgradeSession.channels)
+}
+inline void UpgradeSession::add_channels(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chat.UpgradeSession.channels)
+}
+inline void UpgradeSession::add_channels(const char* value, size_t size) {
+  _impl_.channels_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chat.UpgradeSession.channels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UpgradeSession::channels() const {
+  // @@protoc_insertion_point(field_list:chat.UpgradeSession.channels)
+  return _impl_.channels_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UpgradeSession::mutable_channels() {
+  // @@protoc_insertion_point(field_mutable_list:chat.UpgradeSession.channels)
+  return &_impl_.channels_;
+}
+
+// uint32 pending_input = 7;
+inline void UpgradeSession::clear_pending_input() {
+  _impl_.pending_input_ = 0u;
+}
+inline uint32_t UpgradeSession::_internal_pending_input() const {
+  return _impl_.pending_input_;
+}
+inline uint32_t UpgradeSession::pending_input() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.pending_input)
+  return _internal_pending_input();
+}
+inline void UpgradeSession::_internal_set_pending_input(uint32_t value) {
+  
+  _impl_.pending_input_ = value;
+}
+inline void UpgradeSession::set_pending_input(uint32_t value) {
+  _internal_set_pending_input(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.pending_input)
+}
+
+// string ip = 8;
+inline void UpgradeSession::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+}
+inline const std::string& UpgradeSession::ip() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpgradeSession::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.ip)
+}
+inline std::string* UpgradeSession::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:chat.UpgradeSession.ip)
+  return _s;
+}
+inline const std::string& UpgradeSession::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void UpgradeSession::_internal_set_ip(const std::string& value) {
+  
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpgradeSession::_internal_mutable_ip() {
+  
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpgradeSession::release_ip() {
+  // @@protoc_insertion_point(field_release:chat.UpgradeSession.ip)
+  return _impl_.ip_.Release();
+}
+inline void UpgradeSession::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpgradeSession.ip)
+}
+
+// string peer_node = 9;
+inline void UpgradeSession::clear_peer_node() {
+  _impl_.peer_node_.ClearToEmpty();
+}
+inline const std::string& UpgradeSession::peer_node() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.peer_node)
+  return _internal_peer_node();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpgradeSession::set_peer_node(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.peer_node_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.peer_node)
+}
+inline std::string* UpgradeSession::mutable_peer_node() {
+  std::string* _s = _internal_mutable_peer_node();
+  // @@protoc_insertion_point(field_mutable:chat.UpgradeSession.peer_node)
+  return _s;
+}
+inline const std::string& UpgradeSession::_internal_peer_node() const {
+  return _impl_.peer_node_.Get();
+}
+inline void UpgradeSession::_internal_set_peer_node(const std::string& value) {
+  
+  _impl_.peer_node_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpgradeSession::_internal_mutable_peer_node() {
+  
+  return _impl_.peer_node_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpgradeSession::release_peer_node() {
+  // @@protoc_insertion_point(field_release:chat.UpgradeSession.peer_node)
+  return _impl_.peer_node_.Release();
+}
+inline void UpgradeSession::set_allocated_peer_node(std::string* peer_node) {
+  if (peer_node != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.peer_node_.SetAllocated(peer_node, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.peer_node_.IsDefault()) {
+    _impl_.peer_node_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpgradeSession.peer_node)
+}
+
+// bool shared_memory = 10;
+inline void UpgradeSession::clear_shared_memory() {
+  _impl_.shared_memory_ = false;
+}
+inline bool UpgradeSession::_internal_shared_memory() const {
+  return _impl_.shared_memory_;
+}
+inline bool UpgradeSession::shared_memory() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeSession.shared_memory)
+  return _internal_shared_memory();
+}
+inline void UpgradeSession::_internal_set_shared_memory(bool value) {
+  
+  _impl_.shared_memory_ = value;
+}
+inline void UpgradeSession::set_shared_memory(bool value) {
+  _internal_set_shared_memory(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeSession.shared_memory)
+}
+
+// -------------------------------------------------------------------
+
+// UpgradeDone
+
+// uint64 registry_version = 1;
+inline void UpgradeDone::clear_registry_version() {
+  _impl_.registry_version_ = uint64_t{0u};
+}
+inline uint64_t UpgradeDone::_internal_registry_version() const {
+  return _impl_.registry_version_;
+}
+inline uint64_t UpgradeDone::registry_version() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeDone.registry_version)
+  return _internal_registry_version();
+}
+inline void UpgradeDone::_internal_set_registry_version(uint64_t value) {
+  
+  _impl_.registry_version_ = value;
+}
+inline void UpgradeDone::set_registry_version(uint64_t value) {
+  _internal_set_registry_version(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeDone.registry_version)
+}
+
+// uint64 incarnation = 2;
+inline void UpgradeDone::clear_incarnation() {
+  _impl_.incarnation_ = uint64_t{0u};
+}
+inline uint64_t UpgradeDone::_internal_incarnation() const {
+  return _impl_.incarnation_;
+}
+inline uint64_t UpgradeDone::incarnation() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeDone.incarnation)
+  return _internal_incarnation();
+}
+inline void UpgradeDone::_internal_set_incarnation(uint64_t value) {
+  
+  _impl_.incarnation_ = value;
+}
+inline void UpgradeDone::set_incarnation(uint64_t value) {
+  _internal_set_incarnation(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeDone.incarnation)
+}
+
+// -------------------------------------------------------------------
+
+// UpgradeRecord
+
+// bool listener = 1;
+inline bool UpgradeRecord::_internal_has_listener() const {
+  return record_case() == kListener;
+}
+inline bool UpgradeRecord::has_listener() const {
+  return _internal_has_listener();
+}
+inline void UpgradeRecord::set_has_listener() {
+  _impl_._oneof_case_[0] = kListener;
+}
+inline void UpgradeRecord::clear_listener() {
+  if (_internal_has_listener()) {
+    _impl_.record_.listener_ = false;
+    clear_has_record();
+  }
+}
+inline bool UpgradeRecord::_internal_listener() const {
+  if (_internal_has_listener()) {
+    return _impl_.record_.listener_;
+  }
+  return false;
+}
+inline void UpgradeRecord::_internal_set_listener(bool value) {
+  if (!_internal_has_listener()) {
+    clear_record();
+    set_has_listener();
+  }
+  _impl_.record_.listener_ = value;
+}
+inline bool UpgradeRecord::listener() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeRecord.listener)
+  return _internal_listener();
+}
+inline void UpgradeRecord::set_listener(bool value) {
+  _internal_set_listener(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeRecord.listener)
+}
+
+// .chat.UpgradeSession session = 2;
+inline bool UpgradeRecord::_internal_has_session() const {
+  return record_case() == kSession;
+}
+inline bool UpgradeRecord::has_session() const {
+  return _internal_has_session();
+}
+inline void UpgradeRecord::set_has_session() {
+  _impl_._oneof_case_[0] = kSession;
+}
+inline void UpgradeRecord::clear_session() {
+  if (_internal_has_session()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.record_.session_;
+    }
+    clear_has_record();
+  }
+}
+inline ::chat::UpgradeSession* UpgradeRecord::release_session() {
+  // @@protoc_insertion_point(field_release:chat.UpgradeRecord.session)
+  if (_internal_has_session()) {
+    clear_has_record();
+    ::chat::UpgradeSession* temp = _impl_.record_.session_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.record_.session_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UpgradeSession& UpgradeRecord::_internal_session() const {
+  return _internal_has_session()
+      ? *_impl_.record_.session_
+      : reinterpret_cast< ::chat::UpgradeSession&>(::chat::_UpgradeSession_default_instance_);
+}
+inline const ::chat::UpgradeSession& UpgradeRecord::session() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeRecord.session)
+  return _internal_session();
+}
+inline ::chat::UpgradeSession* UpgradeRecord::unsafe_arena_release_session() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.UpgradeRecord.session)
+  if (_internal_has_session()) {
+    clear_has_record();
+    ::chat::UpgradeSession* temp = _impl_.record_.session_;
+    _impl_.record_.session_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void UpgradeRecord::unsafe_arena_set_allocated_session(::chat::UpgradeSession* session) {
+  clear_record();
+  if (session) {
+    set_has_session();
+    _impl_.record_.session_ = session;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.UpgradeRecord.session)
+}
+inline ::chat::UpgradeSession* UpgradeRecord::_internal_mutable_session() {
+  if (!_internal_has_session()) {
+    clear_record();
+    set_has_session();
+    _impl_.record_.session_ = CreateMaybeMessage< ::chat::UpgradeSession >(GetArenaForAllocation());
+  }
+  return _impl_.record_.session_;
+}
+inline ::chat::UpgradeSession* UpgradeRecord::mutable_session() {
+  ::chat::UpgradeSession* _msg = _internal_mutable_session();
+  // @@protoc_insertion_point(field_mutable:chat.UpgradeRecord.session)
+  return _msg;
+}
+
+// .chat.UpgradeDone done = 3;
+inline bool UpgradeRecord::_internal_has_done() const {
+  return record_case() == kDone;
+}
+inline bool UpgradeRecord::has_done() const {
+  return _internal_has_done();
+}
+inline void UpgradeRecord::set_has_done() {
+  _impl_._oneof_case_[0] = kDone;
+}
+inline void UpgradeRecord::clear_done() {
+  if (_internal_has_done()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.record_.done_;
+    }
+    clear_has_record();
+  }
+}
+inline ::chat::UpgradeDone* UpgradeRecord::release_done() {
+  // @@protoc_insertion_point(field_release:chat.UpgradeRecord.done)
+  if (_internal_has_done()) {
+    clear_has_record();
+    ::chat::UpgradeDone* temp = _impl_.record_.done_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.record_.done_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UpgradeDone& UpgradeRecord::_internal_done() const {
+  return _internal_has_done()
+      ? *_impl_.record_.done_
+      : reinterpret_cast< ::chat::UpgradeDone&>(::chat::_UpgradeDone_default_instance_);
+}
+inline const ::chat::UpgradeDone& UpgradeRecord::done() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeRecord.done)
+  return _internal_done();
+}
+inline ::chat::UpgradeDone* UpgradeRecord::unsafe_arena_release_done() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.UpgradeRecord.done)
+  if (_internal_has_done()) {
+    clear_has_record();
+    ::chat::UpgradeDone* temp = _impl_.record_.done_;
+    _impl_.record_.done_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void UpgradeRecord::unsafe_arena_set_allocated_done(::chat::UpgradeDone* done) {
+  clear_record();
+  if (done) {
+    set_has_done();
+    _impl_.record_.done_ = done;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.UpgradeRecord.done)
+}
+inline ::chat::UpgradeDone* UpgradeRecord::_internal_mutable_done() {
+  if (!_internal_has_done()) {
+    clear_record();
+    set_has_done();
+    _impl_.record_.done_ = CreateMaybeMessage< ::chat::UpgradeDone >(GetArenaForAllocation());
+  }
+  return _impl_.record_.done_;
+}
+inline ::chat::UpgradeDone* UpgradeRecord::mutable_done() {
+  ::chat::UpgradeDone* _msg = _internal_mutable_done();
+  // @@protoc_insertion_point(field_mutable:chat.UpgradeRecord.done)
+  return _msg;
+}
+
+// bool request = 4;
+inline bool UpgradeRecord::_internal_has_request() const {
+  return record_case() == kRequest;
+}
+inline bool UpgradeRecord::has_request() const {
+  return _internal_has_request();
+}
+inline void UpgradeRecord::set_has_request() {
+  _impl_._oneof_case_[0] = kRequest;
+}
+inline void UpgradeRecord::clear_request() {
+  if (_internal_has_request()) {
+    _impl_.record_.request_ = false;
+    clear_has_record();
+  }
+}
+inline bool UpgradeRecord::_internal_request() const {
+  if (_internal_has_request()) {
+    return _impl_.record_.request_;
+  }
+  return false;
+}
+inline void UpgradeRecord::_internal_set_request(bool value) {
+  if (!_internal_has_request()) {
+    clear_record();
+    set_has_request();
+  }
+  _impl_.record_.request_ = value;
+}
+inline bool UpgradeRecord::request() const {
+  // @@protoc_insertion_point(field_get:chat.UpgradeRecord.request)
+  return _internal_request();
+}
+inline void UpgradeRecord::set_request(bool value) {
+  _internal_set_request(value);
+  // @@protoc_insertion_point(field_set:chat.UpgradeRecord.request)
+}
+
+inline bool UpgradeRecord::has_record() const {
+  return record_case() != RECORD_NOT_SET;
+}
+inline void UpgradeRecord::clear_has_record() {
+  _impl_._oneof_case_[0] = RECORD_NOT_SET;
+}
+inline UpgradeRecord::RecordCase UpgradeRecord::record_case() const {
+  return UpgradeRecord::RecordCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// PresenceEntry
+
+// string username = 1;
+inline void PresenceEntry::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& PresenceEntry::username() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEntry.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PresenceEntry::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PresenceEntry.username)
+}
+inline std::string* PresenceEntry::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceEntry.username)
+  return _s;
+}
+inline const std::string& PresenceEntry::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PresenceEntry::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PresenceEntry::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PresenceEntry::release_username() {
+  // @@protoc_insertion_point(field_release:chat.PresenceEntry.username)
+  return _impl_.username_.Release();
+}
+inline void PresenceEntry::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceEntry.username)
+}
+
+// string node = 2;
+inline void PresenceEntry::clear_node() {
+  _impl_.node_.ClearToEmpty();
+}
+inline const std::string& PresenceEntry::node() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEntry.node)
+  return _internal_node();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PresenceEntry::set_node(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PresenceEntry.node)
+}
+inline std::string* PresenceEntry::mutable_node() {
+  std::string* _s = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceEntry.node)
+  return _s;
+}
+inline const std::string& PresenceEntry::_internal_node() const {
+  return _impl_.node_.Get();
+}
+inline void PresenceEntry::_internal_set_node(const std::string& value) {
+  
+  _impl_.node_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PresenceEntry::_internal_mutable_node() {
+  
+  return _impl_.node_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PresenceEntry::release_node() {
+  // @@protoc_insertion_point(field_release:chat.PresenceEntry.node)
+  return _impl_.node_.Release();
+}
+inline void PresenceEntry::set_allocated_node(std::string* node) {
+  if (node != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_.SetAllocated(node, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_.IsDefault()) {
+    _impl_.node_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceEntry.node)
+}
+
+// .chat.UserStatus status = 3;
+inline void PresenceEntry::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus PresenceEntry::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus PresenceEntry::status() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEntry.status)
+  return _internal_status();
+}
+inline void PresenceEntry::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void PresenceEntry::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEntry.status)
+}
+
+// uint64 version = 4;
+inline void PresenceEntry::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PresenceEntry::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceEntry::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEntry.version)
+  return _internal_version();
+}
+inline void PresenceEntry::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PresenceEntry::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEntry.version)
+}
+
+// bool removed = 5;
+inline void PresenceEntry::clear_removed() {
+  _impl_.removed_ = false;
+}
+inline bool PresenceEntry::_internal_removed() const {
+  return _impl_.removed_;
+}
+inline bool PresenceEntry::removed() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEntry.removed)
+  return _internal_removed();
+}
+inline void PresenceEntry::_internal_set_removed(bool value) {
+  
+  _impl_.removed_ = value;
+}
+inline void PresenceEntry::set_removed(bool value) {
+  _internal_set_removed(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEntry.removed)
+}
+
+// -------------------------------------------------------------------
+
+// NodeVersion
+
+// string node = 1;
+inline void NodeVersion::clear_node() {
+  _impl_.node_.ClearToEmpty();
+}
+inline const std::string& NodeVersion::node() const {
+  // @@protoc_insertion_point(field_get:chat.NodeVersion.node)
+  return _internal_node();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeVersion::set_node(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.NodeVersion.node)
+}
+inline std::string* NodeVersion::mutable_node() {
+  std::string* _s = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:chat.NodeVersion.node)
+  return _s;
+}
+inline const std::string& NodeVersion::_internal_node() const {
+  return _impl_.node_.Get();
+}
+inline void NodeVersion::_internal_set_node(const std::string& value) {
+  
+  _impl_.node_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NodeVersion::_internal_mutable_node() {
+  
+  return _impl_.node_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NodeVersion::release_node() {
+  // @@protoc_insertion_point(field_release:chat.NodeVersion.node)
+  return _impl_.node_.Release();
+}
+inline void NodeVersion::set_allocated_node(std::string* node) {
+  if (node != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_.SetAllocated(node, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_.IsDefault()) {
+    _impl_.node_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.NodeVersion.node)
+}
+
+// uint64 incarnation = 2;
+inline void NodeVersion::clear_incarnation() {
+  _impl_.incarnation_ = uint64_t{0u};
+}
+inline uint64_t NodeVersion::_internal_incarnation() const {
+  return _impl_.incarnation_;
+}
+inline uint64_t NodeVersion::incarnation() const {
+  // @@protoc_insertion_point(field_get:chat.NodeVersion.incarnation)
+  return _internal_incarnation();
+}
+inline void NodeVersion::_internal_set_incarnation(uint64_t value) {
+  
+  _impl_.incarnation_ = value;
+}
+inline void NodeVersion::set_incarnation(uint64_t value) {
+  _internal_set_incarnation(value);
+  // @@protoc_insertion_point(field_set:chat.NodeVersion.incarnation)
+}
+
+// uint64 version = 3;
+inline void NodeVersion::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t NodeVersion::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t NodeVersion::version() const {
+  // @@protoc_insertion_point(field_get:chat.NodeVersion.version)
+  return _internal_version();
+}
+inline void NodeVersion::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void NodeVersion::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.NodeVersion.version)
+}
+
+// bool replace = 4;
+inline void NodeVersion::clear_replace() {
+  _impl_.replace_ = false;
+}
+inline bool NodeVersion::_internal_replace() const {
+  return _impl_.replace_;
+}
+inline bool NodeVersion::replace() const {
+  // @@protoc_insertion_point(field_get:chat.NodeVersion.replace)
+  return _internal_replace();
+}
+inline void NodeVersion::_internal_set_replace(bool value) {
+  
+  _impl_.replace_ = value;
+}
+inline void NodeVersion::set_replace(bool value) {
+  _internal_set_replace(value);
+  // @@protoc_insertion_point(field_set:chat.NodeVersion.replace)
+}
+
+// -------------------------------------------------------------------
+
+// ForwardedMessage
+
+// string recipient = 1;
+inline void ForwardedMessage::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& ForwardedMessage::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.ForwardedMessage.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ForwardedMessage::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ForwardedMessage.recipient)
+}
+inline std::string* ForwardedMessage::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.ForwardedMessage.recipient)
+  return _s;
+}
+inline const std::string& ForwardedMessage::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void ForwardedMessage::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ForwardedMessage::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ForwardedMessage::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.ForwardedMessage.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void ForwardedMessage::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ForwardedMessage.recipient)
+}
+
+// string sender = 2;
+inline void ForwardedMessage::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& ForwardedMessage::sender() const {
+  // @@protoc_insertion_point(field_get:chat.ForwardedMessage.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ForwardedMessage::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ForwardedMessage.sender)
+}
+inline std::string* ForwardedMessage::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.ForwardedMessage.sender)
+  return _s;
+}
+inline const std::string& ForwardedMessage::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void ForwardedMessage::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ForwardedMessage::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ForwardedMessage::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.ForwardedMessage.sender)
+  return _impl_.sender_.Release();
+}
+inline void ForwardedMessage::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ForwardedMessage.sender)
+}
+
+// string content = 3;
+inline void ForwardedMessage::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& ForwardedMessage::content() const {
+  // @@protoc_insertion_point(field_get:chat.ForwardedMessage.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ForwardedMessage::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ForwardedMessage.content)
+}
+inline std::string* ForwardedMessage::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.ForwardedMessage.content)
+  return _s;
+}
+inline const std::string& ForwardedMessage::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ForwardedMessage::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ForwardedMessage::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ForwardedMessage::release_content() {
+  // @@protoc_insertion_point(field_release:chat.ForwardedMessage.content)
+  return _impl_.content_.Release();
+}
+inline void ForwardedMessage::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ForwardedMessage.content)
+}
+
+// -------------------------------------------------------------------
+
+// PeerBatch
+
+// string node = 1;
+inline void PeerBatch::clear_node() {
+  _impl_.node_.ClearToEmpty();
+}
+inline const std::string& PeerBatch::node() const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.node)
+  return _internal_node();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerBatch::set_node(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PeerBatch.node)
+}
+inline std::string* PeerBatch::mutable_node() {
+  std::string* _s = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:chat.PeerBatch.node)
+  return _s;
+}
+inline const std::string& PeerBatch::_internal_node() const {
+  return _impl_.node_.Get();
+}
+inline void PeerBatch::_internal_set_node(const std::string& value) {
+  
+  _impl_.node_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerBatch::_internal_mutable_node() {
+  
+  return _impl_.node_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerBatch::release_node() {
+  // @@protoc_insertion_point(field_release:chat.PeerBatch.node)
+  return _impl_.node_.Release();
+}
+inline void PeerBatch::set_allocated_node(std::string* node) {
+  if (node != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_.SetAllocated(node, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_.IsDefault()) {
+    _impl_.node_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerBatch.node)
+}
+
+// bool snapshot = 2;
+inline void PeerBatch::clear_snapshot() {
+  _impl_.snapshot_ = false;
+}
+inline bool PeerBatch::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline bool PeerBatch::snapshot() const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.snapshot)
+  return _internal_snapshot();
+}
+inline void PeerBatch::_internal_set_snapshot(bool value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void PeerBatch::set_snapshot(bool value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chat.PeerBatch.snapshot)
+}
+
+// repeated .chat.PresenceEntry presence = 3;
+inline int PeerBatch::_internal_presence_size() const {
+  return _impl_.presence_.size();
+}
+inline int PeerBatch::presence_size() const {
+  return _internal_presence_size();
+}
+inline void PeerBatch::clear_presence() {
+  _impl_.presence_.Clear();
+}
+inline ::chat::PresenceEntry* PeerBatch::mutable_presence(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PeerBatch.presence)
+  return _impl_.presence_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >*
+PeerBatch::mutable_presence() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PeerBatch.presence)
+  return &_impl_.presence_;
+}
+inline const ::chat::PresenceEntry& PeerBatch::_internal_presence(int index) const {
+  return _impl_.presence_.Get(index);
+}
+inline const ::chat::PresenceEntry& PeerBatch::presence(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.presence)
+  return _internal_presence(index);
+}
+inline ::chat::PresenceEntry* PeerBatch::_internal_add_presence() {
+  return _impl_.presence_.Add();
+}
+inline ::chat::PresenceEntry* PeerBatch::add_presence() {
+  ::chat::PresenceEntry* _add = _internal_add_presence();
+  // @@protoc_insertion_point(field_add:chat.PeerBatch.presence)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >&
+PeerBatch::presence() const {
+  // @@protoc_insertion_point(field_list:chat.PeerBatch.presence)
+  return _impl_.presence_;
+}
+
+// repeated .chat.ForwardedMessage messages = 4;
+inline int PeerBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int PeerBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void PeerBatch::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::chat::ForwardedMessage* PeerBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PeerBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ForwardedMessage >*
+PeerBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PeerBatch.messages)
+  return &_impl_.messages_;
+}
+inline const ::chat::ForwardedMessage& PeerBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::chat::ForwardedMessage& PeerBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.messages)
+  return _internal_messages(index);
+}
+inline ::chat::ForwardedMessage* PeerBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::chat::ForwardedMessage* PeerBatch::add_messages() {
+  ::chat::ForwardedMessage* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:chat.PeerBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::ForwardedMessage >&
+PeerBatch::messages() const {
+  // @@protoc_insertion_point(field_list:chat.PeerBatch.messages)
+  return _impl_.messages_;
+}
+
+// .chat.NodeVersion clock = 5;
+inline bool PeerBatch::_internal_has_clock() const {
+  return this != internal_default_instance() && _impl_.clock_ != nullptr;
+}
+inline bool PeerBatch::has_clock() const {
+  return _internal_has_clock();
+}
+inline void PeerBatch::clear_clock() {
+  if (GetArenaForAllocation() == nullptr && _impl_.clock_ != nullptr) {
+    delete _impl_.clock_;
+  }
+  _impl_.clock_ = nullptr;
+}
+inline const ::chat::NodeVersion& PeerBatch::_internal_clock() const {
+  const ::chat::NodeVersion* p = _impl_.clock_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::NodeVersion&>(
+      ::chat::_NodeVersion_default_instance_);
+}
+inline const ::chat::NodeVersion& PeerBatch::clock() const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.clock)
+  return _internal_clock();
+}
+inline void PeerBatch::unsafe_arena_set_allocated_clock(
+    ::chat::NodeVersion* clock) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.clock_);
+  }
+  _impl_.clock_ = clock;
+  if (clock) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.PeerBatch.clock)
+}
+inline ::chat::NodeVersion* PeerBatch::release_clock() {
+  
+  ::chat::NodeVersion* temp = _impl_.clock_;
+  _impl_.clock_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::NodeVersion* PeerBatch::unsafe_arena_release_clock() {
+  // @@protoc_insertion_point(field_release:chat.PeerBatch.clock)
+  
+  ::chat::NodeVersion* temp = _impl_.clock_;
+  _impl_.clock_ = nullptr;
+  return temp;
+}
+inline ::chat::NodeVersion* PeerBatch::_internal_mutable_clock() {
+  
+  if (_impl_.clock_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::NodeVersion>(GetArenaForAllocation());
+    _impl_.clock_ = p;
+  }
+  return _impl_.clock_;
+}
+inline ::chat::NodeVersion* PeerBatch::mutable_clock() {
+  ::chat::NodeVersion* _msg = _internal_mutable_clock();
+  // @@protoc_insertion_point(field_mutable:chat.PeerBatch.clock)
+  return _msg;
+}
+inline void PeerBatch::set_allocated_clock(::chat::NodeVersion* clock) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.clock_;
+  }
+  if (clock) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clock);
+    if (message_arena != submessage_arena) {
+      clock = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clock, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.clock_ = clock;
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerBatch.clock)
+}
+
+// repeated .chat.NodeVersion digest = 6;
+inline int PeerBatch::_internal_digest_size() const {
+  return _impl_.digest_.size();
+}
+inline int PeerBatch::digest_size() const {
+  return _internal_digest_size();
+}
+inline void PeerBatch::clear_digest() {
+  _impl_.digest_.Clear();
+}
+inline ::chat::NodeVersion* PeerBatch::mutable_digest(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PeerBatch.digest)
+  return _impl_.digest_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::NodeVersion >*
+PeerBatch::mutable_digest() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PeerBatch.digest)
+  return &_impl_.digest_;
+}
+inline const ::chat::NodeVersion& PeerBatch::_internal_digest(int index) const {
+  return _impl_.digest_.Get(index);
+}
+inline const ::chat::NodeVersion& PeerBatch::digest(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.digest)
+  return _internal_digest(index);
+}
+inline ::chat::NodeVersion* PeerBatch::_internal_add_digest() {
+  return _impl_.digest_.Add();
+}
+inline ::chat::NodeVersion* PeerBatch::add_digest() {
+  ::chat::NodeVersion* _add = _internal_add_digest();
+  // @@protoc_insertion_point(field_add:chat.PeerBatch.digest)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::NodeVersion >&
+PeerBatch::digest() const {
+  // @@protoc_insertion_point(field_list:chat.PeerBatch.digest)
+  return _impl_.digest_;
+}
+
+// string secret = 7;
+inline void PeerBatch::clear_secret() {
+  _impl_.secret_.ClearToEmpty();
+}
+inline const std::string& PeerBatch::secret() const {
+  // @@protoc_insertion_point(field_get:chat.PeerBatch.secret)
+  return _internal_secret();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerBatch::set_secret(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.secret_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PeerBatch.secret)
+}
+inline std::string* PeerBatch::mutable_secret() {
+  std::string* _s = _internal_mutable_secret();
+  // @@protoc_insertion_point(field_mutable:chat.PeerBatch.secret)
+  return _s;
+}
+inline const std::string& PeerBatch::_internal_secret() const {
+  return _impl_.secret_.Get();
+}
+inline void PeerBatch::_internal_set_secret(const std::string& value) {
+  
+  _impl_.secret_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerBatch::_internal_mutable_secret() {
+  
+  return _impl_.secret_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerBatch::release_secret() {
+  // @@protoc_insertion_point(field_release:chat.PeerBatch.secret)
+  return _impl_.secret_.Release();
+}
+inline void PeerBatch::set_allocated_secret(std::string* secret) {
+  if (secret != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.secret_.SetAllocated(secret, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.secret_.IsDefault()) {
+    _impl_.secret_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PeerBatch.secret)
+}
+
+// -------------------------------------------------------------------
+
+// GossipUpdate
+
+// .chat.NodeVersion node = 1;
+inline bool GossipUpdate::_internal_has_node() const {
+  return this != internal_default_instance() && _impl_.node_ != nullptr;
+}
+inline bool GossipUpdate::has_node() const {
+  return _internal_has_node();
+}
+inline void GossipUpdate::clear_node() {
+  if (GetArenaForAllocation() == nullptr && _impl_.node_ != nullptr) {
+    delete _impl_.node_;
+  }
+  _impl_.node_ = nullptr;
+}
+inline const ::chat::NodeVersion& GossipUpdate::_internal_node() const {
+  const ::chat::NodeVersion* p = _impl_.node_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::NodeVersion&>(
+      ::chat::_NodeVersion_default_instance_);
+}
+inline const ::chat::NodeVersion& GossipUpdate::node() const {
+  // @@protoc_insertion_point(field_get:chat.GossipUpdate.node)
+  return _internal_node();
+}
+inline void GossipUpdate::unsafe_arena_set_allocated_node(
+    ::chat::NodeVersion* node) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.node_);
+  }
+  _impl_.node_ = node;
+  if (node) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.GossipUpdate.node)
+}
+inline ::chat::NodeVersion* GossipUpdate::release_node() {
+  
+  ::chat::NodeVersion* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::NodeVersion* GossipUpdate::unsafe_arena_release_node() {
+  // @@protoc_insertion_point(field_release:chat.GossipUpdate.node)
+  
+  ::chat::NodeVersion* temp = _impl_.node_;
+  _impl_.node_ = nullptr;
+  return temp;
+}
+inline ::chat::NodeVersion* GossipUpdate::_internal_mutable_node() {
+  
+  if (_impl_.node_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::NodeVersion>(GetArenaForAllocation());
+    _impl_.node_ = p;
+  }
+  return _impl_.node_;
+}
+inline ::chat::NodeVersion* GossipUpdate::mutable_node() {
+  ::chat::NodeVersion* _msg = _internal_mutable_node();
+  // @@protoc_insertion_point(field_mutable:chat.GossipUpdate.node)
+  return _msg;
+}
+inline void GossipUpdate::set_allocated_node(::chat::NodeVersion* node) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.node_;
+  }
+  if (node) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(node);
+    if (message_arena != submessage_arena) {
+      node = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, node, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.node_ = node;
+  // @@protoc_insertion_point(field_set_allocated:chat.GossipUpdate.node)
+}
+
+// repeated .chat.PresenceEntry entries = 2;
+inline int GossipUpdate::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int GossipUpdate::entries_size() const {
+  return _internal_entries_size();
+}
+inline void GossipUpdate::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::chat::PresenceEntry* GossipUpdate::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.GossipUpdate.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >*
+GossipUpdate::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:chat.GossipUpdate.entries)
+  return &_impl_.entries_;
+}
+inline const ::chat::PresenceEntry& GossipUpdate::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::chat::PresenceEntry& GossipUpdate::entries(int index) const {
+  // @@protoc_insertion_point(field_get:chat.GossipUpdate.entries)
+  return _internal_entries(index);
+}
+inline ::chat::PresenceEntry* GossipUpdate::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::chat::PresenceEntry* GossipUpdate::add_entries() {
+  ::chat::PresenceEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:chat.GossipUpdate.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEntry >&
+GossipUpdate::entries() const {
+  // @@protoc_insertion_point(field_list:chat.GossipUpdate.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// UpdateStatusRequest
+
+// string username = 1;
+inline void UpdateStatusRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
 }
-inline const std::string& User::_internal_username() const {
-  return username_.Get();
+inline const std::string& UpdateStatusRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.username)
+  return _internal_username();
 }
-inline void User::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateStatusRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.username)
 }
-inline void User::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.User.username)
+inline std::string* UpdateStatusRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UpdateStatusRequest.username)
+  return _s;
 }
-inline void User::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.User.username)
+inline const std::string& UpdateStatusRequest::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void User::set_username(const char* value,
-    size_t size) {
+inline void UpdateStatusRequest::_internal_set_username(const std::string& value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.User.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline std::string* User::_internal_mutable_username() {
+inline std::string* UpdateStatusRequest::_internal_mutable_username() {
   
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline std::string* User::release_username() {
-  // @@protoc_insertion_point(field_release:chat.User.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* UpdateStatusRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UpdateStatusRequest.username)
+  return _impl_.username_.Release();
 }
-inline void User::set_allocated_username(std::string* username) {
+inline void UpdateStatusRequest::set_allocated_username(std::string* username) {
   if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.User.username)
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpdateStatusRequest.username)
+}
+
+// .chat.UserStatus new_status = 2;
+inline void UpdateStatusRequest::clear_new_status() {
+  _impl_.new_status_ = 0;
+}
+inline ::chat::UserStatus UpdateStatusRequest::_internal_new_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.new_status_);
+}
+inline ::chat::UserStatus UpdateStatusRequest::new_status() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.new_status)
+  return _internal_new_status();
 }
-inline std::string* User::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.User.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void UpdateStatusRequest::_internal_set_new_status(::chat::UserStatus value) {
   
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.new_status_ = value;
 }
-inline void User::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (username != nullptr) {
-    
-  } else {
-    
-  }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.User.username)
+inline void UpdateStatusRequest::set_new_status(::chat::UserStatus value) {
+  _internal_set_new_status(value);
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.new_status)
 }
 
-// .chat.UserStatus status = 2;
-inline void User::clear_status() {
-  status_ = 0;
+// -------------------------------------------------------------------
+
+// Request
+
+// .chat.Operation operation = 1;
+inline void Request::clear_operation() {
+  _impl_.operation_ = 0;
 }
-inline ::chat::UserStatus User::_internal_status() const {
-  return static_cast< ::chat::UserStatus >(status_);
+inline ::chat::Operation Request::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
 }
-inline ::chat::UserStatus User::status() const {
-  // @@protoc_insertion_point(field_get:chat.User.status)
-  return _internal_status();
+inline ::chat::Operation Request::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Request.operation)
+  return _internal_operation();
 }
-inline void User::_internal_set_status(::chat::UserStatus value) {
+inline void Request::_internal_set_operation(::chat::Operation value) {
   
-  status_ = value;
+  _impl_.operation_ = value;
 }
-inline void User::set_status(::chat::UserStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:chat.User.status)
+inline void Request::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Request.operation)
 }
 
-// -------------------------------------------------------------------
+// .chat.NewUserRequest register_user = 2;
+inline bool Request::_internal_has_register_user() const {
+  return payload_case() == kRegisterUser;
+}
+inline bool Request::has_register_user() const {
+  return _internal_has_register_user();
+}
+inline void Request::set_has_register_user() {
+  _impl_._oneof_case_[0] = kRegisterUser;
+}
+inline void Request::clear_register_user() {
+  if (_internal_has_register_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.register_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::NewUserRequest* Request::release_register_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::NewUserRequest& Request::_internal_register_user() const {
+  return _internal_has_register_user()
+      ? *_impl_.payload_.register_user_
+      : reinterpret_cast< ::chat::NewUserRequest&>(::chat::_NewUserRequest_default_instance_);
+}
+inline const ::chat::NewUserRequest& Request::register_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.register_user)
+  return _internal_register_user();
+}
+inline ::chat::NewUserRequest* Request::unsafe_arena_release_register_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_register_user(::chat::NewUserRequest* register_user) {
+  clear_payload();
+  if (register_user) {
+    set_has_register_user();
+    _impl_.payload_.register_user_ = register_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.register_user)
+}
+inline ::chat::NewUserRequest* Request::_internal_mutable_register_user() {
+  if (!_internal_has_register_user()) {
+    clear_payload();
+    set_has_register_user();
+    _impl_.payload_.register_user_ = CreateMaybeMessage< ::chat::NewUserRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.register_user_;
+}
+inline ::chat::NewUserRequest* Request::mutable_register_user() {
+  ::chat::NewUserRequest* _msg = _internal_mutable_register_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.register_user)
+  return _msg;
+}
 
-// NewUserRequest
+// .chat.SendMessageRequest send_message = 3;
+inline bool Request::_internal_has_send_message() const {
+  return payload_case() == kSendMessage;
+}
+inline bool Request::has_send_message() const {
+  return _internal_has_send_message();
+}
+inline void Request::set_has_send_message() {
+  _impl_._oneof_case_[0] = kSendMessage;
+}
+inline void Request::clear_send_message() {
+  if (_internal_has_send_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.send_message_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::SendMessageRequest* Request::release_send_message() {
+  // @@protoc_insertion_point(field_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::SendMessageRequest& Request::_internal_send_message() const {
+  return _internal_has_send_message()
+      ? *_impl_.payload_.send_message_
+      : reinterpret_cast< ::chat::SendMessageRequest&>(::chat::_SendMessageRequest_default_instance_);
+}
+inline const ::chat::SendMessageRequest& Request::send_message() const {
+  // @@protoc_insertion_point(field_get:chat.Request.send_message)
+  return _internal_send_message();
+}
+inline ::chat::SendMessageRequest* Request::unsafe_arena_release_send_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_send_message(::chat::SendMessageRequest* send_message) {
+  clear_payload();
+  if (send_message) {
+    set_has_send_message();
+    _impl_.payload_.send_message_ = send_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message)
+}
+inline ::chat::SendMessageRequest* Request::_internal_mutable_send_message() {
+  if (!_internal_has_send_message()) {
+    clear_payload();
+    set_has_send_message();
+    _impl_.payload_.send_message_ = CreateMaybeMessage< ::chat::SendMessageRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.send_message_;
+}
+inline ::chat::SendMessageRequest* Request::mutable_send_message() {
+  ::chat::SendMessageRequest* _msg = _internal_mutable_send_message();
+  // @@protoc_insertion_point(field_mutable:chat.Request.send_message)
+  return _msg;
+}
 
-// string username = 1;
-inline void NewUserRequest::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .chat.UpdateStatusRequest update_status = 4;
+inline bool Request::_internal_has_update_status() const {
+  return payload_case() == kUpdateStatus;
 }
-inline const std::string& NewUserRequest::username() const {
-  // @@protoc_insertion_point(field_get:chat.NewUserRequest.username)
-  return _internal_username();
+inline bool Request::has_update_status() const {
+  return _internal_has_update_status();
 }
-inline void NewUserRequest::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.NewUserRequest.username)
+inline void Request::set_has_update_status() {
+  _impl_._oneof_case_[0] = kUpdateStatus;
 }
-inline std::string* NewUserRequest::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.NewUserRequest.username)
-  return _internal_mutable_username();
+inline void Request::clear_update_status() {
+  if (_internal_has_update_status()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.update_status_;
+    }
+    clear_has_payload();
+  }
 }
-inline const std::string& NewUserRequest::_internal_username() const {
-  return username_.Get();
+inline ::chat::UpdateStatusRequest* Request::release_update_status() {
+  // @@protoc_insertion_point(field_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void NewUserRequest::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::chat::UpdateStatusRequest& Request::_internal_update_status() const {
+  return _internal_has_update_status()
+      ? *_impl_.payload_.update_status_
+      : reinterpret_cast< ::chat::UpdateStatusRequest&>(::chat::_UpdateStatusRequest_default_instance_);
 }
-inline void NewUserRequest::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.NewUserRequest.username)
+inline const ::chat::UpdateStatusRequest& Request::update_status() const {
+  // @@protoc_insertion_point(field_get:chat.Request.update_status)
+  return _internal_update_status();
 }
-inline void NewUserRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.NewUserRequest.username)
+inline ::chat::UpdateStatusRequest* Request::unsafe_arena_release_update_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void NewUserRequest::set_username(const char* value,
-    size_t size) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.NewUserRequest.username)
+inline void Request::unsafe_arena_set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
+  clear_payload();
+  if (update_status) {
+    set_has_update_status();
+    _impl_.payload_.update_status_ = update_status;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.update_status)
+}
+inline ::chat::UpdateStatusRequest* Request::_internal_mutable_update_status() {
+  if (!_internal_has_update_status()) {
+    clear_payload();
+    set_has_update_status();
+    _impl_.payload_.update_status_ = CreateMaybeMessage< ::chat::UpdateStatusRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.update_status_;
+}
+inline ::chat::UpdateStatusRequest* Request::mutable_update_status() {
+  ::chat::UpdateStatusRequest* _msg = _internal_mutable_update_status();
+  // @@protoc_insertion_point(field_mutable:chat.Request.update_status)
+  return _msg;
+}
+
+// .chat.UserListRequest get_users = 5;
+inline bool Request::_internal_has_get_users() const {
+  return payload_case() == kGetUsers;
 }
-inline std::string* NewUserRequest::_internal_mutable_username() {
-  
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool Request::has_get_users() const {
+  return _internal_has_get_users();
 }
-inline std::string* NewUserRequest::release_username() {
-  // @@protoc_insertion_point(field_release:chat.NewUserRequest.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::set_has_get_users() {
+  _impl_._oneof_case_[0] = kGetUsers;
 }
-inline void NewUserRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
-  } else {
-    
+inline void Request::clear_get_users() {
+  if (_internal_has_get_users()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.get_users_;
+    }
+    clear_has_payload();
   }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.NewUserRequest.username)
 }
-inline std::string* NewUserRequest::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.NewUserRequest.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void NewUserRequest::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (username != nullptr) {
-    
+inline ::chat::UserListRequest* Request::release_get_users() {
+  // @@protoc_insertion_point(field_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.NewUserRequest.username)
-}
-
-// -------------------------------------------------------------------
-
-// SendMessageRequest
-
-// string recipient = 1;
-inline void SendMessageRequest::clear_recipient() {
-  recipient_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& SendMessageRequest::recipient() const {
-  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient)
-  return _internal_recipient();
 }
-inline void SendMessageRequest::set_recipient(const std::string& value) {
-  _internal_set_recipient(value);
-  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient)
+inline const ::chat::UserListRequest& Request::_internal_get_users() const {
+  return _internal_has_get_users()
+      ? *_impl_.payload_.get_users_
+      : reinterpret_cast< ::chat::UserListRequest&>(::chat::_UserListRequest_default_instance_);
 }
-inline std::string* SendMessageRequest::mutable_recipient() {
-  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.recipient)
-  return _internal_mutable_recipient();
+inline const ::chat::UserListRequest& Request::get_users() const {
+  // @@protoc_insertion_point(field_get:chat.Request.get_users)
+  return _internal_get_users();
 }
-inline const std::string& SendMessageRequest::_internal_recipient() const {
-  return recipient_.Get();
+inline ::chat::UserListRequest* Request::unsafe_arena_release_get_users() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void SendMessageRequest::_internal_set_recipient(const std::string& value) {
-  
-  recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void Request::unsafe_arena_set_allocated_get_users(::chat::UserListRequest* get_users) {
+  clear_payload();
+  if (get_users) {
+    set_has_get_users();
+    _impl_.payload_.get_users_ = get_users;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_users)
 }
-inline void SendMessageRequest::set_recipient(std::string&& value) {
-  
-  recipient_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.SendMessageRequest.recipient)
+inline ::chat::UserListRequest* Request::_internal_mutable_get_users() {
+  if (!_internal_has_get_users()) {
+    clear_payload();
+    set_has_get_users();
+    _impl_.payload_.get_users_ = CreateMaybeMessage< ::chat::UserListRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.get_users_;
 }
-inline void SendMessageRequest::set_recipient(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.SendMessageRequest.recipient)
+inline ::chat::UserListRequest* Request::mutable_get_users() {
+  ::chat::UserListRequest* _msg = _internal_mutable_get_users();
+  // @@protoc_insertion_point(field_mutable:chat.Request.get_users)
+  return _msg;
 }
-inline void SendMessageRequest::set_recipient(const char* value,
-    size_t size) {
-  
-  recipient_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.SendMessageRequest.recipient)
+
+// .chat.User unregister_user = 6;
+inline bool Request::_internal_has_unregister_user() const {
+  return payload_case() == kUnregisterUser;
 }
-inline std::string* SendMessageRequest::_internal_mutable_recipient() {
-  
-  return recipient_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool Request::has_unregister_user() const {
+  return _internal_has_unregister_user();
 }
-inline std::string* SendMessageRequest::release_recipient() {
-  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.recipient)
-  return recipient_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::set_has_unregister_user() {
+  _impl_._oneof_case_[0] = kUnregisterUser;
 }
-inline void SendMessageRequest::set_allocated_recipient(std::string* recipient) {
-  if (recipient != nullptr) {
-    
-  } else {
-    
+inline void Request::clear_unregister_user() {
+  if (_internal_has_unregister_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.unregister_user_;
+    }
+    clear_has_payload();
   }
-  recipient_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), recipient,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.recipient)
-}
-inline std::string* SendMessageRequest::unsafe_arena_release_recipient() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.SendMessageRequest.recipient)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return recipient_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
 }
-inline void SendMessageRequest::unsafe_arena_set_allocated_recipient(
-    std::string* recipient) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (recipient != nullptr) {
-    
+inline ::chat::User* Request::release_unregister_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  recipient_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      recipient, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.SendMessageRequest.recipient)
-}
-
-// string content = 2;
-inline void SendMessageRequest::clear_content() {
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& SendMessageRequest::content() const {
-  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.content)
-  return _internal_content();
 }
-inline void SendMessageRequest::set_content(const std::string& value) {
-  _internal_set_content(value);
-  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.content)
+inline const ::chat::User& Request::_internal_unregister_user() const {
+  return _internal_has_unregister_user()
+      ? *_impl_.payload_.unregister_user_
+      : reinterpret_cast< ::chat::User&>(::chat::_User_default_instance_);
 }
-inline std::string* SendMessageRequest::mutable_content() {
-  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.content)
-  return _internal_mutable_content();
+inline const ::chat::User& Request::unregister_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.unregister_user)
+  return _internal_unregister_user();
 }
-inline const std::string& SendMessageRequest::_internal_content() const {
-  return content_.Get();
+inline ::chat::User* Request::unsafe_arena_release_unregister_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void SendMessageRequest::_internal_set_content(const std::string& value) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void Request::unsafe_arena_set_allocated_unregister_user(::chat::User* unregister_user) {
+  clear_payload();
+  if (unregister_user) {
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = unregister_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.unregister_user)
 }
-inline void SendMessageRequest::set_content(std::string&& value) {
-  
-  content_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.SendMessageRequest.content)
+inline ::chat::User* Request::_internal_mutable_unregister_user() {
+  if (!_internal_has_unregister_user()) {
+    clear_payload();
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = CreateMaybeMessage< ::chat::User >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.unregister_user_;
 }
-inline void SendMessageRequest::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.SendMessageRequest.content)
+inline ::chat::User* Request::mutable_unregister_user() {
+  ::chat::User* _msg = _internal_mutable_unregister_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.unregister_user)
+  return _msg;
 }
-inline void SendMessageRequest::set_content(const char* value,
-    size_t size) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.SendMessageRequest.content)
+
+// .chat.AckRequest ack = 7;
+inline bool Request::_internal_has_ack() const {
+  return payload_case() == kAck;
 }
-inline std::string* SendMessageRequest::_internal_mutable_content() {
-  
-  return content_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool Request::has_ack() const {
+  return _internal_has_ack();
 }
-inline std::string* SendMessageRequest::release_content() {
-  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.content)
-  return content_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::set_has_ack() {
+  _impl_._oneof_case_[0] = kAck;
 }
-inline void SendMessageRequest::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
+inline void Request::clear_ack() {
+  if (_internal_has_ack()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.ack_;
+    }
+    clear_has_payload();
   }
-  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.content)
 }
-inline std::string* SendMessageRequest::unsafe_arena_release_content() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.SendMessageRequest.content)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return content_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void SendMessageRequest::unsafe_arena_set_allocated_content(
-    std::string* content) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (content != nullptr) {
-    
+inline ::chat::AckRequest* Request::release_ack() {
+  // @@protoc_insertion_point(field_release:chat.Request.ack)
+  if (_internal_has_ack()) {
+    clear_has_payload();
+    ::chat::AckRequest* temp = _impl_.payload_.ack_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.ack_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  content_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      content, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.SendMessageRequest.content)
-}
-
-// -------------------------------------------------------------------
-
-// IncomingMessageResponse
-
-// string sender = 1;
-inline void IncomingMessageResponse::clear_sender() {
-  sender_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& IncomingMessageResponse::sender() const {
-  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender)
-  return _internal_sender();
+inline const ::chat::AckRequest& Request::_internal_ack() const {
+  return _internal_has_ack()
+      ? *_impl_.payload_.ack_
+      : reinterpret_cast< ::chat::AckRequest&>(::chat::_AckRequest_default_instance_);
 }
-inline void IncomingMessageResponse::set_sender(const std::string& value) {
-  _internal_set_sender(value);
-  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender)
+inline const ::chat::AckRequest& Request::ack() const {
+  // @@protoc_insertion_point(field_get:chat.Request.ack)
+  return _internal_ack();
 }
-inline std::string* IncomingMessageResponse::mutable_sender() {
-  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.sender)
-  return _internal_mutable_sender();
+inline ::chat::AckRequest* Request::unsafe_arena_release_ack() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.ack)
+  if (_internal_has_ack()) {
+    clear_has_payload();
+    ::chat::AckRequest* temp = _impl_.payload_.ack_;
+    _impl_.payload_.ack_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const std::string& IncomingMessageResponse::_internal_sender() const {
-  return sender_.Get();
+inline void Request::unsafe_arena_set_allocated_ack(::chat::AckRequest* ack) {
+  clear_payload();
+  if (ack) {
+    set_has_ack();
+    _impl_.payload_.ack_ = ack;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.ack)
 }
-inline void IncomingMessageResponse::_internal_set_sender(const std::string& value) {
-  
-  sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline ::chat::AckRequest* Request::_internal_mutable_ack() {
+  if (!_internal_has_ack()) {
+    clear_payload();
+    set_has_ack();
+    _impl_.payload_.ack_ = CreateMaybeMessage< ::chat::AckRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.ack_;
 }
-inline void IncomingMessageResponse::set_sender(std::string&& value) {
-  
-  sender_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.IncomingMessageResponse.sender)
+inline ::chat::AckRequest* Request::mutable_ack() {
+  ::chat::AckRequest* _msg = _internal_mutable_ack();
+  // @@protoc_insertion_point(field_mutable:chat.Request.ack)
+  return _msg;
 }
-inline void IncomingMessageResponse::set_sender(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.IncomingMessageResponse.sender)
+
+// .chat.ChannelRequest channel = 8;
+inline bool Request::_internal_has_channel() const {
+  return payload_case() == kChannel;
 }
-inline void IncomingMessageResponse::set_sender(const char* value,
-    size_t size) {
-  
-  sender_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.IncomingMessageResponse.sender)
+inline bool Request::has_channel() const {
+  return _internal_has_channel();
 }
-inline std::string* IncomingMessageResponse::_internal_mutable_sender() {
-  
-  return sender_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::set_has_channel() {
+  _impl_._oneof_case_[0] = kChannel;
 }
-inline std::string* IncomingMessageResponse::release_sender() {
-  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.sender)
-  return sender_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::clear_channel() {
+  if (_internal_has_channel()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.channel_;
+    }
+    clear_has_payload();
+  }
 }
-inline void IncomingMessageResponse::set_allocated_sender(std::string* sender) {
-  if (sender != nullptr) {
-    
+inline ::chat::ChannelRequest* Request::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.Request.channel)
+  if (_internal_has_channel()) {
+    clear_has_payload();
+    ::chat::ChannelRequest* temp = _impl_.payload_.channel_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.channel_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  sender_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), sender,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.sender)
 }
-inline std::string* IncomingMessageResponse::unsafe_arena_release_sender() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.IncomingMessageResponse.sender)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return sender_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline const ::chat::ChannelRequest& Request::_internal_channel() const {
+  return _internal_has_channel()
+      ? *_impl_.payload_.channel_
+      : reinterpret_cast< ::chat::ChannelRequest&>(::chat::_ChannelRequest_default_instance_);
 }
-inline void IncomingMessageResponse::unsafe_arena_set_allocated_sender(
-    std::string* sender) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (sender != nullptr) {
-    
+inline const ::chat::ChannelRequest& Request::channel() const {
+  // @@protoc_insertion_point(field_get:chat.Request.channel)
+  return _internal_channel();
+}
+inline ::chat::ChannelRequest* Request::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.channel)
+  if (_internal_has_channel()) {
+    clear_has_payload();
+    ::chat::ChannelRequest* temp = _impl_.payload_.channel_;
+    _impl_.payload_.channel_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  sender_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      sender, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.IncomingMessageResponse.sender)
-}
-
-// string content = 2;
-inline void IncomingMessageResponse::clear_content() {
-  content_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& IncomingMessageResponse::content() const {
-  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.content)
-  return _internal_content();
+inline void Request::unsafe_arena_set_allocated_channel(::chat::ChannelRequest* channel) {
+  clear_payload();
+  if (channel) {
+    set_has_channel();
+    _impl_.payload_.channel_ = channel;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.channel)
 }
-inline void IncomingMessageResponse::set_content(const std::string& value) {
-  _internal_set_content(value);
-  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.content)
+inline ::chat::ChannelRequest* Request::_internal_mutable_channel() {
+  if (!_internal_has_channel()) {
+    clear_payload();
+    set_has_channel();
+    _impl_.payload_.channel_ = CreateMaybeMessage< ::chat::ChannelRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.channel_;
 }
-inline std::string* IncomingMessageResponse::mutable_content() {
-  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.content)
-  return _internal_mutable_content();
+inline ::chat::ChannelRequest* Request::mutable_channel() {
+  ::chat::ChannelRequest* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.Request.channel)
+  return _msg;
 }
-inline const std::string& IncomingMessageResponse::_internal_content() const {
-  return content_.Get();
+
+// .chat.PresenceSubscribeRequest subscribe_presence = 9;
+inline bool Request::_internal_has_subscribe_presence() const {
+  return payload_case() == kSubscribePresence;
 }
-inline void IncomingMessageResponse::_internal_set_content(const std::string& value) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline bool Request::has_subscribe_presence() const {
+  return _internal_has_subscribe_presence();
 }
-inline void IncomingMessageResponse::set_content(std::string&& value) {
-  
-  content_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.IncomingMessageResponse.content)
+inline void Request::set_has_subscribe_presence() {
+  _impl_._oneof_case_[0] = kSubscribePresence;
 }
-inline void IncomingMessageResponse::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.IncomingMessageResponse.content)
+inline void Request::clear_subscribe_presence() {
+  if (_internal_has_subscribe_presence()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.subscribe_presence_;
+    }
+    clear_has_payload();
+  }
 }
-inline void IncomingMessageResponse::set_content(const char* value,
-    size_t size) {
-  
-  content_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.IncomingMessageResponse.content)
+inline ::chat::PresenceSubscribeRequest* Request::release_subscribe_presence() {
+  // @@protoc_insertion_point(field_release:chat.Request.subscribe_presence)
+  if (_internal_has_subscribe_presence()) {
+    clear_has_payload();
+    ::chat::PresenceSubscribeRequest* temp = _impl_.payload_.subscribe_presence_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.subscribe_presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline std::string* IncomingMessageResponse::_internal_mutable_content() {
-  
-  return content_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::chat::PresenceSubscribeRequest& Request::_internal_subscribe_presence() const {
+  return _internal_has_subscribe_presence()
+      ? *_impl_.payload_.subscribe_presence_
+      : reinterpret_cast< ::chat::PresenceSubscribeRequest&>(::chat::_PresenceSubscribeRequest_default_instance_);
 }
-inline std::string* IncomingMessageResponse::release_content() {
-  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.content)
-  return content_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::chat::PresenceSubscribeRequest& Request::subscribe_presence() const {
+  // @@protoc_insertion_point(field_get:chat.Request.subscribe_presence)
+  return _internal_subscribe_presence();
 }
-inline void IncomingMessageResponse::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
+inline ::chat::PresenceSubscribeRequest* Request::unsafe_arena_release_subscribe_presence() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.subscribe_presence)
+  if (_internal_has_subscribe_presence()) {
+    clear_has_payload();
+    ::chat::PresenceSubscribeRequest* temp = _impl_.payload_.subscribe_presence_;
+    _impl_.payload_.subscribe_presence_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.content)
 }
-inline std::string* IncomingMessageResponse::unsafe_arena_release_content() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.IncomingMessageResponse.content)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return content_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline void Request::unsafe_arena_set_allocated_subscribe_presence(::chat::PresenceSubscribeRequest* subscribe_presence) {
+  clear_payload();
+  if (subscribe_presence) {
+    set_has_subscribe_presence();
+    _impl_.payload_.subscribe_presence_ = subscribe_presence;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.subscribe_presence)
 }
-inline void IncomingMessageResponse::unsafe_arena_set_allocated_content(
-    std::string* content) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (content != nullptr) {
-    
-  } else {
-    
+inline ::chat::PresenceSubscribeRequest* Request::_internal_mutable_subscribe_presence() {
+  if (!_internal_has_subscribe_presence()) {
+    clear_payload();
+    set_has_subscribe_presence();
+    _impl_.payload_.subscribe_presence_ = CreateMaybeMessage< ::chat::PresenceSubscribeRequest >(GetArenaForAllocation());
   }
-  content_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      content, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.IncomingMessageResponse.content)
+  return _impl_.payload_.subscribe_presence_;
 }
-
-// .chat.MessageType type = 3;
-inline void IncomingMessageResponse::clear_type() {
-  type_ = 0;
+inline ::chat::PresenceSubscribeRequest* Request::mutable_subscribe_presence() {
+  ::chat::PresenceSubscribeRequest* _msg = _internal_mutable_subscribe_presence();
+  // @@protoc_insertion_point(field_mutable:chat.Request.subscribe_presence)
+  return _msg;
 }
-inline ::chat::MessageType IncomingMessageResponse::_internal_type() const {
-  return static_cast< ::chat::MessageType >(type_);
+
+// .chat.TransferStart transfer_start = 10;
+inline bool Request::_internal_has_transfer_start() const {
+  return payload_case() == kTransferStart;
 }
-inline ::chat::MessageType IncomingMessageResponse::type() const {
-  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.type)
-  return _internal_type();
+inline bool Request::has_transfer_start() const {
+  return _internal_has_transfer_start();
 }
-inline void IncomingMessageResponse::_internal_set_type(::chat::MessageType value) {
-  
-  type_ = value;
+inline void Request::set_has_transfer_start() {
+  _impl_._oneof_case_[0] = kTransferStart;
 }
-inline void IncomingMessageResponse::set_type(::chat::MessageType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.type)
+inline void Request::clear_transfer_start() {
+  if (_internal_has_transfer_start()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.transfer_start_;
+    }
+    clear_has_payload();
+  }
 }
-
-// -------------------------------------------------------------------
-
-// UserListRequest
-
-// string username = 1;
-inline void UserListRequest::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::chat::TransferStart* Request::release_transfer_start() {
+  // @@protoc_insertion_point(field_release:chat.Request.transfer_start)
+  if (_internal_has_transfer_start()) {
+    clear_has_payload();
+    ::chat::TransferStart* temp = _impl_.payload_.transfer_start_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.transfer_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const std::string& UserListRequest::username() const {
-  // @@protoc_insertion_point(field_get:chat.UserListRequest.username)
-  return _internal_username();
+inline const ::chat::TransferStart& Request::_internal_transfer_start() const {
+  return _internal_has_transfer_start()
+      ? *_impl_.payload_.transfer_start_
+      : reinterpret_cast< ::chat::TransferStart&>(::chat::_TransferStart_default_instance_);
 }
-inline void UserListRequest::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.UserListRequest.username)
+inline const ::chat::TransferStart& Request::transfer_start() const {
+  // @@protoc_insertion_point(field_get:chat.Request.transfer_start)
+  return _internal_transfer_start();
 }
-inline std::string* UserListRequest::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.username)
-  return _internal_mutable_username();
+inline ::chat::TransferStart* Request::unsafe_arena_release_transfer_start() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.transfer_start)
+  if (_internal_has_transfer_start()) {
+    clear_has_payload();
+    ::chat::TransferStart* temp = _impl_.payload_.transfer_start_;
+    _impl_.payload_.transfer_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const std::string& UserListRequest::_internal_username() const {
-  return username_.Get();
+inline void Request::unsafe_arena_set_allocated_transfer_start(::chat::TransferStart* transfer_start) {
+  clear_payload();
+  if (transfer_start) {
+    set_has_transfer_start();
+    _impl_.payload_.transfer_start_ = transfer_start;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.transfer_start)
 }
-inline void UserListRequest::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline ::chat::TransferStart* Request::_internal_mutable_transfer_start() {
+  if (!_internal_has_transfer_start()) {
+    clear_payload();
+    set_has_transfer_start();
+    _impl_.payload_.transfer_start_ = CreateMaybeMessage< ::chat::TransferStart >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.transfer_start_;
 }
-inline void UserListRequest::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.UserListRequest.username)
+inline ::chat::TransferStart* Request::mutable_transfer_start() {
+  ::chat::TransferStart* _msg = _internal_mutable_transfer_start();
+  // @@protoc_insertion_point(field_mutable:chat.Request.transfer_start)
+  return _msg;
 }
-inline void UserListRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.UserListRequest.username)
+
+// .chat.TransferChunk transfer_chunk = 11;
+inline bool Request::_internal_has_transfer_chunk() const {
+  return payload_case() == kTransferChunk;
 }
-inline void UserListRequest::set_username(const char* value,
-    size_t size) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.UserListRequest.username)
+inline bool Request::has_transfer_chunk() const {
+  return _internal_has_transfer_chunk();
 }
-inline std::string* UserListRequest::_internal_mutable_username() {
-  
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::set_has_transfer_chunk() {
+  _impl_._oneof_case_[0] = kTransferChunk;
 }
-inline std::string* UserListRequest::release_username() {
-  // @@protoc_insertion_point(field_release:chat.UserListRequest.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Request::clear_transfer_chunk() {
+  if (_internal_has_transfer_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.transfer_chunk_;
+    }
+    clear_has_payload();
+  }
 }
-inline void UserListRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
+inline ::chat::TransferChunk* Request::release_transfer_chunk() {
+  // @@protoc_insertion_point(field_release:chat.Request.transfer_chunk)
+  if (_internal_has_transfer_chunk()) {
+    clear_has_payload();
+    ::chat::TransferChunk* temp = _impl_.payload_.transfer_chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.transfer_chunk_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.username)
 }
-inline std::string* UserListRequest::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.UserListRequest.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline const ::chat::TransferChunk& Request::_internal_transfer_chunk() const {
+  return _internal_has_transfer_chunk()
+      ? *_impl_.payload_.transfer_chunk_
+      : reinterpret_cast< ::chat::TransferChunk&>(::chat::_TransferChunk_default_instance_);
 }
-inline void UserListRequest::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (username != nullptr) {
-    
+inline const ::chat::TransferChunk& Request::transfer_chunk() const {
+  // @@protoc_insertion_point(field_get:chat.Request.transfer_chunk)
+  return _internal_transfer_chunk();
+}
+inline ::chat::TransferChunk* Request::unsafe_arena_release_transfer_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.transfer_chunk)
+  if (_internal_has_transfer_chunk()) {
+    clear_has_payload();
+    ::chat::TransferChunk* temp = _impl_.payload_.transfer_chunk_;
+    _impl_.payload_.transfer_chunk_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.UserListRequest.username)
 }
-
-// -------------------------------------------------------------------
-
-// UserListResponse
-
-// repeated .chat.User users = 1;
-inline int UserListResponse::_internal_users_size() const {
-  return users_.size();
-}
-inline int UserListResponse::users_size() const {
-  return _internal_users_size();
+inline void Request::unsafe_arena_set_allocated_transfer_chunk(::chat::TransferChunk* transfer_chunk) {
+  clear_payload();
+  if (transfer_chunk) {
+    set_has_transfer_chunk();
+    _impl_.payload_.transfer_chunk_ = transfer_chunk;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.transfer_chunk)
 }
-inline void UserListResponse::clear_users() {
-  users_.Clear();
+inline ::chat::TransferChunk* Request::_internal_mutable_transfer_chunk() {
+  if (!_internal_has_transfer_chunk()) {
+    clear_payload();
+    set_has_transfer_chunk();
+    _impl_.payload_.transfer_chunk_ = CreateMaybeMessage< ::chat::TransferChunk >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.transfer_chunk_;
 }
-inline ::chat::User* UserListResponse::mutable_users(int index) {
-  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.users)
-  return users_.Mutable(index);
+inline ::chat::TransferChunk* Request::mutable_transfer_chunk() {
+  ::chat::TransferChunk* _msg = _internal_mutable_transfer_chunk();
+  // @@protoc_insertion_point(field_mutable:chat.Request.transfer_chunk)
+  return _msg;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
-UserListResponse::mutable_users() {
-  // @@protoc_insertion_point(field_mutable_list:chat.UserListResponse.users)
-  return &users_;
+
+// .chat.PeerBatch peer_batch = 12;
+inline bool Request::_internal_has_peer_batch() const {
+  return payload_case() == kPeerBatch;
 }
-inline const ::chat::User& UserListResponse::_internal_users(int index) const {
-  return users_.Get(index);
+inline bool Request::has_peer_batch() const {
+  return _internal_has_peer_batch();
 }
-inline const ::chat::User& UserListResponse::users(int index) const {
-  // @@protoc_insertion_point(field_get:chat.UserListResponse.users)
-  return _internal_users(index);
+inline void Request::set_has_peer_batch() {
+  _impl_._oneof_case_[0] = kPeerBatch;
 }
-inline ::chat::User* UserListResponse::_internal_add_users() {
-  return users_.Add();
+inline void Request::clear_peer_batch() {
+  if (_internal_has_peer_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.peer_batch_;
+    }
+    clear_has_payload();
+  }
 }
-inline ::chat::User* UserListResponse::add_users() {
-  // @@protoc_insertion_point(field_add:chat.UserListResponse.users)
-  return _internal_add_users();
+inline ::chat::PeerBatch* Request::release_peer_batch() {
+  // @@protoc_insertion_point(field_release:chat.Request.peer_batch)
+  if (_internal_has_peer_batch()) {
+    clear_has_payload();
+    ::chat::PeerBatch* temp = _impl_.payload_.peer_batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.peer_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
-UserListResponse::users() const {
-  // @@protoc_insertion_point(field_list:chat.UserListResponse.users)
-  return users_;
+inline const ::chat::PeerBatch& Request::_internal_peer_batch() const {
+  return _internal_has_peer_batch()
+      ? *_impl_.payload_.peer_batch_
+      : reinterpret_cast< ::chat::PeerBatch&>(::chat::_PeerBatch_default_instance_);
 }
-
-// .chat.UserListType type = 2;
-inline void UserListResponse::clear_type() {
-  type_ = 0;
+inline const ::chat::PeerBatch& Request::peer_batch() const {
+  // @@protoc_insertion_point(field_get:chat.Request.peer_batch)
+  return _internal_peer_batch();
 }
-inline ::chat::UserListType UserListResponse::_internal_type() const {
-  return static_cast< ::chat::UserListType >(type_);
+inline ::chat::PeerBatch* Request::unsafe_arena_release_peer_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.peer_batch)
+  if (_internal_has_peer_batch()) {
+    clear_has_payload();
+    ::chat::PeerBatch* temp = _impl_.payload_.peer_batch_;
+    _impl_.payload_.peer_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::chat::UserListType UserListResponse::type() const {
-  // @@protoc_insertion_point(field_get:chat.UserListResponse.type)
-  return _internal_type();
+inline void Request::unsafe_arena_set_allocated_peer_batch(::chat::PeerBatch* peer_batch) {
+  clear_payload();
+  if (peer_batch) {
+    set_has_peer_batch();
+    _impl_.payload_.peer_batch_ = peer_batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.peer_batch)
 }
-inline void UserListResponse::_internal_set_type(::chat::UserListType value) {
-  
-  type_ = value;
+inline ::chat::PeerBatch* Request::_internal_mutable_peer_batch() {
+  if (!_internal_has_peer_batch()) {
+    clear_payload();
+    set_has_peer_batch();
+    _impl_.payload_.peer_batch_ = CreateMaybeMessage< ::chat::PeerBatch >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.peer_batch_;
 }
-inline void UserListResponse::set_type(::chat::UserListType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:chat.UserListResponse.type)
+inline ::chat::PeerBatch* Request::mutable_peer_batch() {
+  ::chat::PeerBatch* _msg = _internal_mutable_peer_batch();
+  // @@protoc_insertion_point(field_mutable:chat.Request.peer_batch)
+  return _msg;
 }
 
-// -------------------------------------------------------------------
-
-// UpdateStatusRequest
-
-// string username = 1;
-inline void UpdateStatusRequest::clear_username() {
-  username_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& UpdateStatusRequest::username() const {
-  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.username)
-  return _internal_username();
+inline bool Request::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
 }
-inline void UpdateStatusRequest::set_username(const std::string& value) {
-  _internal_set_username(value);
-  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.username)
+inline void Request::clear_has_payload() {
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
 }
-inline std::string* UpdateStatusRequest::mutable_username() {
-  // @@protoc_insertion_point(field_mutable:chat.UpdateStatusRequest.username)
-  return _internal_mutable_username();
+inline Request::PayloadCase Request::payload_case() const {
+  return Request::PayloadCase(_impl_._oneof_case_[0]);
 }
-inline const std::string& UpdateStatusRequest::_internal_username() const {
-  return username_.Get();
+// -------------------------------------------------------------------
+
+// Response
+
+// .chat.Operation operation = 1;
+inline void Response::clear_operation() {
+  _impl_.operation_ = 0;
 }
-inline void UpdateStatusRequest::_internal_set_username(const std::string& value) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline ::chat::Operation Response::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
 }
-inline void UpdateStatusRequest::set_username(std::string&& value) {
-  
-  username_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.UpdateStatusRequest.username)
+inline ::chat::Operation Response::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Response.operation)
+  return _internal_operation();
 }
-inline void UpdateStatusRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline void Response::_internal_set_operation(::chat::Operation value) {
   
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.UpdateStatusRequest.username)
+  _impl_.operation_ = value;
 }
-inline void UpdateStatusRequest::set_username(const char* value,
-    size_t size) {
-  
-  username_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.UpdateStatusRequest.username)
+inline void Response::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Response.operation)
 }
-inline std::string* UpdateStatusRequest::_internal_mutable_username() {
-  
-  return username_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+
+// .chat.StatusCode status_code = 2;
+inline void Response::clear_status_code() {
+  _impl_.status_code_ = 0;
 }
-inline std::string* UpdateStatusRequest::release_username() {
-  // @@protoc_insertion_point(field_release:chat.UpdateStatusRequest.username)
-  return username_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::chat::StatusCode Response::_internal_status_code() const {
+  return static_cast< ::chat::StatusCode >(_impl_.status_code_);
 }
-inline void UpdateStatusRequest::set_allocated_username(std::string* username) {
-  if (username != nullptr) {
-    
-  } else {
-    
-  }
-  username_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), username,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.UpdateStatusRequest.username)
+inline ::chat::StatusCode Response::status_code() const {
+  // @@protoc_insertion_point(field_get:chat.Response.status_code)
+  return _internal_status_code();
 }
-inline std::string* UpdateStatusRequest::unsafe_arena_release_username() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.UpdateStatusRequest.username)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline void Response::_internal_set_status_code(::chat::StatusCode value) {
   
-  return username_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.status_code_ = value;
 }
-inline void UpdateStatusRequest::unsafe_arena_set_allocated_username(
-    std::string* username) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (username != nullptr) {
-    
-  } else {
-    
-  }
-  username_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      username, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.UpdateStatusRequest.username)
+inline void Response::set_status_code(::chat::StatusCode value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:chat.Response.status_code)
 }
 
-// .chat.UserStatus new_status = 2;
-inline void UpdateStatusRequest::clear_new_status() {
-  new_status_ = 0;
-}
-inline ::chat::UserStatus UpdateStatusRequest::_internal_new_status() const {
-  return static_cast< ::chat::UserStatus >(new_status_);
-}
-inline ::chat::UserStatus UpdateStatusRequest::new_status() const {
-  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.new_status)
-  return _internal_new_status();
+// string message = 3;
+inline void Response::clear_message() {
+  _impl_.message_.ClearToEmpty();
 }
-inline void UpdateStatusRequest::_internal_set_new_status(::chat::UserStatus value) {
-  
-  new_status_ = value;
+inline const std::string& Response::message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message)
+  return _internal_message();
 }
-inline void UpdateStatusRequest::set_new_status(::chat::UserStatus value) {
-  _internal_set_new_status(value);
-  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.new_status)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.Response.message)
 }
-
-// -------------------------------------------------------------------
-
-// Request
-
-// .chat.Operation operation = 1;
-inline void Request::clear_operation() {
-  operation_ = 0;
+inline std::string* Response::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.message)
+  return _s;
 }
-inline ::chat::Operation Request::_internal_operation() const {
-  return static_cast< ::chat::Operation >(operation_);
+inline const std::string& Response::_internal_message() const {
+  return _impl_.message_.Get();
 }
-inline ::chat::Operation Request::operation() const {
-  // @@protoc_insertion_point(field_get:chat.Request.operation)
-  return _internal_operation();
+inline void Response::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
-inline void Request::_internal_set_operation(::chat::Operation value) {
+inline std::string* Response::_internal_mutable_message() {
   
-  operation_ = value;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
-inline void Request::set_operation(::chat::Operation value) {
-  _internal_set_operation(value);
-  // @@protoc_insertion_point(field_set:chat.Request.operation)
+inline std::string* Response::release_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.message)
+  return _impl_.message_.Release();
+}
+inline void Response::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.message)
 }
 
-// .chat.NewUserRequest register_user = 2;
-inline bool Request::_internal_has_register_user() const {
-  return payload_case() == kRegisterUser;
+// .chat.UserListResponse user_list = 4;
+inline bool Response::_internal_has_user_list() const {
+  return result_case() == kUserList;
 }
-inline bool Request::has_register_user() const {
-  return _internal_has_register_user();
+inline bool Response::has_user_list() const {
+  return _internal_has_user_list();
 }
-inline void Request::set_has_register_user() {
-  _oneof_case_[0] = kRegisterUser;
+inline void Response::set_has_user_list() {
+  _impl_._oneof_case_[0] = kUserList;
 }
-inline void Request::clear_register_user() {
-  if (_internal_has_register_user()) {
-    if (GetArena() == nullptr) {
-      delete payload_.register_user_;
+inline void Response::clear_user_list() {
+  if (_internal_has_user_list()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.user_list_;
     }
-    clear_has_payload();
+    clear_has_result();
   }
 }
-inline ::chat::NewUserRequest* Request::release_register_user() {
-  // @@protoc_insertion_point(field_release:chat.Request.register_user)
-  if (_internal_has_register_user()) {
-    clear_has_payload();
-      ::chat::NewUserRequest* temp = payload_.register_user_;
-    if (GetArena() != nullptr) {
+inline ::chat::UserListResponse* Response::release_user_list() {
+  // @@protoc_insertion_point(field_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    payload_.register_user_ = nullptr;
+    _impl_.result_.user_list_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::NewUserRequest& Request::_internal_register_user() const {
-  return _internal_has_register_user()
-      ? *payload_.register_user_
-      : *reinterpret_cast< ::chat::NewUserRequest*>(&::chat::_NewUserRequest_default_instance_);
+inline const ::chat::UserListResponse& Response::_internal_user_list() const {
+  return _internal_has_user_list()
+      ? *_impl_.result_.user_list_
+      : reinterpret_cast< ::chat::UserListResponse&>(::chat::_UserListResponse_default_instance_);
 }
-inline const ::chat::NewUserRequest& Request::register_user() const {
-  // @@protoc_insertion_point(field_get:chat.Request.register_user)
-  return _internal_register_user();
+inline const ::chat::UserListResponse& Response::user_list() const {
+  // @@protoc_insertion_point(field_get:chat.Response.user_list)
+  return _internal_user_list();
 }
-inline ::chat::NewUserRequest* Request::unsafe_arena_release_register_user() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.register_user)
-  if (_internal_has_register_user()) {
-    clear_has_payload();
-    ::chat::NewUserRequest* temp = payload_.register_user_;
-    payload_.register_user_ = nullptr;
+inline ::chat::UserListResponse* Response::unsafe_arena_release_user_list() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    _impl_.result_.user_list_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Request::unsafe_arena_set_allocated_register_user(::chat::NewUserRequest* register_user) {
-  clear_payload();
-  if (register_user) {
-    set_has_register_user();
-    payload_.register_user_ = register_user;
+inline void Response::unsafe_arena_set_allocated_user_list(::chat::UserListResponse* user_list) {
+  clear_result();
+  if (user_list) {
+    set_has_user_list();
+    _impl_.result_.user_list_ = user_list;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.register_user)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.user_list)
 }
-inline ::chat::NewUserRequest* Request::_internal_mutable_register_user() {
-  if (!_internal_has_register_user()) {
-    clear_payload();
-    set_has_register_user();
-    payload_.register_user_ = CreateMaybeMessage< ::chat::NewUserRequest >(GetArena());
+inline ::chat::UserListResponse* Response::_internal_mutable_user_list() {
+  if (!_internal_has_user_list()) {
+    clear_result();
+    set_has_user_list();
+    _impl_.result_.user_list_ = CreateMaybeMessage< ::chat::UserListResponse >(GetArenaForAllocation());
   }
-  return payload_.register_user_;
+  return _impl_.result_.user_list_;
 }
-inline ::chat::NewUserRequest* Request::mutable_register_user() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.register_user)
-  return _internal_mutable_register_user();
+inline ::chat::UserListResponse* Response::mutable_user_list() {
+  ::chat::UserListResponse* _msg = _internal_mutable_user_list();
+  // @@protoc_insertion_point(field_mutable:chat.Response.user_list)
+  return _msg;
 }
 
-// .chat.SendMessageRequest send_message = 3;
-inline bool Request::_internal_has_send_message() const {
-  return payload_case() == kSendMessage;
+// .chat.IncomingMessageResponse incoming_message = 5;
+inline bool Response::_internal_has_incoming_message() const {
+  return result_case() == kIncomingMessage;
 }
-inline bool Request::has_send_message() const {
-  return _internal_has_send_message();
+inline bool Response::has_incoming_message() const {
+  return _internal_has_incoming_message();
 }
-inline void Request::set_has_send_message() {
-  _oneof_case_[0] = kSendMessage;
+inline void Response::set_has_incoming_message() {
+  _impl_._oneof_case_[0] = kIncomingMessage;
 }
-inline void Request::clear_send_message() {
-  if (_internal_has_send_message()) {
-    if (GetArena() == nullptr) {
-      delete payload_.send_message_;
+inline void Response::clear_incoming_message() {
+  if (_internal_has_incoming_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.incoming_message_;
     }
-    clear_has_payload();
+    clear_has_result();
   }
 }
-inline ::chat::SendMessageRequest* Request::release_send_message() {
-  // @@protoc_insertion_point(field_release:chat.Request.send_message)
-  if (_internal_has_send_message()) {
-    clear_has_payload();
-      ::chat::SendMessageRequest* temp = payload_.send_message_;
-    if (GetArena() != nullptr) {
+inline ::chat::IncomingMessageResponse* Response::release_incoming_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    payload_.send_message_ = nullptr;
+    _impl_.result_.incoming_message_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::SendMessageRequest& Request::_internal_send_message() const {
-  return _internal_has_send_message()
-      ? *payload_.send_message_
-      : *reinterpret_cast< ::chat::SendMessageRequest*>(&::chat::_SendMessageRequest_default_instance_);
+inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_message() const {
+  return _internal_has_incoming_message()
+      ? *_impl_.result_.incoming_message_
+      : reinterpret_cast< ::chat::IncomingMessageResponse&>(::chat::_IncomingMessageResponse_default_instance_);
 }
-inline const ::chat::SendMessageRequest& Request::send_message() const {
-  // @@protoc_insertion_point(field_get:chat.Request.send_message)
-  return _internal_send_message();
+inline const ::chat::IncomingMessageResponse& Response::incoming_message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.incoming_message)
+  return _internal_incoming_message();
 }
-inline ::chat::SendMessageRequest* Request::unsafe_arena_release_send_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message)
-  if (_internal_has_send_message()) {
-    clear_has_payload();
-    ::chat::SendMessageRequest* temp = payload_.send_message_;
-    payload_.send_message_ = nullptr;
+inline ::chat::IncomingMessageResponse* Response::unsafe_arena_release_incoming_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    _impl_.result_.incoming_message_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Request::unsafe_arena_set_allocated_send_message(::chat::SendMessageRequest* send_message) {
-  clear_payload();
-  if (send_message) {
-    set_has_send_message();
-    payload_.send_message_ = send_message;
+inline void Response::unsafe_arena_set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+  clear_result();
+  if (incoming_message) {
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = incoming_message;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.incoming_message)
 }
-inline ::chat::SendMessageRequest* Request::_internal_mutable_send_message() {
-  if (!_internal_has_send_message()) {
-    clear_payload();
-    set_has_send_message();
-    payload_.send_message_ = CreateMaybeMessage< ::chat::SendMessageRequest >(GetArena());
+inline ::chat::IncomingMessageResponse* Response::_internal_mutable_incoming_message() {
+  if (!_internal_has_incoming_message()) {
+    clear_result();
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = CreateMaybeMessage< ::chat::IncomingMessageResponse >(GetArenaForAllocation());
   }
-  return payload_.send_message_;
+  return _impl_.result_.incoming_message_;
 }
-inline ::chat::SendMessageRequest* Request::mutable_send_message() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.send_message)
-  return _internal_mutable_send_message();
+inline ::chat::IncomingMessageResponse* Response::mutable_incoming_message() {
+  ::chat::IncomingMessageResponse* _msg = _internal_mutable_incoming_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_message)
+  return _msg;
 }
 
-// .chat.UpdateStatusRequest update_status = 4;
-inline bool Request::_internal_has_update_status() const {
-  return payload_case() == kUpdateStatus;
+// .chat.DeliveryReceipt delivery_receipt = 6;
+inline bool Response::_internal_has_delivery_receipt() const {
+  return result_case() == kDeliveryReceipt;
 }
-inline bool Request::has_update_status() const {
-  return _internal_has_update_status();
+inline bool Response::has_delivery_receipt() const {
+  return _internal_has_delivery_receipt();
 }
-inline void Request::set_has_update_status() {
-  _oneof_case_[0] = kUpdateStatus;
+inline void Response::set_has_delivery_receipt() {
+  _impl_._oneof_case_[0] = kDeliveryReceipt;
 }
-inline void Request::clear_update_status() {
-  if (_internal_has_update_status()) {
-    if (GetArena() == nullptr) {
-      delete payload_.update_status_;
+inline void Response::clear_delivery_receipt() {
+  if (_internal_has_delivery_receipt()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.delivery_receipt_;
     }
-    clear_has_payload();
+    clear_has_result();
   }
 }
-inline ::chat::UpdateStatusRequest* Request::release_update_status() {
-  // @@protoc_insertion_point(field_release:chat.Request.update_status)
-  if (_internal_has_update_status()) {
-    clear_has_payload();
-      ::chat::UpdateStatusRequest* temp = payload_.update_status_;
-    if (GetArena() != nullptr) {
+inline ::chat::DeliveryReceipt* Response::release_delivery_receipt() {
+  // @@protoc_insertion_point(field_release:chat.Response.delivery_receipt)
+  if (_internal_has_delivery_receipt()) {
+    clear_has_result();
+    ::chat::DeliveryReceipt* temp = _impl_.result_.delivery_receipt_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    payload_.update_status_ = nullptr;
+    _impl_.result_.delivery_receipt_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::UpdateStatusRequest& Request::_internal_update_status() const {
-  return _internal_has_update_status()
-      ? *payload_.update_status_
-      : *reinterpret_cast< ::chat::UpdateStatusRequest*>(&::chat::_UpdateStatusRequest_default_instance_);
+inline const ::chat::DeliveryReceipt& Response::_internal_delivery_receipt() const {
+  return _internal_has_delivery_receipt()
+      ? *_impl_.result_.delivery_receipt_
+      : reinterpret_cast< ::chat::DeliveryReceipt&>(::chat::_DeliveryReceipt_default_instance_);
 }
-inline const ::chat::UpdateStatusRequest& Request::update_status() const {
-  // @@protoc_insertion_point(field_get:chat.Request.update_status)
-  return _internal_update_status();
+inline const ::chat::DeliveryReceipt& Response::delivery_receipt() const {
+  // @@protoc_insertion_point(field_get:chat.Response.delivery_receipt)
+  return _internal_delivery_receipt();
 }
-inline ::chat::UpdateStatusRequest* Request::unsafe_arena_release_update_status() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.update_status)
-  if (_internal_has_update_status()) {
-    clear_has_payload();
-    ::chat::UpdateStatusRequest* temp = payload_.update_status_;
-    payload_.update_status_ = nullptr;
+inline ::chat::DeliveryReceipt* Response::unsafe_arena_release_delivery_receipt() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.delivery_receipt)
+  if (_internal_has_delivery_receipt()) {
+    clear_has_result();
+    ::chat::DeliveryReceipt* temp = _impl_.result_.delivery_receipt_;
+    _impl_.result_.delivery_receipt_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Request::unsafe_arena_set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
-  clear_payload();
-  if (update_status) {
-    set_has_update_status();
-    payload_.update_status_ = update_status;
+inline void Response::unsafe_arena_set_allocated_delivery_receipt(::chat::DeliveryReceipt* delivery_receipt) {
+  clear_result();
+  if (delivery_receipt) {
+    set_has_delivery_receipt();
+    _impl_.result_.delivery_receipt_ = delivery_receipt;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.update_status)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.delivery_receipt)
 }
-inline ::chat::UpdateStatusRequest* Request::_internal_mutable_update_status() {
-  if (!_internal_has_update_status()) {
-    clear_payload();
-    set_has_update_status();
-    payload_.update_status_ = CreateMaybeMessage< ::chat::UpdateStatusRequest >(GetArena());
+inline ::chat::DeliveryReceipt* Response::_internal_mutable_delivery_receipt() {
+  if (!_internal_has_delivery_receipt()) {
+    clear_result();
+    set_has_delivery_receipt();
+    _impl_.result_.delivery_receipt_ = CreateMaybeMessage< ::chat::DeliveryReceipt >(GetArenaForAllocation());
   }
-  return payload_.update_status_;
+  return _impl_.result_.delivery_receipt_;
 }
-inline ::chat::UpdateStatusRequest* Request::mutable_update_status() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.update_status)
-  return _internal_mutable_update_status();
+inline ::chat::DeliveryReceipt* Response::mutable_delivery_receipt() {
+  ::chat::DeliveryReceipt* _msg = _internal_mutable_delivery_receipt();
+  // @@protoc_insertion_point(field_mutable:chat.Response.delivery_receipt)
+  return _msg;
 }
 
-// .chat.UserListRequest get_users = 5;
-inline bool Request::_internal_has_get_users() const {
-  return payload_case() == kGetUsers;
+// .chat.PresenceUpdate presence = 8;
+inline bool Response::_internal_has_presence() const {
+  return result_case() == kPresence;
 }
-inline bool Request::has_get_users() const {
-  return _internal_has_get_users();
+inline bool Response::has_presence() const {
+  return _internal_has_presence();
 }
-inline void Request::set_has_get_users() {
-  _oneof_case_[0] = kGetUsers;
+inline void Response::set_has_presence() {
+  _impl_._oneof_case_[0] = kPresence;
 }
-inline void Request::clear_get_users() {
-  if (_internal_has_get_users()) {
-    if (GetArena() == nullptr) {
-      delete payload_.get_users_;
+inline void Response::clear_presence() {
+  if (_internal_has_presence()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.presence_;
     }
-    clear_has_payload();
+    clear_has_result();
   }
 }
-inline ::chat::UserListRequest* Request::release_get_users() {
-  // @@protoc_insertion_point(field_release:chat.Request.get_users)
-  if (_internal_has_get_users()) {
-    clear_has_payload();
-      ::chat::UserListRequest* temp = payload_.get_users_;
-    if (GetArena() != nullptr) {
+inline ::chat::PresenceUpdate* Response::release_presence() {
+  // @@protoc_insertion_point(field_release:chat.Response.presence)
+  if (_internal_has_presence()) {
+    clear_has_result();
+    ::chat::PresenceUpdate* temp = _impl_.result_.presence_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    payload_.get_users_ = nullptr;
+    _impl_.result_.presence_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::UserListRequest& Request::_internal_get_users() const {
-  return _internal_has_get_users()
-      ? *payload_.get_users_
-      : *reinterpret_cast< ::chat::UserListRequest*>(&::chat::_UserListRequest_default_instance_);
+inline const ::chat::PresenceUpdate& Response::_internal_presence() const {
+  return _internal_has_presence()
+      ? *_impl_.result_.presence_
+      : reinterpret_cast< ::chat::PresenceUpdate&>(::chat::_PresenceUpdate_default_instance_);
 }
-inline const ::chat::UserListRequest& Request::get_users() const {
-  // @@protoc_insertion_point(field_get:chat.Request.get_users)
-  return _internal_get_users();
+inline const ::chat::PresenceUpdate& Response::presence() const {
+  // @@protoc_insertion_point(field_get:chat.Response.presence)
+  return _internal_presence();
 }
-inline ::chat::UserListRequest* Request::unsafe_arena_release_get_users() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_users)
-  if (_internal_has_get_users()) {
-    clear_has_payload();
-    ::chat::UserListRequest* temp = payload_.get_users_;
-    payload_.get_users_ = nullptr;
+inline ::chat::PresenceUpdate* Response::unsafe_arena_release_presence() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.presence)
+  if (_internal_has_presence()) {
+    clear_has_result();
+    ::chat::PresenceUpdate* temp = _impl_.result_.presence_;
+    _impl_.result_.presence_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Request::unsafe_arena_set_allocated_get_users(::chat::UserListRequest* get_users) {
-  clear_payload();
-  if (get_users) {
-    set_has_get_users();
-    payload_.get_users_ = get_users;
+inline void Response::unsafe_arena_set_allocated_presence(::chat::PresenceUpdate* presence) {
+  clear_result();
+  if (presence) {
+    set_has_presence();
+    _impl_.result_.presence_ = presence;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_users)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.presence)
 }
-inline ::chat::UserListRequest* Request::_internal_mutable_get_users() {
-  if (!_internal_has_get_users()) {
-    clear_payload();
-    set_has_get_users();
-    payload_.get_users_ = CreateMaybeMessage< ::chat::UserListRequest >(GetArena());
+inline ::chat::PresenceUpdate* Response::_internal_mutable_presence() {
+  if (!_internal_has_presence()) {
+    clear_result();
+    set_has_presence();
+    _impl_.result_.presence_ = CreateMaybeMessage< ::chat::PresenceUpdate >(GetArenaForAllocation());
   }
-  return payload_.get_users_;
+  return _impl_.result_.presence_;
 }
-inline ::chat::UserListRequest* Request::mutable_get_users() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.get_users)
-  return _internal_mutable_get_users();
+inline ::chat::PresenceUpdate* Response::mutable_presence() {
+  ::chat::PresenceUpdate* _msg = _internal_mutable_presence();
+  // @@protoc_insertion_point(field_mutable:chat.Response.presence)
+  return _msg;
 }
 
-// .chat.User unregister_user = 6;
-inline bool Request::_internal_has_unregister_user() const {
-  return payload_case() == kUnregisterUser;
+// .chat.TransferStart transfer_start = 10;
+inline bool Response::_internal_has_transfer_start() const {
+  return result_case() == kTransferStart;
 }
-inline bool Request::has_unregister_user() const {
-  return _internal_has_unregister_user();
+inline bool Response::has_transfer_start() const {
+  return _internal_has_transfer_start();
 }
-inline void Request::set_has_unregister_user() {
-  _oneof_case_[0] = kUnregisterUser;
+inline void Response::set_has_transfer_start() {
+  _impl_._oneof_case_[0] = kTransferStart;
 }
-inline void Request::clear_unregister_user() {
-  if (_internal_has_unregister_user()) {
-    if (GetArena() == nullptr) {
-      delete payload_.unregister_user_;
+inline void Response::clear_transfer_start() {
+  if (_internal_has_transfer_start()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.transfer_start_;
     }
-    clear_has_payload();
-  }
-}
-inline ::chat::User* Request::release_unregister_user() {
-  // @@protoc_insertion_point(field_release:chat.Request.unregister_user)
-  if (_internal_has_unregister_user()) {
-    clear_has_payload();
-      ::chat::User* temp = payload_.unregister_user_;
-    if (GetArena() != nullptr) {
+    clear_has_result();
+  }
+}
+inline ::chat::TransferStart* Response::release_transfer_start() {
+  // @@protoc_insertion_point(field_release:chat.Response.transfer_start)
+  if (_internal_has_transfer_start()) {
+    clear_has_result();
+    ::chat::TransferStart* temp = _impl_.result_.transfer_start_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    payload_.unregister_user_ = nullptr;
+    _impl_.result_.transfer_start_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::User& Request::_internal_unregister_user() const {
-  return _internal_has_unregister_user()
-      ? *payload_.unregister_user_
-      : *reinterpret_cast< ::chat::User*>(&::chat::_User_default_instance_);
+inline const ::chat::TransferStart& Response::_internal_transfer_start() const {
+  return _internal_has_transfer_start()
+      ? *_impl_.result_.transfer_start_
+      : reinterpret_cast< ::chat::TransferStart&>(::chat::_TransferStart_default_instance_);
 }
-inline const ::chat::User& Request::unregister_user() const {
-  // @@protoc_insertion_point(field_get:chat.Request.unregister_user)
-  return _internal_unregister_user();
+inline const ::chat::TransferStart& Response::transfer_start() const {
+  // @@protoc_insertion_point(field_get:chat.Response.transfer_start)
+  return _internal_transfer_start();
 }
-inline ::chat::User* Request::unsafe_arena_release_unregister_user() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.unregister_user)
-  if (_internal_has_unregister_user()) {
-    clear_has_payload();
-    ::chat::User* temp = payload_.unregister_user_;
-    payload_.unregister_user_ = nullptr;
+inline ::chat::TransferStart* Response::unsafe_arena_release_transfer_start() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.transfer_start)
+  if (_internal_has_transfer_start()) {
+    clear_has_result();
+    ::chat::TransferStart* temp = _impl_.result_.transfer_start_;
+    _impl_.result_.transfer_start_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Request::unsafe_arena_set_allocated_unregister_user(::chat::User* unregister_user) {
-  clear_payload();
-  if (unregister_user) {
-    set_has_unregister_user();
-    payload_.unregister_user_ = unregister_user;
+inline void Response::unsafe_arena_set_allocated_transfer_start(::chat::TransferStart* transfer_start) {
+  clear_result();
+  if (transfer_start) {
+    set_has_transfer_start();
+    _impl_.result_.transfer_start_ = transfer_start;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.unregister_user)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.transfer_start)
 }
-inline ::chat::User* Request::_internal_mutable_unregister_user() {
-  if (!_internal_has_unregister_user()) {
-    clear_payload();
-    set_has_unregister_user();
-    payload_.unregister_user_ = CreateMaybeMessage< ::chat::User >(GetArena());
+inline ::chat::TransferStart* Response::_internal_mutable_transfer_start() {
+  if (!_internal_has_transfer_start()) {
+    clear_result();
+    set_has_transfer_start();
+    _impl_.result_.transfer_start_ = CreateMaybeMessage< ::chat::TransferStart >(GetArenaForAllocation());
   }
-  return payload_.unregister_user_;
+  return _impl_.result_.transfer_start_;
 }
-inline ::chat::User* Request::mutable_unregister_user() {
-  // @@protoc_insertion_point(field_mutable:chat.Request.unregister_user)
-  return _internal_mutable_unregister_user();
+inline ::chat::TransferStart* Response::mutable_transfer_start() {
+  ::chat::TransferStart* _msg = _internal_mutable_transfer_start();
+  // @@protoc_insertion_point(field_mutable:chat.Response.transfer_start)
+  return _msg;
 }
 
-inline bool Request::has_payload() const {
-  return payload_case() != PAYLOAD_NOT_SET;
-}
-inline void Request::clear_has_payload() {
-  _oneof_case_[0] = PAYLOAD_NOT_SET;
-}
-inline Request::PayloadCase Request::payload_case() const {
-  return Request::PayloadCase(_oneof_case_[0]);
+// .chat.TransferChunk transfer_chunk = 11;
+inline bool Response::_internal_has_transfer_chunk() const {
+  return result_case() == kTransferChunk;
 }
-// -------------------------------------------------------------------
-
-// Response
-
-// .chat.Operation operation = 1;
-inline void Response::clear_operation() {
-  operation_ = 0;
+inline bool Response::has_transfer_chunk() const {
+  return _internal_has_transfer_chunk();
 }
-inline ::chat::Operation Response::_internal_operation() const {
-  return static_cast< ::chat::Operation >(operation_);
+inline void Response::set_has_transfer_chunk() {
+  _impl_._oneof_case_[0] = kTransferChunk;
 }
-inline ::chat::Operation Response::operation() const {
-  // @@protoc_insertion_point(field_get:chat.Response.operation)
-  return _internal_operation();
+inline void Response::clear_transfer_chunk() {
+  if (_internal_has_transfer_chunk()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.transfer_chunk_;
+    }
+    clear_has_result();
+  }
 }
-inline void Response::_internal_set_operation(::chat::Operation value) {
-  
-  operation_ = value;
+inline ::chat::TransferChunk* Response::release_transfer_chunk() {
+  // @@protoc_insertion_point(field_release:chat.Response.transfer_chunk)
+  if (_internal_has_transfer_chunk()) {
+    clear_has_result();
+    ::chat::TransferChunk* temp = _impl_.result_.transfer_chunk_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.transfer_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void Response::set_operation(::chat::Operation value) {
-  _internal_set_operation(value);
-  // @@protoc_insertion_point(field_set:chat.Response.operation)
+inline const ::chat::TransferChunk& Response::_internal_transfer_chunk() const {
+  return _internal_has_transfer_chunk()
+      ? *_impl_.result_.transfer_chunk_
+      : reinterpret_cast< ::chat::TransferChunk&>(::chat::_TransferChunk_default_instance_);
 }
-
-// .chat.StatusCode status_code = 2;
-inline void Response::clear_status_code() {
-  status_code_ = 0;
+inline const ::chat::TransferChunk& Response::transfer_chunk() const {
+  // @@protoc_insertion_point(field_get:chat.Response.transfer_chunk)
+  return _internal_transfer_chunk();
 }
-inline ::chat::StatusCode Response::_internal_status_code() const {
-  return static_cast< ::chat::StatusCode >(status_code_);
+inline ::chat::TransferChunk* Response::unsafe_arena_release_transfer_chunk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.transfer_chunk)
+  if (_internal_has_transfer_chunk()) {
+    clear_has_result();
+    ::chat::TransferChunk* temp = _impl_.result_.transfer_chunk_;
+    _impl_.result_.transfer_chunk_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::chat::StatusCode Response::status_code() const {
-  // @@protoc_insertion_point(field_get:chat.Response.status_code)
-  return _internal_status_code();
+inline void Response::unsafe_arena_set_allocated_transfer_chunk(::chat::TransferChunk* transfer_chunk) {
+  clear_result();
+  if (transfer_chunk) {
+    set_has_transfer_chunk();
+    _impl_.result_.transfer_chunk_ = transfer_chunk;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.transfer_chunk)
 }
-inline void Response::_internal_set_status_code(::chat::StatusCode value) {
-  
-  status_code_ = value;
+inline ::chat::TransferChunk* Response::_internal_mutable_transfer_chunk() {
+  if (!_internal_has_transfer_chunk()) {
+    clear_result();
+    set_has_transfer_chunk();
+    _impl_.result_.transfer_chunk_ = CreateMaybeMessage< ::chat::TransferChunk >(GetArenaForAllocation());
+  }
+  return _impl_.result_.transfer_chunk_;
 }
-inline void Response::set_status_code(::chat::StatusCode value) {
-  _internal_set_status_code(value);
-  // @@protoc_insertion_point(field_set:chat.Response.status_code)
+inline ::chat::TransferChunk* Response::mutable_transfer_chunk() {
+  ::chat::TransferChunk* _msg = _internal_mutable_transfer_chunk();
+  // @@protoc_insertion_point(field_mutable:chat.Response.transfer_chunk)
+  return _msg;
 }
 
-// string message = 3;
-inline void Response::clear_message() {
-  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Response::message() const {
-  // @@protoc_insertion_point(field_get:chat.Response.message)
-  return _internal_message();
-}
-inline void Response::set_message(const std::string& value) {
-  _internal_set_message(value);
-  // @@protoc_insertion_point(field_set:chat.Response.message)
-}
-inline std::string* Response::mutable_message() {
-  // @@protoc_insertion_point(field_mutable:chat.Response.message)
-  return _internal_mutable_message();
-}
-inline const std::string& Response::_internal_message() const {
-  return message_.Get();
+// .chat.TransferCredit transfer_credit = 12;
+inline bool Response::_internal_has_transfer_credit() const {
+  return result_case() == kTransferCredit;
 }
-inline void Response::_internal_set_message(const std::string& value) {
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline bool Response::has_transfer_credit() const {
+  return _internal_has_transfer_credit();
 }
-inline void Response::set_message(std::string&& value) {
-  
-  message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:chat.Response.message)
+inline void Response::set_has_transfer_credit() {
+  _impl_._oneof_case_[0] = kTransferCredit;
 }
-inline void Response::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:chat.Response.message)
+inline void Response::clear_transfer_credit() {
+  if (_internal_has_transfer_credit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.transfer_credit_;
+    }
+    clear_has_result();
+  }
 }
-inline void Response::set_message(const char* value,
-    size_t size) {
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:chat.Response.message)
+inline ::chat::TransferCredit* Response::release_transfer_credit() {
+  // @@protoc_insertion_point(field_release:chat.Response.transfer_credit)
+  if (_internal_has_transfer_credit()) {
+    clear_has_result();
+    ::chat::TransferCredit* temp = _impl_.result_.transfer_credit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.transfer_credit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline std::string* Response::_internal_mutable_message() {
-  
-  return message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::chat::TransferCredit& Response::_internal_transfer_credit() const {
+  return _internal_has_transfer_credit()
+      ? *_impl_.result_.transfer_credit_
+      : reinterpret_cast< ::chat::TransferCredit&>(::chat::_TransferCredit_default_instance_);
 }
-inline std::string* Response::release_message() {
-  // @@protoc_insertion_point(field_release:chat.Response.message)
-  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::chat::TransferCredit& Response::transfer_credit() const {
+  // @@protoc_insertion_point(field_get:chat.Response.transfer_credit)
+  return _internal_transfer_credit();
 }
-inline void Response::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
-    
+inline ::chat::TransferCredit* Response::unsafe_arena_release_transfer_credit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.transfer_credit)
+  if (_internal_has_transfer_credit()) {
+    clear_has_result();
+    ::chat::TransferCredit* temp = _impl_.result_.transfer_credit_;
+    _impl_.result_.transfer_credit_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:chat.Response.message)
 }
-inline std::string* Response::unsafe_arena_release_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.message)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return message_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline void Response::unsafe_arena_set_allocated_transfer_credit(::chat::TransferCredit* transfer_credit) {
+  clear_result();
+  if (transfer_credit) {
+    set_has_transfer_credit();
+    _impl_.result_.transfer_credit_ = transfer_credit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.transfer_credit)
 }
-inline void Response::unsafe_arena_set_allocated_message(
-    std::string* message) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (message != nullptr) {
-    
-  } else {
-    
+inline ::chat::TransferCredit* Response::_internal_mutable_transfer_credit() {
+  if (!_internal_has_transfer_credit()) {
+    clear_result();
+    set_has_transfer_credit();
+    _impl_.result_.transfer_credit_ = CreateMaybeMessage< ::chat::TransferCredit >(GetArenaForAllocation());
   }
-  message_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      message, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.message)
+  return _impl_.result_.transfer_credit_;
+}
+inline ::chat::TransferCredit* Response::mutable_transfer_credit() {
+  ::chat::TransferCredit* _msg = _internal_mutable_transfer_credit();
+  // @@protoc_insertion_point(field_mutable:chat.Response.transfer_credit)
+  return _msg;
 }
 
-// .chat.UserListResponse user_list = 4;
-inline bool Response::_internal_has_user_list() const {
-  return result_case() == kUserList;
+// .chat.ServerShutdown server_shutdown = 13;
+inline bool Response::_internal_has_server_shutdown() const {
+  return result_case() == kServerShutdown;
 }
-inline bool Response::has_user_list() const {
-  return _internal_has_user_list();
+inline bool Response::has_server_shutdown() const {
+  return _internal_has_server_shutdown();
 }
-inline void Response::set_has_user_list() {
-  _oneof_case_[0] = kUserList;
+inline void Response::set_has_server_shutdown() {
+  _impl_._oneof_case_[0] = kServerShutdown;
 }
-inline void Response::clear_user_list() {
-  if (_internal_has_user_list()) {
-    if (GetArena() == nullptr) {
-      delete result_.user_list_;
+inline void Response::clear_server_shutdown() {
+  if (_internal_has_server_shutdown()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.server_shutdown_;
     }
     clear_has_result();
   }
 }
-inline ::chat::UserListResponse* Response::release_user_list() {
-  // @@protoc_insertion_point(field_release:chat.Response.user_list)
-  if (_internal_has_user_list()) {
+inline ::chat::ServerShutdown* Response::release_server_shutdown() {
+  // @@protoc_insertion_point(field_release:chat.Response.server_shutdown)
+  if (_internal_has_server_shutdown()) {
     clear_has_result();
-      ::chat::UserListResponse* temp = result_.user_list_;
-    if (GetArena() != nullptr) {
+    ::chat::ServerShutdown* temp = _impl_.result_.server_shutdown_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    result_.user_list_ = nullptr;
+    _impl_.result_.server_shutdown_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::UserListResponse& Response::_internal_user_list() const {
-  return _internal_has_user_list()
-      ? *result_.user_list_
-      : *reinterpret_cast< ::chat::UserListResponse*>(&::chat::_UserListResponse_default_instance_);
+inline const ::chat::ServerShutdown& Response::_internal_server_shutdown() const {
+  return _internal_has_server_shutdown()
+      ? *_impl_.result_.server_shutdown_
+      : reinterpret_cast< ::chat::ServerShutdown&>(::chat::_ServerShutdown_default_instance_);
 }
-inline const ::chat::UserListResponse& Response::user_list() const {
-  // @@protoc_insertion_point(field_get:chat.Response.user_list)
-  return _internal_user_list();
+inline const ::chat::ServerShutdown& Response::server_shutdown() const {
+  // @@protoc_insertion_point(field_get:chat.Response.server_shutdown)
+  return _internal_server_shutdown();
 }
-inline ::chat::UserListResponse* Response::unsafe_arena_release_user_list() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.user_list)
-  if (_internal_has_user_list()) {
+inline ::chat::ServerShutdown* Response::unsafe_arena_release_server_shutdown() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.server_shutdown)
+  if (_internal_has_server_shutdown()) {
     clear_has_result();
-    ::chat::UserListResponse* temp = result_.user_list_;
-    result_.user_list_ = nullptr;
+    ::chat::ServerShutdown* temp = _impl_.result_.server_shutdown_;
+    _impl_.result_.server_shutdown_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Response::unsafe_arena_set_allocated_user_list(::chat::UserListResponse* user_list) {
+inline void Response::unsafe_arena_set_allocated_server_shutdown(::chat::ServerShutdown* server_shutdown) {
   clear_result();
-  if (user_list) {
-    set_has_user_list();
-    result_.user_list_ = user_list;
+  if (server_shutdown) {
+    set_has_server_shutdown();
+    _impl_.result_.server_shutdown_ = server_shutdown;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.user_list)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.server_shutdown)
 }
-inline ::chat::UserListResponse* Response::_internal_mutable_user_list() {
-  if (!_internal_has_user_list()) {
+inline ::chat::ServerShutdown* Response::_internal_mutable_server_shutdown() {
+  if (!_internal_has_server_shutdown()) {
     clear_result();
-    set_has_user_list();
-    result_.user_list_ = CreateMaybeMessage< ::chat::UserListResponse >(GetArena());
+    set_has_server_shutdown();
+    _impl_.result_.server_shutdown_ = CreateMaybeMessage< ::chat::ServerShutdown >(GetArenaForAllocation());
   }
-  return result_.user_list_;
+  return _impl_.result_.server_shutdown_;
 }
-inline ::chat::UserListResponse* Response::mutable_user_list() {
-  // @@protoc_insertion_point(field_mutable:chat.Response.user_list)
-  return _internal_mutable_user_list();
+inline ::chat::ServerShutdown* Response::mutable_server_shutdown() {
+  ::chat::ServerShutdown* _msg = _internal_mutable_server_shutdown();
+  // @@protoc_insertion_point(field_mutable:chat.Response.server_shutdown)
+  return _msg;
 }
 
-// .chat.IncomingMessageResponse incoming_message = 5;
-inline bool Response::_internal_has_incoming_message() const {
-  return result_case() == kIncomingMessage;
+// .chat.GossipUpdate gossip = 15;
+inline bool Response::_internal_has_gossip() const {
+  return result_case() == kGossip;
 }
-inline bool Response::has_incoming_message() const {
-  return _internal_has_incoming_message();
+inline bool Response::has_gossip() const {
+  return _internal_has_gossip();
 }
-inline void Response::set_has_incoming_message() {
-  _oneof_case_[0] = kIncomingMessage;
+inline void Response::set_has_gossip() {
+  _impl_._oneof_case_[0] = kGossip;
 }
-inline void Response::clear_incoming_message() {
-  if (_internal_has_incoming_message()) {
-    if (GetArena() == nullptr) {
-      delete result_.incoming_message_;
+inline void Response::clear_gossip() {
+  if (_internal_has_gossip()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.gossip_;
     }
     clear_has_result();
   }
 }
-inline ::chat::IncomingMessageResponse* Response::release_incoming_message() {
-  // @@protoc_insertion_point(field_release:chat.Response.incoming_message)
-  if (_internal_has_incoming_message()) {
+inline ::chat::GossipUpdate* Response::release_gossip() {
+  // @@protoc_insertion_point(field_release:chat.Response.gossip)
+  if (_internal_has_gossip()) {
     clear_has_result();
-      ::chat::IncomingMessageResponse* temp = result_.incoming_message_;
-    if (GetArena() != nullptr) {
+    ::chat::GossipUpdate* temp = _impl_.result_.gossip_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    result_.incoming_message_ = nullptr;
+    _impl_.result_.gossip_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_message() const {
-  return _internal_has_incoming_message()
-      ? *result_.incoming_message_
-      : *reinterpret_cast< ::chat::IncomingMessageResponse*>(&::chat::_IncomingMessageResponse_default_instance_);
+inline const ::chat::GossipUpdate& Response::_internal_gossip() const {
+  return _internal_has_gossip()
+      ? *_impl_.result_.gossip_
+      : reinterpret_cast< ::chat::GossipUpdate&>(::chat::_GossipUpdate_default_instance_);
 }
-inline const ::chat::IncomingMessageResponse& Response::incoming_message() const {
-  // @@protoc_insertion_point(field_get:chat.Response.incoming_message)
-  return _internal_incoming_message();
+inline const ::chat::GossipUpdate& Response::gossip() const {
+  // @@protoc_insertion_point(field_get:chat.Response.gossip)
+  return _internal_gossip();
 }
-inline ::chat::IncomingMessageResponse* Response::unsafe_arena_release_incoming_message() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.incoming_message)
-  if (_internal_has_incoming_message()) {
+inline ::chat::GossipUpdate* Response::unsafe_arena_release_gossip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.gossip)
+  if (_internal_has_gossip()) {
     clear_has_result();
-    ::chat::IncomingMessageResponse* temp = result_.incoming_message_;
-    result_.incoming_message_ = nullptr;
+    ::chat::GossipUpdate* temp = _impl_.result_.gossip_;
+    _impl_.result_.gossip_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Response::unsafe_arena_set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+inline void Response::unsafe_arena_set_allocated_gossip(::chat::GossipUpdate* gossip) {
   clear_result();
-  if (incoming_message) {
-    set_has_incoming_message();
-    result_.incoming_message_ = incoming_message;
+  if (gossip) {
+    set_has_gossip();
+    _impl_.result_.gossip_ = gossip;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.incoming_message)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.gossip)
 }
-inline ::chat::IncomingMessageResponse* Response::_internal_mutable_incoming_message() {
-  if (!_internal_has_incoming_message()) {
+inline ::chat::GossipUpdate* Response::_internal_mutable_gossip() {
+  if (!_internal_has_gossip()) {
     clear_result();
-    set_has_incoming_message();
-    result_.incoming_message_ = CreateMaybeMessage< ::chat::IncomingMessageResponse >(GetArena());
+    set_has_gossip();
+    _impl_.result_.gossip_ = CreateMaybeMessage< ::chat::GossipUpdate >(GetArenaForAllocation());
   }
-  return result_.incoming_message_;
+  return _impl_.result_.gossip_;
 }
-inline ::chat::IncomingMessageResponse* Response::mutable_incoming_message() {
-  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_message)
-  return _internal_mutable_incoming_message();
+inline ::chat::GossipUpdate* Response::mutable_gossip() {
+  ::chat::GossipUpdate* _msg = _internal_mutable_gossip();
+  // @@protoc_insertion_point(field_mutable:chat.Response.gossip)
+  return _msg;
+}
+
+// uint64 message_id = 7;
+inline void Response::clear_message_id() {
+  _impl_.message_id_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_message_id() const {
+  return _impl_.message_id_;
+}
+inline uint64_t Response::message_id() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message_id)
+  return _internal_message_id();
+}
+inline void Response::_internal_set_message_id(uint64_t value) {
+  
+  _impl_.message_id_ = value;
+}
+inline void Response::set_message_id(uint64_t value) {
+  _internal_set_message_id(value);
+  // @@protoc_insertion_point(field_set:chat.Response.message_id)
+}
+
+// .chat.Codec codec = 9;
+inline void Response::clear_codec() {
+  _impl_.codec_ = 0;
+}
+inline ::chat::Codec Response::_internal_codec() const {
+  return static_cast< ::chat::Codec >(_impl_.codec_);
+}
+inline ::chat::Codec Response::codec() const {
+  // @@protoc_insertion_point(field_get:chat.Response.codec)
+  return _internal_codec();
+}
+inline void Response::_internal_set_codec(::chat::Codec value) {
+  
+  _impl_.codec_ = value;
+}
+inline void Response::set_codec(::chat::Codec value) {
+  _internal_set_codec(value);
+  // @@protoc_insertion_point(field_set:chat.Response.codec)
+}
+
+// string redirect = 14;
+inline void Response::clear_redirect() {
+  _impl_.redirect_.ClearToEmpty();
+}
+inline const std::string& Response::redirect() const {
+  // @@protoc_insertion_point(field_get:chat.Response.redirect)
+  return _internal_redirect();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_redirect(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.redirect_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.Response.redirect)
+}
+inline std::string* Response::mutable_redirect() {
+  std::string* _s = _internal_mutable_redirect();
+  // @@protoc_insertion_point(field_mutable:chat.Response.redirect)
+  return _s;
+}
+inline const std::string& Response::_internal_redirect() const {
+  return _impl_.redirect_.Get();
+}
+inline void Response::_internal_set_redirect(const std::string& value) {
+  
+  _impl_.redirect_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_redirect() {
+  
+  return _impl_.redirect_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_redirect() {
+  // @@protoc_insertion_point(field_release:chat.Response.redirect)
+  return _impl_.redirect_.Release();
+}
+inline void Response::set_allocated_redirect(std::string* redirect) {
+  if (redirect != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.redirect_.SetAllocated(redirect, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.redirect_.IsDefault()) {
+    _impl_.redirect_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.redirect)
 }
 
 inline bool Response::has_result() const {
   return result_case() != RESULT_NOT_SET;
 }
 inline void Response::clear_has_result() {
-  _oneof_case_[0] = RESULT_NOT_SET;
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
 }
 inline Response::ResultCase Response::result_case() const {
-  return Response::ResultCase(_oneof_case_[0]);
+  return Response::ResultCase(_impl_._oneof_case_[0]);
 }
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
@@ -3384,6 +10890,42 @@ inline Response::ResultCase Response::result_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3396,6 +10938,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserStatus>() {
   return ::chat::UserStatus_descriptor();
 }
+template <> struct is_proto_enum< ::chat::Codec> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::Codec>() {
+  return ::chat::Codec_descriptor();
+}
 template <> struct is_proto_enum< ::chat::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::MessageType>() {
@@ -3406,6 +10953,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserListType>() {
   return ::chat::UserListType_descriptor();
 }
+template <> struct is_proto_enum< ::chat::PresenceEvent> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::PresenceEvent>() {
+  return ::chat::PresenceEvent_descriptor();
+}
 template <> struct is_proto_enum< ::chat::Operation> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::chat::Operation>() {
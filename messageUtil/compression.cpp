@@ -0,0 +1,156 @@
+// compression.cpp
+#include "compression.h"
+#include "constants.h"
+#include <algorithm>
+#include <iostream> // For std::cerr
+#include <cstring>    // For memcpy
+#include <netinet/in.h> // For htonl, ntohl
+#ifdef CHAT_WITH_LZ4
+#include <lz4.h>
+#endif
+#ifdef CHAT_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef CHAT_WITH_ZSTD
+namespace
+{
+  // Raw content dictionary shared by clients and servers. Short chat messages have little history
+  // of their own, so zstd borrows matches from the usual words and protocol strings below.
+  const char CHAT_DICTIONARY[] =
+      "Message incoming.Broadcast message incoming.Channel message incoming.Message sent successfully."
+      "Broadcast message sent successfully.Channel message sent successfully.Message queued for delivery."
+      "All users returned successfully.User page returned successfully.User returned successfully."
+      "Status updated successfully.User registered successfully.User unregistered successfully."
+      " (127.0.0.1) ONLINE BUSY OFFLINE "
+      "hello hi hey thanks thank you please sorry okay ok yes no the and that this with for you are "
+      "what when where why how can could would should will just about there their have has was were "
+      "error warning exception failed at line function return null undefined true false "
+      "http://https://www.com/.org/ \n\t    ";
+
+  const ZSTD_CDict *chat_cdict()
+  {
+    static const ZSTD_CDict *dict = ZSTD_createCDict(CHAT_DICTIONARY, sizeof(CHAT_DICTIONARY) - 1, ZSTD_COMPRESSION_LEVEL);
+    return dict;
+  }
+
+  const ZSTD_DDict *chat_ddict()
+  {
+    static const ZSTD_DDict *dict = ZSTD_createDDict(CHAT_DICTIONARY, sizeof(CHAT_DICTIONARY) - 1);
+    return dict;
+  }
+}
+#endif
+
+// Compressed payloads start with the original size, so the output can be sized exactly
+constexpr size_t ORIGINAL_SIZE_BYTES = 4;
+
+const std::vector<chat::Codec> &supported_codecs()
+{
+  static const std::vector<chat::Codec> codecs = {
+#ifdef CHAT_WITH_ZSTD
+      chat::Codec::ZSTD,
+#endif
+#ifdef CHAT_WITH_LZ4
+      chat::Codec::LZ4,
+#endif
+  };
+  return codecs;
+}
+
+chat::Codec negotiate_codec(const google::protobuf::RepeatedField<int> &offered)
+{
+  const auto &codecs = supported_codecs();
+  for (int codec : offered)
+  {
+    if (std::find(codecs.begin(), codecs.end(), codec) != codecs.end())
+      return static_cast<chat::Codec>(codec);
+  }
+  return chat::Codec::NO_COMPRESSION;
+}
+
+// The arguments are only read by the codecs compiled in. The result is appended after what
+// out already holds (the frame header), so the caller does not copy it again
+bool compress_payload(chat::Codec codec, [[maybe_unused]] const char *data, [[maybe_unused]] size_t size, [[maybe_unused]] std::string &out)
+{
+  switch (codec)
+  {
+#ifdef CHAT_WITH_LZ4
+  case chat::Codec::LZ4:
+  {
+    size_t start = out.size();
+    uint32_t original = htonl(static_cast<uint32_t>(size));
+    out.resize(start + ORIGINAL_SIZE_BYTES + LZ4_compressBound(static_cast<int>(size)));
+    memcpy(&out[start], &original, ORIGINAL_SIZE_BYTES);
+    int written = LZ4_compress_default(data, &out[start + ORIGINAL_SIZE_BYTES], static_cast<int>(size), static_cast<int>(out.size() - start - ORIGINAL_SIZE_BYTES));
+    if (written <= 0)
+      return false;
+    out.resize(start + ORIGINAL_SIZE_BYTES + written);
+    return true;
+  }
+#endif
+#ifdef CHAT_WITH_ZSTD
+  case chat::Codec::ZSTD:
+  {
+    thread_local ZSTD_CCtx *context = ZSTD_createCCtx();
+    size_t start = out.size();
+    uint32_t original = htonl(static_cast<uint32_t>(size));
+    out.resize(start + ORIGINAL_SIZE_BYTES + ZSTD_compressBound(size));
+    memcpy(&out[start], &original, ORIGINAL_SIZE_BYTES);
+    size_t written = ZSTD_compress_usingCDict(context, &out[start + ORIGINAL_SIZE_BYTES], out.size() - start - ORIGINAL_SIZE_BYTES, data, size, chat_cdict());
+    if (ZSTD_isError(written))
+      return false;
+    out.resize(start + ORIGINAL_SIZE_BYTES + written);
+    return true;
+  }
+#endif
+  default:
+    return false;
+  }
+}
+
+bool decompress_payload(chat::Codec codec, const char *data, size_t size, std::string &out)
+{
+  uint32_t original = 0;
+  if (size < ORIGINAL_SIZE_BYTES)
+    return false;
+  memcpy(&original, data, ORIGINAL_SIZE_BYTES);
+  original = ntohl(original);
+  // Output is bounded, a corrupted or hostile frame cannot make us allocate more
+  if (original > MAX_DECOMPRESSED_SIZE)
+  {
+    std::cerr << "Compressed frame exceeds maximum size. Size: " << original << ", Maximum: " << MAX_DECOMPRESSED_SIZE << std::endl;
+    return false;
+  }
+  out.resize(original);
+  data += ORIGINAL_SIZE_BYTES;
+  size -= ORIGINAL_SIZE_BYTES;
+
+  switch (codec)
+  {
+#ifdef CHAT_WITH_LZ4
+  case chat::Codec::LZ4:
+  {
+    int written = LZ4_decompress_safe(data, &out[0], static_cast<int>(size), static_cast<int>(out.size()));
+    if (written != static_cast<int>(original))
+      break;
+    return true;
+  }
+#endif
+#ifdef CHAT_WITH_ZSTD
+  case chat::Codec::ZSTD:
+  {
+    thread_local ZSTD_DCtx *context = ZSTD_createDCtx();
+    size_t written = ZSTD_decompress_usingDDict(context, &out[0], out.size(), data, size, chat_ddict());
+    if (ZSTD_isError(written) || written != original)
+      break;
+    return true;
+  }
+#endif
+  default:
+    std::cerr << "Unsupported codec in frame: " << codec << std::endl;
+    return false;
+  }
+  std::cerr << "Failed to decompress frame of " << size << " bytes." << std::endl;
+  return false;
+}
@@ -0,0 +1,19 @@
+// compression.h
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include "chat.pb.h"
+#include <string>
+#include <vector>
+
+// Codecs compiled in with -DCHAT_WITH_ZSTD (-lzstd) and -DCHAT_WITH_LZ4 (-llz4), in order of preference
+const std::vector<chat::Codec> &supported_codecs();
+
+// First codec offered by the peer that is also supported here, NO_COMPRESSION if there is none
+chat::Codec negotiate_codec(const google::protobuf::RepeatedField<int> &offered);
+
+// compress_payload appends to out, decompress_payload replaces its content
+bool compress_payload(chat::Codec codec, const char *data, size_t size, std::string &out);
+bool decompress_payload(chat::Codec codec, const char *data, size_t size, std::string &out);
+
+#endif // COMPRESSION_H
@@ -3,6 +3,7 @@
 #define CONSTANTS_H
 
 #include <sys/types.h> // For ssize_t
+#include <cstdint>     // For uint32_t
 
 // Boolean flag for handling UNIQUE IP
 constexpr bool HANDLE_UNIQUE_IP = false;
@@ -13,7 +14,176 @@ constexpr int AUTO_OFFLINE_SECONDS = 20;
 // Indicating the static size of the buffer
 constexpr size_t BUFFER_SIZE = 64 * 1024;
 
+// Size of the length prefix written before every message on the wire
+constexpr size_t FRAME_HEADER_SIZE = 4;
+
+// The top byte of the length prefix carries the codec of the payload, the rest is the length
+constexpr uint32_t FRAME_LENGTH_MASK = 0x00FFFFFF;
+constexpr int FRAME_CODEC_SHIFT = 24;
+
+// Heartbeats: PING and PONG are a bare header without payload, marked by these values in the codec byte
+constexpr uint8_t FRAME_PING = 0xFE;
+constexpr uint8_t FRAME_PONG = 0xFF;
+
+// Heartbeats: a connection the server did not hear from during an interval gets a PING
+constexpr int HEARTBEAT_INTERVAL_MS = 5000;
+
+// Heartbeats: silent intervals after which the connection is considered dead and closed
+constexpr int HEARTBEAT_MISSED_LIMIT = 3;
+
+// Admission: a connection that has not registered a user after this long is closed (checked on heartbeat ticks)
+constexpr int REGISTRATION_TIMEOUT_MS = 30000;
+
+// Gateway: STREAM frames carry the client connections a gateway multiplexes, marked by this value in the codec byte
+constexpr uint8_t FRAME_STREAM = 0xFD;
+
+// Gateway: stream id and kind written after the header of a STREAM frame
+constexpr size_t STREAM_HEADER_SIZE = 5;
+
+// Gateway: largest STREAM frame payload, a whole client frame fits in one
+constexpr size_t MAX_STREAM_PAYLOAD = STREAM_HEADER_SIZE + FRAME_HEADER_SIZE + BUFFER_SIZE;
+
+// Payloads at least this large are compressed when the connection negotiated a codec
+constexpr size_t COMPRESSION_THRESHOLD = 512;
+
+// Largest payload accepted after decompression, the compressed frame must still fit in BUFFER_SIZE
+constexpr size_t MAX_DECOMPRESSED_SIZE = 4 * BUFFER_SIZE;
+
+// zstd level used with the shared chat dictionary
+constexpr int ZSTD_COMPRESSION_LEVEL = 3;
+
+// Chunked transfers: payload bytes per TRANSFER_CHUNK, well below BUFFER_SIZE
+constexpr size_t TRANSFER_CHUNK_SIZE = 16 * 1024;
+
+// Chunked transfers: chunks a sender may have in flight before it needs more credit
+constexpr uint32_t TRANSFER_WINDOW = 8;
+
+// Chunked transfers: largest content accepted in a single transfer
+constexpr uint64_t MAX_TRANSFER_SIZE = 256ULL * 1024 * 1024;
+
+// Reactor threads of the server, each with its own SO_REUSEPORT listener. 0 uses one per core
+constexpr unsigned REACTOR_THREADS = 0;
+
+// Events handled per epoll_wait call of a reactor
+constexpr int MAX_EPOLL_EVENTS = 64;
+
+// Backlog of each listening socket, the kernel caps it at net.core.somaxconn
+constexpr int LISTEN_BACKLOG = 1024;
+
+// Open connections the server accepts; beyond it new connections get SERVICE_UNAVAILABLE and are closed
+constexpr size_t MAX_CONNECTIONS = 10000;
+
+// Accepted connections without a registered user; beyond it the reactors stop accepting for a while
+constexpr size_t MAX_PENDING_REGISTRATIONS = 1000;
+
+// Sessions waiting for a worker; beyond it the reactors stop accepting for a while
+constexpr size_t MAX_QUEUED_SESSIONS = 4096;
+
+// Interval at which a reactor that stopped accepting checks whether the pressure went down
+constexpr int ACCEPT_RETRY_MS = 100;
+
+// Graceful shutdown and hot upgrade: time allowed to finish queued requests and flush the outbound queues
+constexpr int DRAIN_TIMEOUT_MS = 5000;
+
+// Graceful shutdown: delay before reconnecting suggested to the clients
+constexpr uint32_t RECONNECT_HINT_MS = 2000;
+
+// Unix sockets of the server live in a directory only its user can enter; %u is the uid
+constexpr const char *SOCKET_DIRECTORY_FORMAT = "/tmp/chat-server-%u";
+
+// Hot upgrade: Unix socket where the running server hands its sockets to a replacement started with --upgrade
+constexpr const char *UPGRADE_SOCKET_FORMAT = "%s/upgrade-%d.sock"; // %s is the socket directory, %d the port
+
+// Federation: interval at which a node sends a peer the directory changes and messages queued for it
+constexpr int PEER_BATCH_INTERVAL_MS = 10;
+
+// Federation: wait before connecting again to a peer that is down
+constexpr int PEER_RETRY_MS = 1000;
+
+// Federation: a peer leaves the hash ring only after its link has been down this long, a short outage moves no session
+constexpr int NODE_DOWN_GRACE_MS = 10000;
+
+// Federation: forwarded message bytes queued for a peer; beyond it new messages for that peer are dropped
+constexpr size_t MAX_PEER_PENDING = 4 * 1024 * 1024;
+
+// Federation: interval at which a node sends its presence digest to each peer (anti-entropy)
+constexpr int GOSSIP_INTERVAL_MS = 1000;
+
+// Federation: time a presence tombstone is kept so that peers learn the user left
+constexpr int GOSSIP_TOMBSTONE_TTL_MS = 60000;
+
+// Federation: points of the consistent hash ring per node, more points spread the users more evenly
+constexpr unsigned HASH_RING_VIRTUAL_NODES = 128;
+
+// Federation: redirects to the home node of the user a client follows while registering
+constexpr int MAX_REDIRECTS = 3;
+
+// Gateway: connections a gateway keeps open to the server and shares among its clients
+constexpr int GATEWAY_BACKEND_CONNECTIONS = 4;
+
+// Gateway: client connections the server accepts through gateways, on top of its own sockets
+constexpr size_t MAX_GATEWAY_STREAMS = 65536;
+
+// Gateway: client connections a single gateway link can open, so one gateway cannot take them all
+constexpr size_t MAX_STREAMS_PER_GATEWAY_LINK = 16384;
+
+// Gateway: bytes queued on a link between gateway and server; a link that does not drain them is closed
+constexpr size_t MAX_GATEWAY_PENDING_OUTPUT = 64 * 1024 * 1024;
+
+// Local clients: Unix socket the server also listens on, inside the private directory of its user
+constexpr const char *LOCAL_SOCKET_FORMAT = "%s/local-%d.sock"; // %s is the directory, %d the port
+
+// Local clients: bytes of each shared memory ring (one per direction), a power of two
+constexpr uint32_t SHM_RING_SIZE = 1024 * 1024;
+
+// Local clients: longest futex sleep of a client on its ring before checking that the server is still there
+constexpr int SHM_WAIT_MS = 1000;
+
+// Worker threads that run request handlers, separate from the reactors. 0 uses one per core
+constexpr unsigned WORKER_THREADS = 0;
+
+// Request bytes a connection may have waiting for its handler before the reactor stops reading it
+constexpr size_t MAX_PENDING_INPUT = 1024 * 1024;
+
+// Bytes a connection may have queued for writing; a slower reader is disconnected
+constexpr size_t MAX_PENDING_OUTPUT = 4 * 1024 * 1024;
+
+// Frames gathered by a single writev when a reactor flushes a connection
+constexpr int MAX_WRITE_PARTS = 64;
+
+// Rate limiting: requests per second refilled to the bucket of each connection, and its burst size
+constexpr double USER_RATE_LIMIT = 20;
+constexpr double USER_RATE_BURST = 40;
+
+// Rate limiting: the same for the bucket shared by all the connections from one IP address
+constexpr double IP_RATE_LIMIT = 100;
+constexpr double IP_RATE_BURST = 200;
+
+// Rate limiting: tokens taken by a broadcast, which the server fans out to every user
+constexpr double BROADCAST_RATE_COST = 5;
+
 // Indicating if using verbose mode
 constexpr bool VERBOSE = false;
 
+// Users per GET_USERS page when the request does not set a limit
+constexpr size_t USER_PAGE_SIZE = 100;
+
+// Upper bound for the limit of a GET_USERS page, keeps pages well below BUFFER_SIZE
+constexpr size_t MAX_USER_PAGE_SIZE = 500;
+
+// Size of the per-thread protobuf arena block reused by every request on the server
+constexpr size_t ARENA_INITIAL_BLOCK_SIZE = 8 * 1024;
+
+// Ack mode: time before an unacknowledged direct message is sent again
+constexpr int ACK_RETRY_TIMEOUT_MS = 2000;
+
+// Ack mode: attempts before an unacknowledged direct message is dropped
+constexpr int ACK_MAX_ATTEMPTS = 5;
+
+// Ack mode: interval used to batch acks (client) and delivery receipts (server)
+constexpr int ACK_FLUSH_INTERVAL_MS = 100;
+
+// Ack mode: number of pending acks that forces an immediate flush on the client
+constexpr size_t ACK_BATCH_SIZE = 32;
+
 #endif // CONSTANTS_H
@@ -0,0 +1,68 @@
+// hash_ring.cpp
+#include "hash_ring.h"
+#include <algorithm>
+
+uint64_t HashRing::hash(std::string_view key)
+{
+  // FNV-1a, then the splitmix64 finalizer so that similar names land far apart
+  uint64_t value = 0xcbf29ce484222325ULL;
+  for (unsigned char c : key)
+  {
+    value ^= c;
+    value *= 0x100000001b3ULL;
+  }
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31;
+  return value;
+}
+
+void HashRing::add_node(const std::string &node)
+{
+  if (contains(node))
+    return;
+  nodes_.push_back(node);
+  rebuild();
+}
+
+void HashRing::remove_node(const std::string &node)
+{
+  auto it = std::find(nodes_.begin(), nodes_.end(), node);
+  if (it == nodes_.end())
+    return;
+  nodes_.erase(it);
+  rebuild();
+}
+
+bool HashRing::contains(const std::string &node) const
+{
+  return std::find(nodes_.begin(), nodes_.end(), node) != nodes_.end();
+}
+
+const std::string &HashRing::owner(std::string_view key) const
+{
+  static const std::string none;
+  if (points_.empty())
+    return none;
+  uint64_t key_hash = hash(key);
+  auto it = std::lower_bound(points_.begin(), points_.end(), key_hash, [](const Point &point, uint64_t value)
+                             { return point.hash < value; });
+  if (it == points_.end())
+    it = points_.begin(); // The ring wraps around
+  return nodes_[it->node];
+}
+
+void HashRing::rebuild()
+{
+  points_.clear();
+  points_.reserve(nodes_.size() * virtual_nodes_);
+  for (uint32_t node = 0; node < nodes_.size(); node++)
+  {
+    for (unsigned i = 0; i < virtual_nodes_; i++)
+      points_.push_back({hash(nodes_[node] + "#" + std::to_string(i)), node});
+  }
+  std::sort(points_.begin(), points_.end(), [this](const Point &a, const Point &b)
+            { return a.hash != b.hash ? a.hash < b.hash : nodes_[a.node] < nodes_[b.node]; });
+}
@@ -0,0 +1,43 @@
+// hash_ring.h
+#ifndef HASH_RING_H
+#define HASH_RING_H
+
+#include "constants.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Consistent hash ring: every node owns virtual_nodes points of the ring and a key belongs to the
+// first point at or after its hash. Adding or removing a node only moves the keys of its ranges.
+// Not synchronized, the owner decides how it is shared.
+class HashRing
+{
+public:
+  explicit HashRing(unsigned virtual_nodes = HASH_RING_VIRTUAL_NODES) : virtual_nodes_(virtual_nodes) {}
+
+  void add_node(const std::string &node);
+  void remove_node(const std::string &node);
+  bool contains(const std::string &node) const;
+
+  // Node that owns the key, empty if the ring has no nodes
+  const std::string &owner(std::string_view key) const;
+
+  // Stable across processes and builds, every node places the keys the same way
+  static uint64_t hash(std::string_view key);
+
+private:
+  struct Point
+  {
+    uint64_t hash;
+    uint32_t node; // Index in nodes_
+  };
+
+  void rebuild();
+
+  unsigned virtual_nodes_;
+  std::vector<std::string> nodes_;
+  std::vector<Point> points_; // Sorted by hash, ties by node name so every process builds the same ring
+};
+
+#endif // HASH_RING_H
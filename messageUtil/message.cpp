@@ -1,65 +1,547 @@
 // message.cpp
 #include "message.h"
+#include "compression.h"
+#include "shm_ring.h"
 #include <iostream> // For std::cerr
+#include <mutex>    // For std::mutex
 #include <vector>   // For std::vector
+#include <deque>    // For std::deque
 #include <cstring>  // For memcpy
 #include <unistd.h> // For ssize_t
 #include <cerrno>   // For errno
+#include <poll.h>   // For poll
+#include <sys/stat.h> // For mkdir and lstat
+#include <sys/un.h>   // For sockaddr_un
 
-bool send_response(int sock, const google::protobuf::Message &message)
+// Shared memory attached to a socket, indexed by descriptor. Only the client side uses it, and it
+// attaches or detaches a channel before other threads use the socket.
+static std::vector<std::unique_ptr<ShmChannel>> socket_channels;
+static std::mutex socket_channels_mutex;
+
+void attach_shm_channel(int sock, std::unique_ptr<ShmChannel> channel)
+{
+  std::lock_guard<std::mutex> lock(socket_channels_mutex);
+  if (socket_channels.size() <= static_cast<size_t>(sock))
+    socket_channels.resize(sock + 1);
+  socket_channels[sock] = std::move(channel);
+}
+
+static ShmChannel *socket_channel(int sock)
+{
+  std::lock_guard<std::mutex> lock(socket_channels_mutex);
+  return static_cast<size_t>(sock) < socket_channels.size() ? socket_channels[sock].get() : nullptr;
+}
+
+// With shared memory the socket only wakes the server up: any byte will do, and a full socket
+// means the server has wakeups pending already
+static bool ring_doorbell(int sock)
+{
+  char byte = 0;
+  if (send(sock, &byte, 1, MSG_NOSIGNAL | MSG_DONTWAIT) < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+  {
+    perror("send failed");
+    return false;
+  }
+  return true;
+}
+
+// The server closes the socket when it drops the connection, the rings do not tell
+static bool peer_alive(int sock)
+{
+  struct pollfd watched = {sock, POLLRDHUP, 0};
+  if (poll(&watched, 1, 0) > 0 && (watched.revents & (POLLRDHUP | POLLHUP | POLLERR)))
+  {
+    std::cerr << "Connection closed by peer." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Copies the bytes into the ring towards the server, sleeping while it is full
+static bool shm_send_all(ShmChannel &channel, int sock, const char *data, size_t size)
 {
-  std::string output;
-  message.SerializeToString(&output);
+  ShmRing &ring = channel.to_server;
+  size_t total = 0;
+  while (total < size)
+  {
+    size_t written = ring.write(data + total, size - total);
+    total += written;
+    if (written > 0 && ring.take_consumer_waiting() && !ring_doorbell(sock))
+      return false;
+    if (written == 0 && ring.prepare_producer_wait())
+    {
+      ring.wait_writable(SHM_WAIT_MS);
+      if (!peer_alive(sock))
+        return false;
+    }
+  }
+  return true;
+}
+
+static bool shm_recv_all(ShmChannel &channel, int sock, char *data, size_t size)
+{
+  ShmRing &ring = channel.to_client;
+  size_t total = 0;
+  while (total < size)
+  {
+    size_t read = ring.read(data + total, size - total);
+    total += read;
+    if (read > 0 && ring.take_producer_waiting() && !ring_doorbell(sock))
+      return false;
+    if (read == 0 && ring.prepare_consumer_wait())
+    {
+      if (!peer_alive(sock))
+        return false;
+      ring.wait_readable(SHM_WAIT_MS);
+    }
+  }
+  return true;
+}
+
+// Sends the whole buffer, retrying on partial writes and EINTR
+static bool send_all(int sock, const char *data, size_t size)
+{
+  if (ShmChannel *channel = socket_channel(sock))
+    return shm_send_all(*channel, sock, data, size);
+
+  size_t total = 0;
+  while (total < size)
+  {
+    ssize_t sentBytes = send(sock, data + total, size - total, MSG_NOSIGNAL);
+    if (sentBytes < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      perror("send failed");
+      return false;
+    }
+    total += sentBytes;
+  }
+  return true;
+}
+
+// One send mutex per socket, indexed by descriptor. Whole frames are sent holding it, so frames written
+// by different threads (requests, acks, a PONG from the receiving thread) never interleave on the stream,
+// and a blocking send to one peer does not hold up the sends to other sockets.
+static std::deque<std::mutex> socket_send_mutexes;
+static std::mutex socket_send_mutexes_mutex;
+
+static std::mutex &send_mutex(int sock)
+{
+  std::lock_guard<std::mutex> lock(socket_send_mutexes_mutex);
+  while (socket_send_mutexes.size() <= static_cast<size_t>(sock))
+    socket_send_mutexes.emplace_back();
+  return socket_send_mutexes[sock];
+}
+
+static bool send_whole(int sock, const char *data, size_t size)
+{
+  std::lock_guard<std::mutex> lock(send_mutex(sock));
+  return send_all(sock, data, size);
+}
+
+// Reads exactly size bytes, returns false on error or disconnection
+static bool recv_all(int sock, char *data, size_t size)
+{
+  if (ShmChannel *channel = socket_channel(sock))
+    return shm_recv_all(*channel, sock, data, size);
+
+  size_t total = 0;
+  while (total < size)
+  {
+    ssize_t bytesRead = recv(sock, data + total, size - total, 0);
+    if (bytesRead <= 0)
+    {
+      if (bytesRead < 0 && errno == EINTR)
+        continue;
+      if (bytesRead < 0)
+        perror("recv failed");
+      else
+        std::cerr << "Connection closed by peer." << std::endl;
+      return false;
+    }
+    total += bytesRead;
+  }
+  return true;
+}
+
+// Codec negotiated per socket, indexed by descriptor
+static std::vector<chat::Codec> socket_codecs;
+static std::mutex socket_codecs_mutex;
+
+void set_socket_codec(int sock, chat::Codec codec)
+{
+  std::lock_guard<std::mutex> lock(socket_codecs_mutex);
+  if (socket_codecs.size() <= static_cast<size_t>(sock))
+    socket_codecs.resize(sock + 1, chat::Codec::NO_COMPRESSION);
+  socket_codecs[sock] = codec;
+}
+
+chat::Codec socket_codec(int sock)
+{
+  std::lock_guard<std::mutex> lock(socket_codecs_mutex);
+  return static_cast<size_t>(sock) < socket_codecs.size() ? socket_codecs[sock] : chat::Codec::NO_COMPRESSION;
+}
+
+static void write_frame_header(char *header, size_t length, chat::Codec codec)
+{
+  uint32_t value = htonl(static_cast<uint32_t>(length) | (static_cast<uint32_t>(codec) << FRAME_CODEC_SHIFT));
+  memcpy(header, &value, FRAME_HEADER_SIZE);
+}
+
+static bool compress_into_frame(chat::Codec codec, const char *payload, size_t size, std::string &compressed)
+{
+  if (codec == chat::Codec::NO_COMPRESSION || size < COMPRESSION_THRESHOLD)
+    return false;
+
+  compressed.assign(FRAME_HEADER_SIZE, '\0');
+  if (!compress_payload(codec, payload, size, compressed))
+    return false;
+  size_t compressed_size = compressed.size() - FRAME_HEADER_SIZE;
+  if (compressed_size >= size || compressed_size > BUFFER_SIZE)
+    return false;
+
+  write_frame_header(&compressed[0], compressed_size, codec);
+  return true;
+}
+
+bool compress_frame(chat::Codec codec, const std::string &frame, std::string &compressed)
+{
+  return compress_into_frame(codec, frame.data() + FRAME_HEADER_SIZE, frame.size() - FRAME_HEADER_SIZE, compressed);
+}
+
+// Writes the length prefix and the payload in one pass, reusing the capacity of frame
+static bool encode_frame(const google::protobuf::Message &message, size_t limit, std::string &frame)
+{
+  size_t size = message.ByteSizeLong();
 
   // Ensure the message fits in the buffer
-  if (output.size() > BUFFER_SIZE)
+  if (size > limit)
   {
-    std::cerr << "Message size exceeds buffer capacity. Size: " << output.size() << ", Buffer Capacity: " << BUFFER_SIZE << std::endl;
+    std::cerr << "Message size exceeds buffer capacity. Size: " << size << ", Buffer Capacity: " << limit << std::endl;
     return false;
   }
 
-  // Send the message directly
-  ssize_t sentBytes = send(sock, output.data(), output.size(), 0);
+  // Prefix the payload with its length so the peer can split the TCP stream into messages
+  frame.resize(FRAME_HEADER_SIZE + size);
+  write_frame_header(&frame[0], size, chat::Codec::NO_COMPRESSION);
+  message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(&frame[FRAME_HEADER_SIZE]));
+  return true;
+}
+
+bool serialize_frame(const google::protobuf::Message &message, std::string &frame)
+{
+  return encode_frame(message, BUFFER_SIZE, frame);
+}
+
+bool send_frame(int sock, const std::string &frame)
+{
+  if (!send_whole(sock, frame.data(), frame.size()))
+    return false;
+
+  if (VERBOSE)
+    std::cerr << "Sent " << frame.size() << " bytes successfully." << std::endl;
+
+  return true;
+}
+
+bool send_frame_with_descriptor(int sock, const std::string &frame, int fd)
+{
+  struct iovec part = {const_cast<char *>(frame.data()), frame.size()};
+  char control[CMSG_SPACE(sizeof(int))] = {};
+  struct msghdr header = {};
+  header.msg_iov = &part;
+  header.msg_iovlen = 1;
+  header.msg_control = control;
+  header.msg_controllen = sizeof(control);
+  struct cmsghdr *message = CMSG_FIRSTHDR(&header);
+  message->cmsg_level = SOL_SOCKET;
+  message->cmsg_type = SCM_RIGHTS;
+  message->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(message), &fd, sizeof(int));
+
+  // The descriptor goes with the first bytes, the rest of a partial write is sent as usual
+  std::lock_guard<std::mutex> lock(send_mutex(sock));
+  ssize_t sentBytes;
+  do
+  {
+    sentBytes = sendmsg(sock, &header, MSG_NOSIGNAL);
+  } while (sentBytes < 0 && errno == EINTR);
   if (sentBytes < 0)
   {
     perror("send failed");
     return false;
   }
-  else if (sentBytes < output.size())
+  return send_all(sock, frame.data() + sentBytes, frame.size() - sentBytes);
+}
+
+bool send_frame_parts(int sock, struct iovec *parts, int count)
+{
+  size_t total = 0;
+  for (int i = 0; i < count; i++)
+    total += parts[i].iov_len;
+
+  // Gather write, advancing over the parts already sent on partial writes
+  std::lock_guard<std::mutex> lock(send_mutex(sock));
+  if (ShmChannel *channel = socket_channel(sock))
+  {
+    for (int i = 0; i < count; i++)
+    {
+      if (!shm_send_all(*channel, sock, static_cast<const char *>(parts[i].iov_base), parts[i].iov_len))
+        return false;
+    }
+    return true;
+  }
+  struct msghdr header = {};
+  header.msg_iov = parts;
+  header.msg_iovlen = count;
+  size_t sent = 0;
+  while (sent < total)
   {
-    std::cerr << "Not all data was sent. Sent " << sentBytes << " of " << output.size() << " bytes." << std::endl;
-    return false;
+    ssize_t sentBytes = sendmsg(sock, &header, MSG_NOSIGNAL);
+    if (sentBytes < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      perror("send failed");
+      return false;
+    }
+    sent += sentBytes;
+    while (header.msg_iovlen > 0 && static_cast<size_t>(sentBytes) >= header.msg_iov->iov_len)
+    {
+      sentBytes -= header.msg_iov->iov_len;
+      header.msg_iov++;
+      header.msg_iovlen--;
+    }
+    if (header.msg_iovlen > 0)
+    {
+      header.msg_iov->iov_base = static_cast<char *>(header.msg_iov->iov_base) + sentBytes;
+      header.msg_iov->iov_len -= sentBytes;
+    }
   }
 
   if (VERBOSE)
-    std::cerr << "Sent " << sentBytes << " bytes successfully." << std::endl;
+    std::cerr << "Sent " << total << " bytes successfully." << std::endl;
 
   return true;
 }
 
+// Buffers owned by the sending thread: once they reached the usual frame size, sends do not allocate
+static thread_local std::string frame_buffer;
+static thread_local std::string compressed_buffer;
+
+// Serializes the message and points frame at the bytes to send, compressed with codec when it pays off
+static bool prepare_frame(const google::protobuf::Message &message, chat::Codec codec, const std::string *&frame)
+{
+  // With a codec the message may be larger than the buffer as long as it compresses below it
+  if (!encode_frame(message, codec == chat::Codec::NO_COMPRESSION ? BUFFER_SIZE : MAX_DECOMPRESSED_SIZE, frame_buffer))
+    return false;
+
+  if (compress_frame(codec, frame_buffer, compressed_buffer))
+  {
+    frame = &compressed_buffer;
+    return true;
+  }
+  if (frame_buffer.size() - FRAME_HEADER_SIZE > BUFFER_SIZE)
+  {
+    std::cerr << "Message size exceeds buffer capacity after compression. Size: " << frame_buffer.size() - FRAME_HEADER_SIZE << ", Buffer Capacity: " << BUFFER_SIZE << std::endl;
+    return false;
+  }
+  frame = &frame_buffer;
+  return true;
+}
+
+// An oversized message does not keep its buffers alive for the rest of the thread
+static void release_oversized_buffers()
+{
+  if (frame_buffer.capacity() > FRAME_HEADER_SIZE + BUFFER_SIZE)
+    std::string().swap(frame_buffer);
+  if (compressed_buffer.capacity() > FRAME_HEADER_SIZE + BUFFER_SIZE)
+    std::string().swap(compressed_buffer);
+}
+
+bool send_response(int sock, const google::protobuf::Message &message)
+{
+  const std::string *frame;
+  if (!prepare_frame(message, socket_codec(sock), frame))
+    return false;
+
+  bool sent = send_frame(sock, *frame);
+  release_oversized_buffers();
+  return sent;
+}
+
+bool append_frame(const google::protobuf::Message &message, chat::Codec codec, std::string &out)
+{
+  const std::string *frame;
+  if (!prepare_frame(message, codec, frame))
+    return false;
+
+  out += *frame;
+  release_oversized_buffers();
+  return true;
+}
+
 bool receive_request(int sock, google::protobuf::Message &message)
 {
-  std::vector<char> buffer(BUFFER_SIZE);
+  thread_local std::string buffer;
+  return receive_request(sock, message, buffer);
+}
+
+// Splits the length prefix into payload length and codec, false if the frame cannot fit the buffer
+static bool decode_frame_header(const char *header, uint32_t &length, chat::Codec &codec)
+{
+  memcpy(&length, header, FRAME_HEADER_SIZE);
+  length = ntohl(length);
+  codec = static_cast<chat::Codec>(length >> FRAME_CODEC_SHIFT);
+  length &= FRAME_LENGTH_MASK;
+  size_t limit = codec == FRAME_STREAM ? MAX_STREAM_PAYLOAD : BUFFER_SIZE;
+  if (length > limit)
+  {
+    std::cerr << "Incoming frame exceeds buffer capacity. Size: " << length << ", Buffer Capacity: " << limit << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// PING and PONG use the codec byte as a marker and carry no payload
+static bool is_control_frame(chat::Codec codec)
+{
+  return codec == FRAME_PING || codec == FRAME_PONG;
+}
+
+// Compressed frames are inflated into a thread-local buffer before parsing
+static bool frame_payload(chat::Codec codec, std::string_view data, std::string_view &payload)
+{
+  if (codec != chat::Codec::NO_COMPRESSION)
+  {
+    thread_local std::string inflated;
+    if (!decompress_payload(codec, data.data(), data.size(), inflated))
+      return false;
+    payload = inflated;
+    return true;
+  }
+  payload = data;
+  return true;
+}
+
+bool receive_frame(int sock, std::string &buffer, std::string_view &payload)
+{
+  char header[FRAME_HEADER_SIZE];
+  uint32_t length;
+  chat::Codec codec;
+  while (true)
+  {
+    if (!recv_all(sock, header, FRAME_HEADER_SIZE))
+      return false; // Handle errors or disconnection
+    if (!decode_frame_header(header, length, codec))
+      return false;
+    if (!is_control_frame(codec))
+      break;
+    if (length != 0)
+    {
+      std::cerr << "Heartbeat frame with payload. Size: " << length << std::endl;
+      return false;
+    }
+    if (codec == FRAME_PING && !send_whole(sock, PONG_FRAME, FRAME_HEADER_SIZE))
+      return false;
+  }
+
+  // The buffer keeps its capacity between frames
+  buffer.resize(length);
 
   // Read the data into the buffer
-  ssize_t bytesRead = recv(sock, buffer.data(), buffer.size(), 0);
-  if (bytesRead <= 0)
+  if (!recv_all(sock, &buffer[0], length))
+    return false;
+
+  if (VERBOSE)
+    std::cerr << "Received " << length + FRAME_HEADER_SIZE << " bytes successfully." << std::endl;
+
+  return frame_payload(codec, buffer, payload);
+}
+
+FrameStatus split_frame(std::string_view data, size_t &frame_size)
+{
+  uint32_t length;
+  chat::Codec codec;
+  if (data.size() < FRAME_HEADER_SIZE)
+    return FrameStatus::INCOMPLETE;
+  if (!decode_frame_header(data.data(), length, codec))
+    return FrameStatus::INVALID;
+  if (data.size() < FRAME_HEADER_SIZE + length)
+    return FrameStatus::INCOMPLETE;
+
+  frame_size = FRAME_HEADER_SIZE + length;
+  if (is_control_frame(codec))
+    return length != 0 ? FrameStatus::INVALID : codec == FRAME_PING ? FrameStatus::PING : FrameStatus::PONG;
+  return codec == FRAME_STREAM ? FrameStatus::STREAM : FrameStatus::READY;
+}
+
+FrameStatus parse_frame(std::string_view data, std::string_view &payload, size_t &frame_size)
+{
+  FrameStatus status = split_frame(data, frame_size);
+  if (status == FrameStatus::STREAM)
+    payload = data.substr(FRAME_HEADER_SIZE, frame_size - FRAME_HEADER_SIZE);
+  if (status != FrameStatus::READY)
+    return status;
+  chat::Codec codec = static_cast<chat::Codec>(static_cast<uint8_t>(data[0]));
+  return frame_payload(codec, data.substr(FRAME_HEADER_SIZE, frame_size - FRAME_HEADER_SIZE), payload) ? FrameStatus::READY : FrameStatus::INVALID;
+}
+
+void append_stream_header(std::string &out, uint32_t stream, StreamKind kind, size_t size)
+{
+  char header[FRAME_HEADER_SIZE + STREAM_HEADER_SIZE];
+  uint32_t value = htonl(static_cast<uint32_t>(STREAM_HEADER_SIZE + size) | (static_cast<uint32_t>(FRAME_STREAM) << FRAME_CODEC_SHIFT));
+  memcpy(header, &value, FRAME_HEADER_SIZE);
+  value = htonl(stream);
+  memcpy(header + FRAME_HEADER_SIZE, &value, sizeof(value));
+  header[FRAME_HEADER_SIZE + sizeof(value)] = static_cast<char>(kind);
+  out.append(header, sizeof(header));
+}
+
+bool read_stream_header(std::string_view payload, uint32_t &stream, StreamKind &kind, std::string_view &data)
+{
+  if (payload.size() < STREAM_HEADER_SIZE || static_cast<uint8_t>(payload[4]) > static_cast<uint8_t>(StreamKind::LINK))
+    return false;
+  memcpy(&stream, payload.data(), sizeof(stream));
+  stream = ntohl(stream);
+  kind = static_cast<StreamKind>(payload[4]);
+  data = payload.substr(STREAM_HEADER_SIZE);
+  return true;
+}
+
+std::string private_socket_path(const char *format, int port, bool create)
+{
+  char directory[sizeof(sockaddr_un::sun_path)];
+  snprintf(directory, sizeof(directory), SOCKET_DIRECTORY_FORMAT, static_cast<unsigned>(getuid()));
+  if (create && mkdir(directory, 0700) < 0 && errno != EEXIST)
   {
-    if (bytesRead < 0)
-      perror("recv failed");
-    else
-      std::cerr << "Connection closed by peer." << std::endl;
-    return false; // Handle errors or disconnection
+    perror("Socket directory setup failed");
+    return "";
   }
+  // /tmp is shared: a directory someone else created first, or that others can enter, is not used
+  struct stat info;
+  if (lstat(directory, &info) < 0 || !S_ISDIR(info.st_mode) || info.st_uid != getuid() || (info.st_mode & 077) != 0)
+  {
+    std::cerr << "Socket directory " << directory << " is missing or not private to this user." << std::endl;
+    return "";
+  }
+  char path[sizeof(sockaddr_un::sun_path)];
+  snprintf(path, sizeof(path), format, directory, port);
+  return path;
+}
+
+bool receive_request(int sock, google::protobuf::Message &message, std::string &buffer)
+{
+  std::string_view payload;
+  if (!receive_frame(sock, buffer, payload))
+    return false;
 
   // Parse the received data
-  if (!message.ParseFromArray(buffer.data(), bytesRead))
+  if (!message.ParseFromArray(payload.data(), payload.size()))
   {
-    std::cerr << "Failed to parse the message. Bytes read: " << bytesRead << std::endl;
+    std::cerr << "Failed to parse the message. Bytes read: " << payload.size() << std::endl;
     return false;
   }
-
-  if (VERBOSE)
-    std::cerr << "Received " << bytesRead << " bytes successfully." << std::endl;
   return true;
 }
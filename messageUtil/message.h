@@ -3,15 +3,71 @@
 #define MESSAGE_H
 
 #include "constants.h"
+#include "chat.pb.h"
+#include "shm_ring.h"
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstdint>                   // For uint32_t
 #include <sys/types.h>               // For ssize_t
 #include <sys/socket.h>              // For send, recv, and MSG_WAITALL
 #include <netinet/in.h>              // For htonl, ntohl
 #include <google/protobuf/message.h> // For Google Protobuf
+#include <sys/uio.h>                 // For iovec
 
 bool send_response(int sock, const google::protobuf::Message &message); // SPM: Send Protobuf Message
+bool serialize_frame(const google::protobuf::Message &message, std::string &frame); // Length-prefixed wire form of a message
+bool send_frame(int sock, const std::string &frame);                                // Sends an already serialized frame
+bool append_frame(const google::protobuf::Message &message, chat::Codec codec, std::string &out); // Appends the frame, to be sent later
+bool send_frame_parts(int sock, struct iovec *parts, int count);                    // Sends a frame split in several buffers
+bool send_frame_with_descriptor(int sock, const std::string &frame, int fd);         // Sends a frame with fd attached, Unix sockets only
 bool receive_request(int sock, google::protobuf::Message &message);       // RPM: Receive Protobuf Message
+bool receive_request(int sock, google::protobuf::Message &message, std::string &buffer); // Reads into a caller-owned buffer
+// Reads the next frame into buffer and returns its (inflated) payload, valid until the next receive on the thread.
+// Heartbeats are handled here: a PING is answered with a PONG and neither reaches the caller.
+bool receive_frame(int sock, std::string &buffer, std::string_view &payload);
+
+// Frame parsing over bytes already read from a non-blocking socket
+enum class FrameStatus
+{
+  INCOMPLETE, // More bytes are needed
+  READY,      // payload holds the (inflated) payload and frame_size the bytes used by the frame
+  INVALID,    // Oversized or corrupted frame, the connection must be closed
+  PING,       // Heartbeat, the peer expects a PONG. frame_size holds the bytes used by the frame
+  PONG,       // Answer to a heartbeat
+  STREAM      // Gateway frame: payload holds the stream header and the data, see read_stream_header
+};
+FrameStatus parse_frame(std::string_view data, std::string_view &payload, size_t &frame_size);
+// Same as parse_frame without inflating the payload, for relays that forward frames as they are
+FrameStatus split_frame(std::string_view data, size_t &frame_size);
+
+// Gateways multiplex client connections over a few links to the server. After its header a STREAM
+// frame carries the stream id and kind: OPEN (data is the client IP), DATA (bytes of the client
+// connection, whole frames from the gateway), CLOSE or LINK (first frame of a link, data is the
+// shared secret of the server; the stream id is not used).
+enum class StreamKind : uint8_t
+{
+  OPEN,
+  DATA,
+  CLOSE,
+  LINK
+};
+void append_stream_header(std::string &out, uint32_t stream, StreamKind kind, size_t size); // size: bytes of data that follow
+bool read_stream_header(std::string_view payload, uint32_t &stream, StreamKind &kind, std::string_view &data);
+
+// Heartbeat frames, sent as they are
+inline constexpr char PING_FRAME[FRAME_HEADER_SIZE] = {static_cast<char>(FRAME_PING), 0, 0, 0};
+inline constexpr char PONG_FRAME[FRAME_HEADER_SIZE] = {static_cast<char>(FRAME_PONG), 0, 0, 0};
+
+void set_socket_codec(int sock, chat::Codec codec); // Codec negotiated for the connection, used by the send functions
+// Local clients: once attached, the send and receive functions go through the shared memory rings
+// of the socket and the socket only carries wakeups. nullptr detaches it.
+void attach_shm_channel(int sock, std::unique_ptr<ShmChannel> channel);
+chat::Codec socket_codec(int sock);
+bool compress_frame(chat::Codec codec, const std::string &frame, std::string &compressed); // False if compression does not pay off
+
+// Path of a server Unix socket for the port, from a format in constants.h, inside the socket directory
+// of the user. create makes the directory first. Empty if the directory is missing or open to other users.
+std::string private_socket_path(const char *format, int port, bool create);
 
 #endif // MESSAGE_H
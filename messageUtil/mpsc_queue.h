@@ -0,0 +1,62 @@
+// mpsc_queue.h
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+// Lock-free multi-producer single-consumer queue (Vyukov). push is wait-free and may be called from
+// any thread; pop must only be called by the thread that owns the queue.
+template <typename T>
+class MpscQueue
+{
+public:
+  MpscQueue() : head_(new Node()), tail_(head_.load(std::memory_order_relaxed)) {}
+
+  ~MpscQueue()
+  {
+    T value;
+    while (pop(value))
+    {
+    }
+    delete tail_;
+  }
+
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+
+  void push(T value)
+  {
+    Node *node = new Node(std::move(value));
+    Node *previous = head_.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+  }
+
+  // False if the queue is empty. An element being pushed right now may show up on the next call.
+  bool pop(T &value)
+  {
+    Node *tail = tail_;
+    Node *next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr)
+      return false;
+    value = std::move(next->value);
+    tail_ = next;
+    delete tail;
+    return true;
+  }
+
+private:
+  struct Node
+  {
+    std::atomic<Node *> next{nullptr};
+    T value;
+
+    Node() = default;
+    explicit Node(T &&item) : value(std::move(item)) {}
+  };
+
+  std::atomic<Node *> head_; // Last pushed node, shared by the producers
+  Node *tail_;               // Already consumed node, only used by the consumer
+};
+
+#endif // MPSC_QUEUE_H
@@ -0,0 +1,167 @@
+// shm_ring.cpp
+#include "shm_ring.h"
+#include "constants.h"
+#include <algorithm>       // For std::min
+#include <cstring>         // For memcpy
+#include <cstdio>          // For perror
+#include <ctime>           // For timespec
+#include <fcntl.h>         // For F_ADD_SEALS
+#include <unistd.h>        // For ftruncate, close, syscall
+#include <sys/mman.h>      // For memfd_create, mmap
+#include <sys/stat.h>      // For fstat
+#include <sys/syscall.h>   // For SYS_futex
+#include <linux/futex.h>   // For FUTEX_WAIT, FUTEX_WAKE
+
+ShmRing::ShmRing(ShmRingHeader *header, char *data, uint32_t capacity)
+    : header_(header), data_(data), capacity_(capacity), head_(header->head.load()), tail_(header->tail.load())
+{
+}
+
+// Bytes in the ring; a counter corrupted by the other side counts as a full ring
+size_t ShmRing::used(uint32_t head, uint32_t tail) const
+{
+  return std::min<uint32_t>(head - tail, capacity_);
+}
+
+size_t ShmRing::write(const char *data, size_t size)
+{
+  size = std::min(size, capacity_ - used(head_, header_->tail.load()));
+  size_t offset = head_ & (capacity_ - 1);
+  size_t first = std::min(size, capacity_ - offset);
+  memcpy(data_ + offset, data, first);
+  memcpy(data_, data + first, size - first);
+  head_ += size;
+  header_->head.store(head_);
+  return size;
+}
+
+size_t ShmRing::read(char *data, size_t size)
+{
+  size = std::min(size, used(header_->head.load(), tail_));
+  size_t offset = tail_ & (capacity_ - 1);
+  size_t first = std::min(size, capacity_ - offset);
+  memcpy(data, data_ + offset, first);
+  memcpy(data + first, data_, size - first);
+  tail_ += size;
+  header_->tail.store(tail_);
+  return size;
+}
+
+bool ShmRing::prepare_consumer_wait()
+{
+  header_->consumer_waiting.store(1);
+  if (header_->head.load() == tail_)
+    return true;
+  header_->consumer_waiting.store(0);
+  return false;
+}
+
+bool ShmRing::prepare_producer_wait()
+{
+  header_->producer_waiting.store(1);
+  if (used(head_, header_->tail.load()) == capacity_)
+    return true;
+  header_->producer_waiting.store(0);
+  return false;
+}
+
+bool ShmRing::take_consumer_waiting()
+{
+  return header_->consumer_waiting.load() != 0 && header_->consumer_waiting.exchange(0) != 0;
+}
+
+bool ShmRing::take_producer_waiting()
+{
+  return header_->producer_waiting.load() != 0 && header_->producer_waiting.exchange(0) != 0;
+}
+
+// Sleeps while the counter still holds value; the futex is shared between processes, not private
+static void futex_wait(std::atomic<uint32_t> &counter, uint32_t value, int timeout_ms)
+{
+  struct timespec timeout = {timeout_ms / 1000, (timeout_ms % 1000) * 1000000L};
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&counter), FUTEX_WAIT, value, &timeout, nullptr, 0);
+}
+
+static void futex_wake(std::atomic<uint32_t> &counter)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&counter), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+
+void ShmRing::wait_readable(int timeout_ms)
+{
+  uint32_t head = header_->head.load();
+  if (head == tail_)
+    futex_wait(header_->head, head, timeout_ms);
+}
+
+void ShmRing::wait_writable(int timeout_ms)
+{
+  uint32_t tail = header_->tail.load();
+  if (used(head_, tail) == capacity_)
+    futex_wait(header_->tail, tail, timeout_ms);
+}
+
+void ShmRing::wake_consumer()
+{
+  futex_wake(header_->head);
+}
+
+void ShmRing::wake_producer()
+{
+  futex_wake(header_->tail);
+}
+
+// Layout of the memfd: header and data of the client to server ring, then the same for the other direction
+static constexpr size_t SHM_RING_STRIDE = sizeof(ShmRingHeader) + SHM_RING_SIZE;
+static constexpr size_t SHM_CHANNEL_SIZE = 2 * SHM_RING_STRIDE;
+static_assert((SHM_RING_SIZE & (SHM_RING_SIZE - 1)) == 0, "SHM_RING_SIZE must be a power of two");
+
+ShmChannel::~ShmChannel()
+{
+  if (memory != nullptr)
+    munmap(memory, size);
+  if (fd >= 0)
+    close(fd);
+}
+
+int create_shm_channel()
+{
+  int memfd = memfd_create("chat-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (memfd < 0)
+  {
+    perror("memfd_create failed");
+    return -1;
+  }
+  // Sealed size: the server maps it and a shrinking file would crash it with SIGBUS
+  if (ftruncate(memfd, SHM_CHANNEL_SIZE) < 0 || fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0)
+  {
+    perror("Shared memory setup failed");
+    close(memfd);
+    return -1;
+  }
+  return memfd;
+}
+
+std::unique_ptr<ShmChannel> map_shm_channel(int memfd)
+{
+  auto channel = std::make_unique<ShmChannel>();
+  channel->fd = memfd;
+  struct stat status;
+  int seals = fcntl(memfd, F_GET_SEALS);
+  if (fstat(memfd, &status) < 0 || static_cast<size_t>(status.st_size) != SHM_CHANNEL_SIZE || seals < 0 || !(seals & F_SEAL_SHRINK))
+    return nullptr;
+
+  void *memory = mmap(nullptr, SHM_CHANNEL_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+  if (memory == MAP_FAILED)
+  {
+    perror("mmap failed");
+    return nullptr;
+  }
+  channel->memory = memory;
+  channel->size = SHM_CHANNEL_SIZE;
+  char *base = static_cast<char *>(memory);
+  channel->to_server = ShmRing(reinterpret_cast<ShmRingHeader *>(base), base + sizeof(ShmRingHeader), SHM_RING_SIZE);
+  base += SHM_RING_STRIDE;
+  channel->to_client = ShmRing(reinterpret_cast<ShmRingHeader *>(base), base + sizeof(ShmRingHeader), SHM_RING_SIZE);
+  return channel;
+}
@@ -0,0 +1,75 @@
+// shm_ring.h
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Counters and wakeup flags of a ring, each counter on its own cache line. head and tail are
+// free-running 32-bit counters so a side can also sleep on them with a futex.
+struct ShmRingHeader
+{
+  alignas(64) std::atomic<uint32_t> head;             // Bytes written, only the producer moves it
+  alignas(64) std::atomic<uint32_t> tail;             // Bytes read, only the consumer moves it
+  alignas(64) std::atomic<uint32_t> consumer_waiting; // The consumer found the ring empty and waits for a wakeup
+  std::atomic<uint32_t> producer_waiting;             // The producer found the ring full and waits for a wakeup
+};
+
+// Single-producer single-consumer byte ring over shared memory. Each side keeps its own counter
+// locally and only publishes it, so the other process cannot make it read or write out of bounds.
+// A side about to sleep raises its waiting flag and checks the ring again; the other side takes the
+// flag after moving its counter and wakes the sleeper only then, so most calls need no syscall.
+class ShmRing
+{
+public:
+  ShmRing() = default;
+  ShmRing(ShmRingHeader *header, char *data, uint32_t capacity);
+
+  size_t write(const char *data, size_t size); // Producer: copies what fits, returns the bytes copied
+  size_t read(char *data, size_t size);        // Consumer: copies what is available, returns the bytes copied
+
+  // False if the ring changed meanwhile and the caller must try again instead of sleeping
+  bool prepare_consumer_wait();
+  bool prepare_producer_wait();
+  // True if the other side went to sleep and has to be woken, clearing its flag
+  bool take_consumer_waiting();
+  bool take_producer_waiting();
+
+  // Futex waits and wakeups on the shared counters, for a side that blocks (the client)
+  void wait_readable(int timeout_ms);
+  void wait_writable(int timeout_ms);
+  void wake_consumer();
+  void wake_producer();
+
+private:
+  size_t used(uint32_t head, uint32_t tail) const;
+
+  ShmRingHeader *header_ = nullptr;
+  char *data_ = nullptr;
+  uint32_t capacity_ = 0; // Power of two
+  uint32_t head_ = 0;     // Local copy of head, only valid on the producer
+  uint32_t tail_ = 0;     // Local copy of tail, only valid on the consumer
+};
+
+// Shared memory of a local connection: one ring per direction in a sealed memfd. The client
+// creates it and passes the descriptor to the server over the Unix socket.
+struct ShmChannel
+{
+  int fd = -1;
+  void *memory = nullptr;
+  size_t size = 0;
+  ShmRing to_server;
+  ShmRing to_client;
+
+  ShmChannel() = default;
+  ~ShmChannel();
+  ShmChannel(const ShmChannel &) = delete;
+  ShmChannel &operator=(const ShmChannel &) = delete;
+};
+
+int create_shm_channel();                               // memfd of an empty channel, -1 on error
+std::unique_ptr<ShmChannel> map_shm_channel(int memfd); // Takes the descriptor; nullptr if it is not a channel
+
+#endif // SHM_RING_H
@@ -0,0 +1,90 @@
+// task_pool.cpp
+#include "task_pool.h"
+
+// Index of the worker running on this thread, or -1 outside the pool
+static thread_local long current_worker = -1;
+static thread_local const TaskPool *current_pool = nullptr;
+
+TaskPool::TaskPool(unsigned threads)
+{
+  for (unsigned i = 0; i < threads; i++)
+    workers_.push_back(std::make_unique<Worker>());
+  for (size_t i = 0; i < workers_.size(); i++)
+    workers_[i]->thread = std::thread(&TaskPool::run, this, i);
+}
+
+TaskPool::~TaskPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  wakeup_.notify_all();
+  for (auto &worker : workers_)
+    worker->thread.join();
+}
+
+void TaskPool::submit(Task task)
+{
+  size_t index = current_pool == this ? current_worker : next_worker_++ % workers_.size();
+  {
+    std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+    queued_++;
+    workers_[index]->tasks.push_back(task);
+  }
+  // A worker about to sleep registers in sleepers_ before checking queued_, so it cannot miss this task
+  if (sleepers_ > 0)
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    wakeup_.notify_one();
+  }
+}
+
+bool TaskPool::take(size_t index, Task &task)
+{
+  {
+    Worker &own = *workers_[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty())
+    {
+      task = own.tasks.back();
+      own.tasks.pop_back();
+      queued_--;
+      return true;
+    }
+  }
+  for (size_t offset = 1; offset < workers_.size(); offset++)
+  {
+    Worker &victim = *workers_[(index + offset) % workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty())
+    {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+      queued_--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TaskPool::run(size_t index)
+{
+  current_worker = static_cast<long>(index);
+  current_pool = this;
+  Task task;
+  while (true)
+  {
+    if (take(index, task))
+    {
+      task.run(task.context);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleepers_++;
+    wakeup_.wait(lock, [this] { return queued_ > 0 || stopping_; });
+    sleepers_--;
+    if (stopping_ && queued_ == 0)
+      return;
+  }
+}
@@ -0,0 +1,56 @@
+// task_pool.h
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Unit of work of the pool: a plain function and its argument, submitting does not allocate
+struct Task
+{
+  void (*run)(void *) = nullptr;
+  void *context = nullptr;
+};
+
+// Work-stealing pool: every worker has its own deque, takes its newest task first and, when it runs
+// out, steals the oldest task of another worker. Tasks submitted by a worker stay on its deque.
+class TaskPool
+{
+public:
+  explicit TaskPool(unsigned threads);
+  ~TaskPool();
+
+  TaskPool(const TaskPool &) = delete;
+  TaskPool &operator=(const TaskPool &) = delete;
+
+  void submit(Task task);
+
+  // Tasks submitted and not yet taken by a worker
+  size_t queued() const { return queued_; }
+
+private:
+  struct Worker
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::thread thread;
+  };
+
+  void run(size_t index);
+  bool take(size_t index, Task &task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<size_t> queued_{0};      // Tasks waiting in any deque
+  std::atomic<size_t> sleepers_{0};    // Workers blocked on wakeup_
+  std::atomic<size_t> next_worker_{0}; // Round robin for tasks submitted from outside the pool
+  std::atomic<bool> stopping_{false};
+  std::mutex sleep_mutex_;
+  std::condition_variable wakeup_;
+};
+
+#endif // TASK_POOL_H
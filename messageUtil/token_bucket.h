@@ -0,0 +1,60 @@
+// token_bucket.h
+#ifndef TOKEN_BUCKET_H
+#define TOKEN_BUCKET_H
+
+#include <algorithm>
+#include <chrono>
+
+// Token bucket: refills rate tokens per second up to burst, a request is allowed if it can take its cost.
+// Not synchronized, the owner decides how it is shared.
+class TokenBucket
+{
+public:
+  TokenBucket(double rate, double burst) : rate_(rate), burst_(burst), tokens_(burst), last_(std::chrono::steady_clock::now()) {}
+
+  bool take(double cost, std::chrono::steady_clock::time_point now)
+  {
+    refill(now);
+    if (tokens_ < cost)
+      return false;
+    tokens_ -= cost;
+    return true;
+  }
+
+  // True if take(cost, now) would succeed, without taking anything
+  bool available(double cost, std::chrono::steady_clock::time_point now)
+  {
+    refill(now);
+    return tokens_ >= cost;
+  }
+
+  // True if the bucket refilled completely, so forgetting it does not reset any limit
+  bool full(std::chrono::steady_clock::time_point now)
+  {
+    refill(now);
+    return tokens_ >= burst_;
+  }
+
+  void reset(std::chrono::steady_clock::time_point now)
+  {
+    tokens_ = burst_;
+    last_ = now;
+  }
+
+private:
+  void refill(std::chrono::steady_clock::time_point now)
+  {
+    if (now > last_)
+    {
+      tokens_ = std::min(burst_, tokens_ + std::chrono::duration<double>(now - last_).count() * rate_);
+      last_ = now;
+    }
+  }
+
+  double rate_;
+  double burst_;
+  double tokens_;
+  std::chrono::steady_clock::time_point last_;
+};
+
+#endif // TOKEN_BUCKET_H
@@ -0,0 +1,353 @@
+// wire.cpp
+#include "wire.h"
+#include "message.h"
+#include <iostream>   // For std::cerr
+#include <cstring>    // For memcpy
+#include <sys/uio.h>  // For iovec
+
+namespace
+{
+  constexpr uint32_t WIRETYPE_VARINT = 0;
+  constexpr uint32_t WIRETYPE_LENGTH_DELIMITED = 2;
+
+  size_t varint_size(uint64_t value)
+  {
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+
+  void put_varint(std::string &out, uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+  }
+
+  void put_tag(std::string &out, uint32_t field, uint32_t wire_type)
+  {
+    put_varint(out, (field << 3) | wire_type);
+  }
+
+  size_t tag_size(uint32_t field)
+  {
+    return varint_size(field << 3);
+  }
+
+  size_t string_field_size(uint32_t field, size_t length)
+  {
+    return length == 0 ? 0 : tag_size(field) + varint_size(length) + length;
+  }
+
+  size_t varint_field_size(uint32_t field, uint64_t value)
+  {
+    return value == 0 ? 0 : tag_size(field) + varint_size(value);
+  }
+
+  void put_string_field(std::string &out, uint32_t field, const std::string &value)
+  {
+    if (value.empty())
+      return;
+    put_tag(out, field, WIRETYPE_LENGTH_DELIMITED);
+    put_varint(out, value.size());
+    out += value;
+  }
+
+  void put_varint_field(std::string &out, uint32_t field, uint64_t value)
+  {
+    if (value == 0)
+      return;
+    put_tag(out, field, WIRETYPE_VARINT);
+    put_varint(out, value);
+  }
+
+  bool read_varint(const char *&cursor, const char *end, uint64_t &value)
+  {
+    value = 0;
+    for (int shift = 0; shift < 64 && cursor < end; shift += 7)
+    {
+      uint8_t byte = static_cast<uint8_t>(*cursor++);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  // Walks the fields of an encoded message, calling on_field(field, wire_type, value, bytes) with the value
+  // of varint fields or the bytes of length-delimited ones. Other wire types are left to protobuf.
+  template <typename OnField>
+  bool decode_fields(std::string_view data, OnField on_field)
+  {
+    const char *cursor = data.data();
+    const char *end = data.data() + data.size();
+    while (cursor < end)
+    {
+      uint64_t tag, value = 0;
+      std::string_view bytes;
+      if (!read_varint(cursor, end, tag))
+        return false;
+      uint32_t wire_type = tag & 7;
+      if (wire_type == WIRETYPE_VARINT)
+      {
+        if (!read_varint(cursor, end, value))
+          return false;
+      }
+      else if (wire_type == WIRETYPE_LENGTH_DELIMITED)
+      {
+        if (!read_varint(cursor, end, value) || value > static_cast<uint64_t>(end - cursor))
+          return false;
+        bytes = std::string_view(cursor, value);
+        cursor += value;
+      }
+      else
+      {
+        return false;
+      }
+      if (tag >> 3 > UINT32_MAX || !on_field(static_cast<uint32_t>(tag >> 3), wire_type, value, bytes))
+        return false;
+    }
+    return true;
+  }
+
+  // Same check protobuf does on proto3 strings, so invalid text is never forwarded to other clients
+  bool valid_utf8(std::string_view text)
+  {
+    const unsigned char *cursor = reinterpret_cast<const unsigned char *>(text.data());
+    const unsigned char *end = cursor + text.size();
+    while (cursor < end)
+    {
+      if (*cursor < 0x80)
+      {
+        cursor++;
+        continue;
+      }
+      size_t length;
+      uint32_t code;
+      if ((*cursor & 0xE0) == 0xC0)
+      {
+        length = 2;
+        code = *cursor & 0x1F;
+      }
+      else if ((*cursor & 0xF0) == 0xE0)
+      {
+        length = 3;
+        code = *cursor & 0x0F;
+      }
+      else if ((*cursor & 0xF8) == 0xF0)
+      {
+        length = 4;
+        code = *cursor & 0x07;
+      }
+      else
+      {
+        return false;
+      }
+      if (static_cast<size_t>(end - cursor) < length)
+        return false;
+      for (size_t i = 1; i < length; i++)
+      {
+        if ((cursor[i] & 0xC0) != 0x80)
+          return false;
+        code = (code << 6) | (cursor[i] & 0x3F);
+      }
+      // Overlong forms, surrogates and code points past U+10FFFF
+      if ((length == 2 && code < 0x80) || (length == 3 && code < 0x800) || (length == 4 && code < 0x10000) ||
+          (code >= 0xD800 && code <= 0xDFFF) || code > 0x10FFFF)
+        return false;
+      cursor += length;
+    }
+    return true;
+  }
+
+  bool decode_string(uint32_t wire_type, std::string_view bytes, std::string_view &field)
+  {
+    if (wire_type != WIRETYPE_LENGTH_DELIMITED || !valid_utf8(bytes))
+      return false;
+    field = bytes;
+    return true;
+  }
+
+  // SendMessageRequest: recipient = 1, content = 2, channel = 3
+  bool decode_send_message(std::string_view data, SendMessageView &message)
+  {
+    return decode_fields(data, [&message](uint32_t field, uint32_t wire_type, uint64_t, std::string_view bytes) {
+      switch (field)
+      {
+      case 1:
+        return decode_string(wire_type, bytes, message.recipient);
+      case 2:
+        return decode_string(wire_type, bytes, message.content);
+      case 3:
+        return decode_string(wire_type, bytes, message.channel);
+      default:
+        return false;
+      }
+    });
+  }
+
+  // UpdateStatusRequest: username = 1, new_status = 2
+  bool decode_update_status(std::string_view data, UpdateStatusView &status)
+  {
+    return decode_fields(data, [&status](uint32_t field, uint32_t wire_type, uint64_t value, std::string_view bytes) {
+      switch (field)
+      {
+      case 1:
+        return decode_string(wire_type, bytes, status.username);
+      case 2:
+        // Unknown statuses go through protobuf, the handler answers them with BAD_REQUEST
+        status.new_status = static_cast<chat::UserStatus>(static_cast<int32_t>(value));
+        return wire_type == WIRETYPE_VARINT && chat::UserStatus_IsValid(static_cast<int32_t>(value));
+      default:
+        return false;
+      }
+    });
+  }
+}
+
+bool encode_incoming_message(const ChatMessage &message, const std::string &notice, IncomingMessageFrame &frame)
+{
+  const size_t content_size = message.content ? message.content->size() : 0;
+
+  // IncomingMessageResponse: sender = 1, content = 2, type = 3, message_id = 4, channel = 5
+  size_t incoming_size = string_field_size(1, message.sender.size()) +
+                         string_field_size(2, content_size) +
+                         varint_field_size(3, message.type) +
+                         varint_field_size(4, message.message_id) +
+                         string_field_size(5, message.channel.size());
+
+  // Response: operation = 1, status_code = 2, message = 3, incoming_message = 5
+  size_t response_size = varint_field_size(1, chat::Operation::INCOMING_MESSAGE) +
+                         varint_field_size(2, chat::StatusCode::OK) +
+                         string_field_size(3, notice.size()) +
+                         tag_size(5) + varint_size(incoming_size) + incoming_size;
+
+  // Frames above BUFFER_SIZE can only reach recipients that negotiated compression
+  if (response_size > MAX_DECOMPRESSED_SIZE)
+  {
+    std::cerr << "Message size exceeds maximum size. Size: " << response_size << ", Maximum: " << MAX_DECOMPRESSED_SIZE << std::endl;
+    return false;
+  }
+
+  frame.head.assign(FRAME_HEADER_SIZE, '\0');
+  uint32_t length = htonl(static_cast<uint32_t>(response_size));
+  memcpy(&frame.head[0], &length, FRAME_HEADER_SIZE);
+  put_varint_field(frame.head, 1, chat::Operation::INCOMING_MESSAGE);
+  put_varint_field(frame.head, 2, chat::StatusCode::OK);
+  put_string_field(frame.head, 3, notice);
+  put_tag(frame.head, 5, WIRETYPE_LENGTH_DELIMITED);
+  put_varint(frame.head, incoming_size);
+  put_string_field(frame.head, 1, message.sender);
+  if (content_size > 0)
+  {
+    put_tag(frame.head, 2, WIRETYPE_LENGTH_DELIMITED);
+    put_varint(frame.head, content_size);
+  }
+
+  frame.content = content_size > 0 ? message.content : nullptr;
+  for (auto &compressed : frame.compressed)
+    compressed.reset();
+
+  frame.tail.clear();
+  put_varint_field(frame.tail, 3, message.type);
+  put_varint_field(frame.tail, 4, message.message_id);
+  put_string_field(frame.tail, 5, message.channel);
+  return true;
+}
+
+int incoming_message_parts(const IncomingMessageFrame &frame, chat::Codec codec, struct iovec parts[3], std::shared_ptr<const std::string> &compressed)
+{
+  size_t content_size = frame.content ? frame.content->size() : 0;
+  size_t payload_size = frame.head.size() - FRAME_HEADER_SIZE + content_size + frame.tail.size();
+  if (codec != chat::Codec::NO_COMPRESSION && payload_size >= COMPRESSION_THRESHOLD)
+  {
+    std::lock_guard<std::mutex> lock(frame.compress_mutex);
+    auto &cached = frame.compressed[codec];
+    if (!cached)
+    {
+      // Compressed once per codec, an empty frame records that compression did not pay off
+      std::string whole = frame.head;
+      if (frame.content)
+        whole += *frame.content;
+      whole += frame.tail;
+      auto result = std::make_shared<std::string>();
+      compress_frame(codec, whole, *result);
+      cached = result;
+    }
+    if (!cached->empty())
+    {
+      compressed = cached;
+      parts[0] = {const_cast<char *>(compressed->data()), compressed->size()};
+      return 1;
+    }
+  }
+  if (payload_size > BUFFER_SIZE)
+  {
+    std::cerr << "Message size exceeds buffer capacity. Size: " << payload_size << ", Buffer Capacity: " << BUFFER_SIZE << std::endl;
+    return 0;
+  }
+
+  int count = 0;
+  parts[count++] = {const_cast<char *>(frame.head.data()), frame.head.size()};
+  if (frame.content)
+    parts[count++] = {const_cast<char *>(frame.content->data()), frame.content->size()};
+  if (!frame.tail.empty())
+    parts[count++] = {const_cast<char *>(frame.tail.data()), frame.tail.size()};
+  return count;
+}
+
+bool send_incoming_message(int sock, const IncomingMessageFrame &frame)
+{
+  struct iovec parts[3];
+  std::shared_ptr<const std::string> compressed;
+  int count = incoming_message_parts(frame, socket_codec(sock), parts, compressed);
+  return count > 0 && send_frame_parts(sock, parts, count);
+}
+
+bool decode_request_view(std::string_view payload, RequestView &request)
+{
+  request = RequestView();
+  // Request: operation = 1, send_message = 3, update_status = 4. Repeated payloads are merged and
+  // a payload replaces the other one of the oneof, like protobuf does.
+  bool decoded = decode_fields(payload, [&request](uint32_t field, uint32_t wire_type, uint64_t value, std::string_view bytes) {
+    switch (field)
+    {
+    case 1:
+      request.operation = static_cast<chat::Operation>(static_cast<int32_t>(value));
+      return wire_type == WIRETYPE_VARINT;
+    case 3:
+      request.update_status = UpdateStatusView();
+      return wire_type == WIRETYPE_LENGTH_DELIMITED && decode_send_message(bytes, request.send_message);
+    case 4:
+      request.send_message = SendMessageView();
+      return wire_type == WIRETYPE_LENGTH_DELIMITED && decode_update_status(bytes, request.update_status);
+    default:
+      return false;
+    }
+  });
+  return decoded && (request.operation == chat::Operation::SEND_MESSAGE || request.operation == chat::Operation::UPDATE_STATUS);
+}
+
+void request_view(const chat::Request &request, RequestView &view)
+{
+  view = RequestView();
+  view.operation = request.operation();
+  if (request.has_send_message())
+  {
+    view.send_message.recipient = request.send_message().recipient();
+    view.send_message.content = request.send_message().content();
+    view.send_message.channel = request.send_message().channel();
+  }
+  if (request.has_update_status())
+  {
+    view.update_status.username = request.update_status().username();
+    view.update_status.new_status = request.update_status().new_status();
+  }
+}
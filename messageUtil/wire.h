@@ -0,0 +1,74 @@
+// wire.h
+#ifndef WIRE_H
+#define WIRE_H
+
+#include "chat.pb.h"
+#include <string>
+#include <string_view>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <sys/uio.h>
+
+// Message content shared by every recipient, the bytes are stored once
+using SharedContent = std::shared_ptr<const std::string>;
+
+// Chat message being forwarded by the server
+struct ChatMessage
+{
+  std::string sender;
+  SharedContent content;
+  chat::MessageType type = chat::MessageType::BROADCAST;
+  std::string channel;
+  uint64_t message_id = 0; // Only set for recipients in ack mode
+};
+
+// INCOMING_MESSAGE frame split around the content, which is referenced instead of copied
+struct IncomingMessageFrame
+{
+  std::string head; // Length prefix, Response fields and the fields before the content
+  SharedContent content;
+  std::string tail; // IncomingMessageResponse fields after the content
+  // Compressed copy per codec, built by the first recipient that needs it and reused by the rest.
+  // Recipients may be served by different threads, compress_mutex guards the copies.
+  mutable std::shared_ptr<const std::string> compressed[chat::Codec_ARRAYSIZE];
+  mutable std::mutex compress_mutex;
+};
+
+// Hand-built encoding of a chat::Response carrying an IncomingMessageResponse. Produces the same
+// bytes protobuf would, false if the frame would exceed MAX_DECOMPRESSED_SIZE.
+bool encode_incoming_message(const ChatMessage &message, const std::string &notice, IncomingMessageFrame &frame);
+// Parts to write for the frame on a connection using codec: the shared compressed copy (kept alive by
+// compressed) or head, content and tail. Returns the number of parts, 0 if the frame does not fit.
+int incoming_message_parts(const IncomingMessageFrame &frame, chat::Codec codec, struct iovec parts[3], std::shared_ptr<const std::string> &compressed);
+// Sends the frame, compressed with the codec of the socket when it is large enough
+bool send_incoming_message(int sock, const IncomingMessageFrame &frame);
+
+// Fields of the hot requests, pointing into the frame they were decoded from
+struct SendMessageView
+{
+  std::string_view recipient;
+  std::string_view content;
+  std::string_view channel;
+};
+
+struct UpdateStatusView
+{
+  std::string_view username;
+  chat::UserStatus new_status = chat::UserStatus::ONLINE;
+};
+
+struct RequestView
+{
+  chat::Operation operation = chat::Operation::REGISTER_USER;
+  SendMessageView send_message;
+  UpdateStatusView update_status;
+};
+
+// Hand-written decoding of SEND_MESSAGE and UPDATE_STATUS requests, without protobuf. False for other
+// operations, unknown fields or unusual encodings: the caller then parses the payload with protobuf.
+bool decode_request_view(std::string_view payload, RequestView &request);
+// Same view over a request already parsed by protobuf
+void request_view(const chat::Request &request, RequestView &view);
+
+#endif // WIRE_H
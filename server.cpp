@@ -16,6 +16,8 @@
 #include <unistd.h>
 #include "./messageUtil/chat.pb.h" // Include the generated protobuf header
 #include "./messageUtil/message.h"
+#include "./messageUtil/wire.h"
+#include "./messageUtil/compression.h"
 #include <iostream> // For std::cerr
 #include <vector>   // For std::vector
 #include <cstring>  // For memcpy
@@ -24,474 +26,4548 @@
 #include "./messageUtil/constants.h"
 #include <chrono>
 #include <cstring> // For strerror
+#include <csignal> // For signal
+#include <set>
+#include <atomic>
+#include <unordered_map>
+#include <algorithm>
+#include <memory>
+#include <deque>
+#include <string_view>
+#include <google/protobuf/arena.h>
+#include <sys/epoll.h>   // For epoll
+#include <sys/eventfd.h> // For eventfd
+#include <sys/timerfd.h> // For timerfd
+#include "./messageUtil/mpsc_queue.h"
+#include "./messageUtil/task_pool.h"
+#include "./messageUtil/token_bucket.h"
+#include "./messageUtil/hash_ring.h"
+#include "./messageUtil/shm_ring.h"
+#include <sys/resource.h> // For getrlimit
+#include <sys/un.h>       // For sockaddr_un
+#include <netdb.h>        // For getaddrinfo
+#include <poll.h>         // For poll
 
 
 // Declaración de variables globales
 volatile sig_atomic_t running = 1; // Variable para mantener el servidor en ejecución
-int server_fd; // Descriptor del socket del servidor
+
+// Identificador interno y compacto de un usuario: índice en los arreglos de UserTable
+using UserId = uint32_t;
+constexpr UserId NO_USER = UINT32_MAX;
+
+// Estado por usuario como estructura de arreglos indexada por UserId. El nombre se guarda una
+// sola vez; los índices por nombre usan string_view hacia names, que no se mueve al crecer.
+struct UserTable
+{
+  std::deque<std::string> names;
+  std::vector<std::string> ips;
+  std::vector<int> sockets;
+  std::vector<chat::UserStatus> statuses;
+  std::vector<std::chrono::steady_clock::time_point> last_active;
+  std::vector<uint8_t> in_use;
+  std::vector<uint8_t> ack_mode;  // Usuario registrado en modo ack
+  std::vector<UserId> free_ids;   // Ids liberados que se reutilizan antes de crecer
+};
 
 // Estructuras de datos para manejar usuarios y sesiones
-std::map<int, std::string> client_sessions; // Mapa de descriptores de socket a nombres de usuario
-std::map<std::string, std::string> user_details; // Mapa de nombres de usuario a direcciones IP
-std::map<std::string, chat::UserStatus> user_status;                      // Maps username to status
+UserTable users;
+std::unordered_map<std::string_view, UserId> user_ids;  // Tabla de internamiento: nombre -> id
+std::map<std::string_view, UserId> users_by_name;       // Índice ordenado por nombre (listas y paginación)
+std::set<std::string_view> users_by_status[3];          // Índice ordenado de usuarios por estado (ONLINE, BUSY, OFFLINE)
 std::mutex clients_mutex;  // Mutex para controlar el acceso a las estructuras de datos compartidas
-std::map<std::string, std::chrono::steady_clock::time_point> last_active;
-std::mutex activity_mutex;
+std::set<int> presence_subscribers;   // Sockets suscritos a cambios de presencia (protegido por clients_mutex)
+uint64_t registry_version = 0;        // Versión del registro de usuarios, aumenta con cada cambio (protegido por clients_mutex)
 
+// Respuesta GET_USERS (todos) ya serializada y la versión del registro con la que se armó (protegido por clients_mutex)
+std::shared_ptr<const std::string> user_list_cache;
+uint64_t user_list_cache_version = 0;
+uint64_t user_list_cache_remote_version = 0; // Versión de remote_users con la que se armó
+std::shared_ptr<const std::string> user_list_cache_compressed[chat::Codec_ARRAYSIZE]; // Misma respuesta comprimida por codec
 
-void terminationHandler()
+// Estado de entregas en modo ack (protegido por delivery_mutex)
+struct PendingDelivery
 {
-  std::string input;
-  while (true)
-  {
-    std::getline(std::cin, input);
-    if (input == "exit")
-    {
-      running = false;
-      break;
-    }
-  }
+  std::string recipient;
+  std::string sender;
+  ChatMessage message;
+  std::chrono::steady_clock::time_point last_sent;
+  int attempts;
+};
+std::map<uint64_t, PendingDelivery> pending_deliveries;       // message id -> direct message waiting for its ack
+std::map<std::string, std::set<uint64_t>> outstanding_by_sender; // sender -> ids not yet acked
+std::map<std::string, uint64_t> last_id_by_sender;             // sender -> last id assigned
+std::map<std::string, uint64_t> receipt_sent_through;          // sender -> last cumulative receipt sent
+std::set<std::string> receipt_dirty;                            // senders with a receipt to flush
+std::mutex delivery_mutex;
+std::atomic<uint64_t> next_message_id{1};
 
-  // Close the server socket
-  close(server_fd);
-  std::cout << "Server terminated." << std::endl;
-  exit(0); // Terminate the program
-}
+// Canales: los miembros se guardan como un vector ordenado de sockets (protegido por channels_mutex)
+struct Channel
+{
+  std::vector<int> members;
+};
+std::unordered_map<std::string, Channel> channels;
+std::mutex channels_mutex;
 
-void update_user_status_and_time(int client_sock, const chat::UpdateStatusRequest &status_request)
+struct Session;
+struct Reactor;
+
+// Sesión de un socket con el reactor y la generación que tenía al buscarla
+struct SessionTarget
 {
-  std::lock_guard<std::mutex> lock(clients_mutex);
-  user_status[client_sessions[client_sock]] = status_request.new_status();
-  // last_active[client_sessions[client_sock]] = std::chrono::system_clock::now(); TODO: Move this to any action retrieved on the general handling
-}
+  Session *session = nullptr;
+  Reactor *reactor = nullptr;
+  uint64_t generation = 0;
+  int sock = -1;
+};
+
+// Transferencias por partes: el servidor reenvía cada parte al llegar y no guarda el contenido
+struct Transfer
+{
+  int owner;                   // Socket que envía el contenido
+  uint64_t owner_generation;   // Generación de la sesión del emisor, el crédito se le devuelve sin clients_mutex
+  std::vector<SessionTarget> recipients; // Conexiones que lo reciben, tomadas al empezar
+  uint64_t total_size;
+  uint64_t received = 0;
+  uint32_t next_sequence = 0;
+  uint32_t uncredited = 0;     // Partes ya escritas a todos los destinatarios cuyo crédito aún no se devolvió al emisor
+};
+std::unordered_map<uint64_t, Transfer> transfers;
+std::mutex transfers_mutex;
+std::atomic<uint64_t> next_transfer_id{1};
+
+
+// Federación: cada nodo (proceso servidor) es dueño de los usuarios conectados a él y replica la
+// presencia de los usuarios de los demás nodos, para reenviarles los mensajes y listarlos sin preguntar.
+std::string node_name; // Nombre de este nodo, el server_name de la línea de comandos
+std::string link_secret; // Secreto compartido de los nodos y gateways (--secret); sin él este nodo no acepta enlaces
+uint64_t incarnation = 0; // Elegida al arrancar; si el nodo reinicia, sus pares descartan lo que sabían de él
+std::unordered_map<std::string, int> peer_sockets;       // Nodo -> socket de su enlace hacia este nodo (protegido por clients_mutex)
+
+// Estado de un usuario en la réplica, con la versión de su nodo cuando cambió
+struct PresenceRecord
+{
+  chat::UserStatus status = chat::UserStatus::ONLINE;
+  uint64_t version = 0;
+  bool removed = false; // Lápida: el usuario salió, se borra pasados GOSSIP_TOMBSTONE_TTL_MS
+  std::chrono::steady_clock::time_point removed_at;
+};
+
+// Posición de un nodo en el vector de versiones
+struct NodeClock
+{
+  uint64_t incarnation = 0;
+  uint64_t version = 0;   // Todos los cambios del nodo hasta esta versión están aplicados
+  uint64_t compacted = 0; // Lápida más nueva ya borrada: un par que va más atrás necesita la tabla completa
+};
 
 /**
- * UPDATE_STATUS main function
+ * Réplica de la presencia del clúster, una tabla por nodo dueño (incluido este, que es lo que este nodo
+ * difunde). Se propaga por chismorreo: los cambios salen enseguida por el enlace de cada nodo y, cada
+ * GOSSIP_INTERVAL_MS, los pares comparan vectores de versiones y se mandan lo que le falta al otro.
+ * Todo protegido por clients_mutex.
  */
-void update_status(const chat::Request &request, int client_sock, chat::Operation operation)
+std::unordered_map<std::string, std::map<std::string, PresenceRecord>> node_presence;
+std::unordered_map<std::string, NodeClock> node_clocks;
+std::map<std::string, std::string, std::less<>> remote_users; // Usuario de otro nodo -> nodo, ordenado por nombre
+std::set<std::string_view> remote_by_status[3];                // Índice por estado de remote_users (claves de remote_users)
+uint64_t remote_users_version = 0;                             // Aumenta con cada cambio de remote_users
+// Ubicación de los usuarios: este nodo, los pares nombrados en --peer y los que se presentaron por su enlace.
+// Un par sale recién cuando su enlace lleva NODE_DOWN_GRACE_MS caído (protegido por clients_mutex)
+HashRing ring;
+
+/**
+ * Enlace saliente hacia un nodo par. Los handlers encolan en pending los cambios del directorio y los
+ * mensajes para ese nodo, y el hilo del enlace los manda juntos en un PEER_BATCH cada PEER_BATCH_INTERVAL_MS.
+ */
+struct PeerLink
 {
-  auto status_request = request.update_status();
-  update_user_status_and_time(client_sock, status_request);
-  chat::Response response;
-  response.set_operation(operation);
-  response.set_message("Status updated successfully."); 
-  response.set_status_code(chat::StatusCode::OK);
-  send_response(client_sock, response);
-}
+  std::string address;      // host:puerto del nodo
+  std::mutex mutex;
+  std::string node;         // Nombre del nodo: el de --peer, o el que responde al primer lote del enlace (protegido por mutex)
+  bool named = false;       // El nombre vino en --peer: un par que responda con otro se rechaza
+  bool up = false;          // El par respondió en el enlace actual (protegido por mutex)
+  chat::PeerBatch pending;  // Lote que se está juntando (protegido por mutex)
+  size_t pending_bytes = 0; // Bytes de mensajes en pending (protegido por mutex)
+};
+std::vector<std::unique_ptr<PeerLink>> peer_links; // Uno por nodo par, se arman al arrancar
 
+// Aviso de la cadena de solicitudes de una sesión a su reactor
+enum class SessionControl
+{
+  NONE,
+  RESUME_READING, // La cadena vació la cola de entrada, se vuelve a leer la conexión
+  CLOSE,          // La sesión ya se limpió, solo falta cerrar el socket
+  DISCONNECT,     // Cerrar la conexión después de escribir lo que ya tiene encolado
+  ATTACH_SHARED_MEMORY, // El cliente local pasa a los anillos de shm_pending, lo que sigue ya no va por el socket
+};
 
-void signalHandler(int signum)
+// Frame para una conexión de otro reactor: ya serializado (frame) o un mensaje entrante que el
+// reactor dueño arma con el codec de la conexión (message). Se descarta si la generación de la
+// sesión cambió, es decir si se cerró (y quizás se reutilizó) antes de que el reactor lo procese.
+struct Delivery
 {
-  std::cout << "\nInterrupt signal (" << signum << ") received.\n";
+  Session *session = nullptr;
+  uint64_t generation = 0;
+  std::shared_ptr<const std::string> frame;
+  std::shared_ptr<const IncomingMessageFrame> message;
+  SessionControl control = SessionControl::NONE;
+};
 
-  // Close the server socket
-  close(server_fd);
-  running = false;
+/**
+ * Hilo con su propio socket de escucha (SO_REUSEPORT), su epoll y sus conexiones. Es el único que
+ * escribe en ellas: los demás hilos le dejan los frames en su buzón MPSC y lo despiertan con wake_fd.
+ */
+struct Reactor
+{
+  int listen_fd = -1;
+  int epoll_fd = -1;
+  int wake_fd = -1;
+  int heartbeat_fd = -1;                 // timerfd que marca cada intervalo de heartbeat
+  uint64_t heartbeat_tick = 0;           // Intervalos de heartbeat transcurridos, solo lo usa el reactor
+  MpscQueue<Delivery> deliveries;
+  bool accepting = true;                 // listen_fd registrado en el epoll; se pausa bajo presión
+  std::atomic<bool> reading_stopped{false}; // Dejó de leer sus conexiones porque se está drenando
+  std::atomic<uint64_t> quiet_round{0};  // Última vuelta de drenado en la que sus salidas estaban vacías
+  std::atomic<bool> frozen{false};       // Ya vio output_frozen: no vuelve a escribir ni a leer sus sockets
+  std::atomic<bool> wake_pending{false}; // Ya hay un aviso en wake_fd, los siguientes push no escriben
+  std::vector<Session *> dirty;          // Sesiones con salida pendiente de escribir en esta vuelta
+  std::thread thread;
+};
 
-  std::cout << "Server terminated due to signal." << std::endl;
-  exit(signum);
-}
-void send_message_to_client(int client_sock, const chat::IncomingMessageResponse& message_response, chat::MessageType type) {
-    chat::Response response;
-    response.set_operation(chat::INCOMING_MESSAGE);
-    response.set_status_code(chat::StatusCode::OK);
-    auto* incoming_message = response.mutable_incoming_message();
-    incoming_message->CopyFrom(message_response);
-    incoming_message->set_type(type);
-    std::string response_str;
-    response.SerializeToString(&response_str);
-    send(client_sock, response_str.c_str(), response_str.size(), 0);
-}
+std::vector<std::unique_ptr<Reactor>> reactors;
+std::unique_ptr<TaskPool> request_pool; // Workers que atienden las solicitudes, aparte de los reactores
 
+std::atomic<size_t> open_connections{0};      // Conexiones aceptadas y aún abiertas
+std::atomic<size_t> pending_registrations{0}; // Conexiones aceptadas que todavía no registraron un usuario
 
-// Función para actualizar la inactividad de los usuarios
-void update_inactivity() {
-    while (true)
-    {
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+std::atomic<bool> draining{false};      // Apagado o actualización en curso: los reactores no aceptan ni leen
+std::atomic<bool> output_frozen{false}; // Los sockets ya pasaron a otro proceso, no se escribe más en ellos
+std::atomic<uint64_t> drain_round{0};   // Vuelta pedida por quien espera que los reactores vacíen sus salidas
 
-        std::lock_guard<std::mutex> lock(clients_mutex);
-        auto now = std::chrono::steady_clock::now();
+// Presión que justifica dejar de aceptar: el backlog del kernel retiene las conexiones nuevas mientras tanto
+bool admission_paused()
+{
+  return draining || pending_registrations >= MAX_PENDING_REGISTRATIONS || request_pool->queued() >= MAX_QUEUED_SESSIONS;
+}
+thread_local Reactor *current_reactor = nullptr; // Reactor que corre en el hilo, nullptr en los demás hilos
 
-        for (auto &entry : last_active)
-        {
-            const std::string &username = entry.first;
-            auto last_activity = entry.second;
+// Arena con bloque inicial propio, así las solicitudes pequeñas no usan malloc
+google::protobuf::ArenaOptions session_arena_options(char *initial_block)
+{
+  google::protobuf::ArenaOptions options;
+  options.initial_block = initial_block;
+  options.initial_block_size = ARENA_INITIAL_BLOCK_SIZE;
+  options.start_block_size = ARENA_INITIAL_BLOCK_SIZE;
+  options.max_block_size = BUFFER_SIZE;
+  return options;
+}
 
-            // Asegúrate de que el intervalo calculado sea con el mismo tipo de reloj
-            if (std::chrono::duration_cast<std::chrono::seconds>(now - last_activity).count() > AUTO_OFFLINE_SECONDS)
-            {
-                if (user_status[username] != chat::UserStatus::OFFLINE)
-                {
-                    // chat::Response response;
-                    // response.set_operation(chat::Operation::UPDATE_STATUS);
-                    // response.set_message("User has been set to OFFLINE due to inactivity."); 
-                    // response.set_status_code(chat::StatusCode::OK);
-                    user_status[username] = chat::UserStatus::OFFLINE;
-                    std::cout << "User " << username << " has been set to OFFLINE due to inactivity." << std::endl;
-                }
-            }
-        }
+// Límite compartido por las conexiones de una misma IP; el mutex es por IP, no global
+struct IpLimiter
+{
+  std::mutex mutex;
+  TokenBucket bucket{IP_RATE_LIMIT, IP_RATE_BURST};
+};
+std::unordered_map<std::string, std::shared_ptr<IpLimiter>> ip_limiters; // Protegido por ip_limiters_mutex
+std::mutex ip_limiters_mutex;
+
+// Límite de la IP, se crea con la primera conexión que llega desde ella
+std::shared_ptr<IpLimiter> ip_limiter(const std::string &ip)
+{
+  std::lock_guard<std::mutex> lock(ip_limiters_mutex);
+  auto &limiter = ip_limiters[ip];
+  if (!limiter)
+  {
+    limiter = std::make_shared<IpLimiter>();
+  }
+  return limiter;
+}
+
+// Olvida las IPs sin conexiones cuyo límite ya se recargó por completo, así reconectar no lo reinicia
+void forget_idle_ip_limiters()
+{
+  auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(ip_limiters_mutex);
+  for (auto it = ip_limiters.begin(); it != ip_limiters.end();)
+  {
+    bool idle = it->second.use_count() == 1;
+    if (idle)
+    {
+      std::lock_guard<std::mutex> bucket_lock(it->second->mutex);
+      idle = it->second->bucket.full(now);
     }
+    it = idle ? ip_limiters.erase(it) : std::next(it);
+  }
 }
 
+// Parte de la salida pendiente de una conexión. Sin owner, son los siguientes size bytes de
+// write_buffer; con owner, un frame compartido entre destinatarios que owner mantiene vivo.
+struct OutboundPiece
+{
+  std::shared_ptr<const void> owner;
+  const char *data = nullptr;
+  size_t size = 0;
+};
 
-void send_broadcast_message(const chat::IncomingMessageResponse &message_response, int client_sock) {
-    std::lock_guard<std::mutex> lock(clients_mutex);
+/**
+ * Estado de una conexión. Las sesiones salen de un pool y vuelven a la lista libre al
+ * desconectarse con su arena y su buffer de lectura, así las olas de reconexiones no
+ * fragmentan el heap ni compiten por el allocator global.
+ */
+struct Session
+{
+  int sock = -1;
+  std::atomic<Reactor *> reactor{nullptr}; // Único hilo que lee y escribe en la conexión
+  std::atomic<uint64_t> generation{0}; // Cambia cada vez que la sesión se toma o se libera
+  UserId user = NO_USER;             // Usuario registrado en la conexión (protegido por clients_mutex)
+  TokenBucket rate_limit{USER_RATE_LIMIT, USER_RATE_BURST}; // Límite del usuario, solo lo usa la cadena de la sesión
+  std::string ip;                                           // IP de origen de la conexión
+  std::shared_ptr<IpLimiter> ip_limiter;                    // Límite de la IP de origen
+  std::vector<std::string> channels; // Canales a los que pertenece (protegido por channels_mutex)
+  std::string receive_buffer;        // Buffer de lectura de frames, conserva su capacidad
+  // Salida pendiente, solo la toca el reactor dueño
+  std::deque<OutboundPiece> outbox;
+  std::string write_buffer;          // Frames serializados por el reactor, conserva su capacidad
+  size_t write_buffer_sent = 0;      // Bytes de write_buffer ya escritos
+  size_t piece_sent = 0;             // Bytes de la primera parte de outbox ya escritos
+  size_t pending_output = 0;         // Bytes en outbox sin escribir
+  bool dirty = false;                // Está en la lista dirty del reactor
+  bool want_write = false;           // Registrada con EPOLLOUT porque el socket se llenó
+  bool broken = false;               // Se cortó por error de escritura o cliente lento, solo falta cerrarla
+  bool reading = true;               // Registrada con EPOLLIN (el reactor deja de leer si la cola de entrada se llena)
+  bool detached = false;             // Ya no está en el epoll del reactor
+  uint64_t heard_tick = 0;           // Último intervalo de heartbeat en el que llegaron bytes de la conexión
+  uint64_t accepted_tick = 0;        // Intervalo de heartbeat en el que se aceptó, para el plazo de registro
+  // Cadena serial de solicitudes: el reactor agrega a inbox y un solo worker a la vez las atiende en orden
+  std::mutex inbox_mutex;
+  std::string inbox;                 // Payloads pendientes, cada uno precedido por su largo (protegido por inbox_mutex)
+  std::string batch;                 // Payloads que atiende el worker, se intercambia con inbox
+  bool scheduled = false;            // La cadena tiene una tarea en el pool (protegido por inbox_mutex)
+  bool paused = false;               // El reactor dejó de leer hasta que la cadena vacíe inbox (protegido por inbox_mutex)
+  bool closing = false;              // Se está cerrando, no se aceptan más solicitudes (protegido por inbox_mutex)
+  bool awaiting_registration = false; // Cuenta en pending_registrations hasta registrar un usuario
+  std::string peer_node;             // Nodo federado que usa la conexión como enlace, vacío para clientes (protegido por clients_mutex)
+  // Gateway: conexión de un cliente multiplexada en el enlace de un gateway, o el enlace mismo. Solo las toca el reactor
+  Session *gateway = nullptr;        // Enlace por el que llega la conexión, nullptr si tiene socket propio
+  uint32_t stream = 0;               // Id de la conexión en el gateway
+  bool stream_closed = false;        // El gateway ya sabe que la conexión se cerró
+  bool gateway_link = false;         // La conexión es el enlace de un gateway
+  bool streams_paused = false;       // Alguna conexión del enlace no se está leyendo
+  bool close_deferred = false;       // El enlace ya se limpió y se cierra cuando se cierre su última conexión
+  std::unordered_map<uint32_t, Session *> streams; // Conexiones que multiplexa el enlace
+  // Clientes locales: llegan por el socket Unix y pueden pasar sus frames a anillos en memoria compartida
+  bool local = false;                // Conexión del socket Unix local
+  std::atomic<int> passed_fd{-1};    // Último descriptor que mandó el cliente, lo toma OPEN_SHARED_MEMORY
+  bool shm_opened = false;           // Ya pidió memoria compartida, solo lo usa la cadena de la sesión
+  std::unique_ptr<ShmChannel> shm_pending; // Anillos que la cadena le pasa al reactor con ATTACH_SHARED_MEMORY
+  std::unique_ptr<ShmChannel> shm;   // Anillos en uso; el socket solo trae avisos y el cierre. Solo los toca el reactor
+  alignas(std::max_align_t) char arena_block[ARENA_INITIAL_BLOCK_SIZE]; // La arena exige un bloque alineado
+  google::protobuf::Arena arena;     // Arena de la solicitud en curso, se reinicia después de cada una
 
-    std::cout << "Broadcasting message from client socket " << client_sock << std::endl;
+  Session() : arena(session_arena_options(arena_block)) {}
+};
 
-    for (const auto &session : client_sessions) {
-        if (session.first != client_sock) { 
-            chat::Response response_to_recipient;
-            response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
-            response_to_recipient.set_message("Broadcast message incoming.");
-            response_to_recipient.set_status_code(chat::StatusCode::OK);
-            response_to_recipient.mutable_incoming_message()->CopyFrom(message_response);
-            send_response(session.first, response_to_recipient);
-        }
-    }
+std::deque<Session> session_pool;      // Todas las sesiones creadas, no se mueven ni se liberan
+std::vector<Session *> free_sessions;  // Sesiones listas para reutilizar (protegido por clients_mutex)
+// Descriptor de socket -> sesión. Tiene una entrada por descriptor posible y no cambia de tamaño,
+// así cualquier hilo la consulta sin lock para saber a qué reactor mandar un frame.
+std::vector<std::atomic<Session *>> socket_sessions;
+thread_local Session *current_session = nullptr; // Sesión atendida por el hilo
 
-    chat::Response response_to_sender;
-    response_to_sender.set_message("Broadcast message sent successfully.");
-    response_to_sender.set_status_code(chat::StatusCode::OK);
-    send_response(client_sock, response_to_sender);
+// Las conexiones que llegan por un gateway no tienen descriptor: usan ids desde stream_sock_base, después
+// de todos los descriptores posibles, y así comparten socket_sessions y todo el código que va por socket.
+int stream_sock_base = 0;
+int next_stream_sock = 0;           // Primer id nunca usado (protegido por clients_mutex)
+std::vector<int> free_stream_socks; // Ids liberados (protegido por clients_mutex)
+
+// Id para una conexión nueva de un gateway, -1 si ya no quedan
+int acquire_stream_sock()
+{
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  if (!free_stream_socks.empty())
+  {
+    int stream_sock = free_stream_socks.back();
+    free_stream_socks.pop_back();
+    return stream_sock;
+  }
+  return static_cast<size_t>(next_stream_sock) < socket_sessions.size() ? next_stream_sock++ : -1;
 }
 
+// Toma una sesión del pool para una conexión nueva del reactor
+Session &acquire_session(int client_sock, Reactor &reactor, const std::string &ip)
+{
+  std::shared_ptr<IpLimiter> limiter = ip_limiter(ip);
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  Session *session;
+  if (free_sessions.empty())
+  {
+    session = &session_pool.emplace_back();
+  }
+  else
+  {
+    session = free_sessions.back();
+    free_sessions.pop_back();
+  }
+  session->sock = client_sock;
+  session->reactor = &reactor;
+  session->heard_tick = reactor.heartbeat_tick;
+  session->accepted_tick = reactor.heartbeat_tick;
+  session->generation++;
+  session->user = NO_USER;
+  session->rate_limit.reset(std::chrono::steady_clock::now());
+  session->ip = ip;
+  session->ip_limiter = std::move(limiter);
+  socket_sessions[client_sock] = session;
+  return *session;
+}
 
-void send_direct_message(chat::Response &response_to_sender, chat::Response &response_to_recipient, chat::IncomingMessageResponse &message_response, int client_sock, int recipient_sock)
+// Devuelve la sesión al pool. Requiere clients_mutex y que la sesión ya no tenga canales.
+void release_session(Session &session)
 {
-  message_response.set_type(chat::MessageType::DIRECT);
-  response_to_recipient.set_message("Message incoming.");
-  response_to_recipient.set_status_code(chat::StatusCode::OK);
-  response_to_recipient.mutable_incoming_message()->CopyFrom(message_response);
-  send_response(recipient_sock, response_to_recipient);
+  socket_sessions[session.sock] = nullptr;
+  if (session.gateway != nullptr)
+  {
+    free_stream_socks.push_back(session.sock);
+  }
+  session.gateway = nullptr;
+  session.stream = 0;
+  session.stream_closed = false;
+  session.gateway_link = false;
+  session.streams_paused = false;
+  session.close_deferred = false;
+  session.streams.clear();
+  session.local = false;
+  int passed_fd = session.passed_fd.exchange(-1);
+  if (passed_fd >= 0)
+  {
+    close(passed_fd);
+  }
+  session.shm_opened = false;
+  session.shm_pending.reset();
+  session.shm.reset();
+  session.sock = -1;
+  session.reactor = nullptr;
+  session.generation++;
+  session.user = NO_USER;
+  session.ip_limiter.reset();
+  session.receive_buffer.clear();
+  session.outbox.clear();
+  session.write_buffer.clear();
+  session.write_buffer_sent = 0;
+  session.piece_sent = 0;
+  session.pending_output = 0;
+  session.dirty = false;
+  session.want_write = false;
+  session.broken = false;
+  session.reading = true;
+  session.awaiting_registration = false;
+  session.peer_node.clear();
+  session.detached = false;
+  session.inbox.clear();
+  session.batch.clear();
+  session.scheduled = false;
+  session.paused = false;
+  session.closing = false;
+  session.arena.Reset();
+  free_sessions.push_back(&session);
+}
 
-  response_to_sender.set_message("Message sent successfully.");
-  response_to_sender.set_status_code(chat::StatusCode::OK);
-  send_response(client_sock, response_to_sender);
+// Arena de la sesión atendida por el hilo; handle_request la reinicia después de cada solicitud
+google::protobuf::Arena &request_arena()
+{
+  return current_session->arena;
+}
+
+// Crea un mensaje en la arena de la solicitud en curso. Solo usar desde handle_request y sus handlers.
+template <typename T>
+T *new_message()
+{
+  return google::protobuf::Arena::CreateMessage<T>(&request_arena());
 }
 
+int local_listen_fd = -1; // Socket Unix de los clientes locales, lo vigilan todos los reactores
+std::string local_path;   // Ruta de local_listen_fd, se borra al apagarse
 
+void close_listeners()
+{
+  for (auto &reactor : reactors)
+  {
+    close(reactor->listen_fd);
+  }
+  if (local_listen_fd >= 0)
+  {
+    close(local_listen_fd);
+  }
+}
 
-void handle_client(int client_sock); // Predeclaración de handle_client
+void graceful_shutdown();
 
-int find_recipient_socket(const std::string &recipient)
+void terminationHandler()
 {
-  int recipient_sock = -1;
-  for (auto &session : client_sessions)
+  std::string input;
+  // Sin stdin (EOF) el servidor sigue corriendo; se detiene con una señal
+  while (std::getline(std::cin, input))
   {
-    if (session.second == recipient)
+    if (input == "exit")
     {
-      recipient_sock = session.first;
-      break;
+      graceful_shutdown();
+      return;
     }
   }
-  return recipient_sock;
 }
 
-
-chat::IncomingMessageResponse prepare_message_response(const chat::Request &request, int client_sock)
+// Sesión de un socket, nullptr si no hay. No requiere lock.
+Session *socket_session(int client_sock)
 {
-  auto message = request.send_message();
-  chat::IncomingMessageResponse message_response;
-  std::lock_guard<std::mutex> lock(clients_mutex); // Lock the clients mutex, for thread safety
-  message_response.set_sender(client_sessions[client_sock]);
-  message_response.set_content(message.content());
-  return message_response;
+  return client_sock >= 0 && static_cast<size_t>(client_sock) < socket_sessions.size() ? socket_sessions[client_sock].load() : nullptr;
 }
 
-void handle_send_message(const chat::Request &request, int client_sock, chat::Operation operation) {
-    std::cout << "Handling send message from client socket " << client_sock << std::endl;
-
-    chat::Response response_to_sender;
-    response_to_sender.set_operation(operation);
-
-    chat::Response response_to_recipient;
-    response_to_recipient.set_operation(chat::Operation::INCOMING_MESSAGE);
-    chat::IncomingMessageResponse message_response = prepare_message_response(request, client_sock);
+// Id del usuario registrado en el socket, NO_USER si no hay. Requiere clients_mutex.
+UserId session_user(int client_sock)
+{
+  Session *session = socket_session(client_sock);
+  return session ? session->user : NO_USER;
+}
 
-    if (request.send_message().recipient().empty()) {
-        std::cout << "Sending broadcast message from client socket " << client_sock << std::endl;
-        send_broadcast_message(message_response, client_sock);
-    } else {
-        std::cout << "Sending direct message to " << request.send_message().recipient() << " from client socket " << client_sock << std::endl;
-        int recipient_sock = find_recipient_socket(request.send_message().recipient());
-        if (recipient_sock != -1) {
-            send_direct_message(response_to_sender, response_to_recipient, message_response, client_sock, recipient_sock);
-        } else {
-            std::cerr << "Recipient not found for direct message from socket " << client_sock << std::endl;
-            response_to_sender.set_message("Recipient not found.");
-            response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
-            send_response(client_sock, response_to_sender);
-        }
-    }
+// Agrega la sesión a la lista del reactor que se escribe al final de la vuelta de epoll
+void mark_dirty(Session &session)
+{
+  if (!session.dirty)
+  {
+    session.dirty = true;
+    current_reactor->dirty.push_back(&session);
+  }
 }
 
+void request_close(Session &session);
 
-/**
- * Función para manejar el registro de un usuario
- */
-bool handle_registration(const chat::Request &request, int client_sock) {
-    auto user_request = request.register_user();
-    const auto &username = user_request.username();
+// Corta la conexión sin cerrarla: el reactor recibe EOF y la cierra por el camino normal de lectura
+void break_session(Session &session)
+{
+  session.broken = true;
+  session.outbox.clear();
+  session.write_buffer.clear();
+  session.write_buffer_sent = 0;
+  session.piece_sent = 0;
+  session.pending_output = 0;
+  // Sin socket no llega el EOF, y un socket que ya pasó al proceso nuevo no se corta: solo se cierra el descriptor propio
+  if (session.gateway != nullptr || output_frozen)
+  {
+    request_close(session);
+    return;
+  }
+  shutdown(session.sock, SHUT_RDWR);
+}
 
-    std::lock_guard<std::mutex> lock(clients_mutex);
+// Encola una parte en la salida de la sesión. Solo desde el reactor dueño.
+void push_output(Session &session, OutboundPiece piece)
+{
+  if (session.broken)
+  {
+    return;
+  }
+  session.pending_output += piece.size;
+  if (session.pending_output > (session.gateway_link ? MAX_GATEWAY_PENDING_OUTPUT : MAX_PENDING_OUTPUT))
+  {
+    std::cerr << "Client on socket " << session.sock << " is not reading, closing connection." << std::endl;
+    break_session(session);
+    return;
+  }
+  // Los frames propios seguidos se escriben como una sola parte de write_buffer
+  if (!piece.owner && !session.outbox.empty() && !session.outbox.back().owner)
+  {
+    session.outbox.back().size += piece.size;
+  }
+  else
+  {
+    session.outbox.push_back(std::move(piece));
+  }
+  mark_dirty(session);
+}
 
-    std::cout << "Attempting to register username: " << username << std::endl;
+// Encola un PING o un PONG; son 4 bytes fijos que van en write_buffer sin pasar por protobuf
+void push_control_frame(Session &session, const char *frame)
+{
+  if (session.broken)
+  {
+    return;
+  }
+  session.write_buffer.append(frame, FRAME_HEADER_SIZE);
+  push_output(session, {nullptr, nullptr, FRAME_HEADER_SIZE});
+}
 
-    // Log current user details
-    std::cout << "Current registered users:\n";
-    for (const auto& user : user_details) {
-        std::cout << "Username: " << user.first << ", IP: " << user.second << std::endl;
-    }
-    chat::Response response;
-    response.set_operation(chat::Operation::REGISTER_USER);
+// Encola en el enlace de un gateway un frame STREAM sin datos
+void push_stream_frame(Session &link, uint32_t stream, StreamKind kind)
+{
+  if (link.broken)
+  {
+    return;
+  }
+  append_stream_header(link.write_buffer, stream, kind, 0);
+  push_output(link, {nullptr, nullptr, FRAME_HEADER_SIZE + STREAM_HEADER_SIZE});
+}
 
-    struct sockaddr_in addr;
-    socklen_t addr_size = sizeof(struct sockaddr_in);
-    int res = getpeername(client_sock, (struct sockaddr *)&addr, &addr_size);
-    std::string ip_str;
-    if (res != -1) {
-        ip_str = inet_ntoa(addr.sin_addr);
-        std::cout << "IP Address Retrieved: " << ip_str << std::endl;
-    } else {
-        response.set_message("Unable to retrieve IP address.");
-        response.set_status_code(chat::StatusCode::BAD_REQUEST);
-        send_response(client_sock, response);
-        return false;
-    }
+// Encola un mensaje entrante con el codec de la conexión, compartiendo sus bytes con los demás destinatarios
+void push_incoming_message(Session &session, const std::shared_ptr<const IncomingMessageFrame> &message)
+{
+  struct iovec parts[3];
+  std::shared_ptr<const std::string> compressed;
+  int count = incoming_message_parts(*message, socket_codec(session.sock), parts, compressed);
+  std::shared_ptr<const void> owner = compressed ? std::shared_ptr<const void>(compressed) : std::shared_ptr<const void>(message);
+  for (int i = 0; i < count; i++)
+  {
+    push_output(session, {owner, static_cast<const char *>(parts[i].iov_base), parts[i].iov_len});
+  }
+}
 
-    if (user_details.find(username) != user_details.end()) {
-        std::cout << "Username already taken." << std::endl;
-        response.set_message("Username is already taken.");
-        response.set_status_code(chat::StatusCode::BAD_REQUEST);
-        send_response(client_sock, response);
-        return false;
+// Deja el frame en el buzón del reactor dueño; el eventfd solo se escribe si no había un aviso pendiente
+void post_delivery(Reactor *reactor, Delivery delivery)
+{
+  reactor->deliveries.push(std::move(delivery));
+  if (!reactor->wake_pending.exchange(true))
+  {
+    uint64_t one = 1;
+    if (write(reactor->wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+    {
+      perror("wake failed");
     }
+  }
+}
 
-    user_details[username] = ip_str;
-    client_sessions[client_sock] = username;
-
-    std::cout << "User registered successfully: " << username << std::endl;
+// Aviso de la cadena de la sesión, de su reactor o de quien tiene clients_mutex: mientras tanto la sesión
+// no se puede liberar, así que su generación es la de la conexión a la que va dirigido
+void post_control(Session &session, SessionControl control)
+{
+  post_delivery(session.reactor, {&session, session.generation, nullptr, nullptr, control});
+}
 
-    response.set_message("User registered successfully.");
-    response.set_status_code(chat::StatusCode::OK);
-    send_response(client_sock, response);
-    return true;
+// Las sesiones de otras conexiones se buscan con clients_mutex tomado: así no se leen a medio liberar y
+// un frame encolado después no llega a la conexión nueva que reutilice la sesión. El destino se puede
+// guardar y usar sin el lock: si la conexión se cerró mientras tanto, su generación ya no coincide.
+SessionTarget session_target(int client_sock)
+{
+  Session *session = socket_session(client_sock);
+  if (session == nullptr)
+  {
+    return {};
+  }
+  return {session, session->reactor.load(), session->generation.load(), client_sock};
 }
 
-void add_user_to_response(const std::pair<std::string, std::string> &user, chat::UserListResponse &response)
+// El reactor dueño escribe directo solo si la sesión sigue siendo la conexión que se buscó
+bool owned_by_current_reactor(const SessionTarget &target)
 {
-  chat::User *user_proto = response.add_users();
-  // Username concatenated string: <username> (<ip>)
-  user_proto->set_username(user.first + " (" + user.second + ")");
-  user_proto->set_status(user_status[user.first]);
+  return target.reactor == current_reactor && target.session->generation == target.generation;
 }
 
 /**
- * GET_USERS 
+ * Envía un mensaje a una conexión. Solo el reactor dueño escribe en el socket: desde su hilo el frame
+ * se serializa directo en write_buffer; desde otro hilo se serializa aparte y se encola en su buzón.
  */
-void handle_get_users(const chat::Request &request, int client_sock, chat::Operation operation)
+bool send_to(const SessionTarget &target, const google::protobuf::Message &message)
 {
-  std::lock_guard<std::mutex> lock(clients_mutex);
-
-  chat::Response response;
-  response.set_operation(operation);
-
-  chat::UserListResponse user_list_response;
-
-  if (request.get_users().username().empty())
+  Session *session = target.session;
+  Reactor *reactor = target.reactor;
+  if (reactor == nullptr)
   {
-    // Return all connected users
-    user_list_response.set_type(chat::UserListType::ALL);
-    for (const auto &user : user_details)
-    {
-      add_user_to_response(user, user_list_response);
-    }
-    std::cout << "All users returned successfully." << std::endl;
-    response.set_message("All users returned successfully.");
-    response.set_status_code(chat::StatusCode::OK);
+    return false;
   }
-  else
+  if (reactor == current_reactor)
   {
-    user_list_response.set_type(chat::UserListType::SINGLE);
-    // Return only the specified user
-    auto it = user_details.find(request.get_users().username());
-    if (it != user_details.end())
+    if (!owned_by_current_reactor(target))
     {
-      add_user_to_response(*it, user_list_response);
-      std::cout << "User returned successfully: " << it->first << std::endl;
-      response.set_message("User returned successfully.");
-      response.set_status_code(chat::StatusCode::OK);
+      return false;
     }
-    else
+    size_t before = session->write_buffer.size();
+    if (session->broken || !append_frame(message, socket_codec(target.sock), session->write_buffer))
     {
-      std::cout << "User not found: " << request.get_users().username() << std::endl;
-      response.set_message("User not found.");
-      response.set_status_code(chat::StatusCode::BAD_REQUEST);
+      return false;
     }
+    push_output(*session, {nullptr, nullptr, session->write_buffer.size() - before});
+    return true;
   }
-
-  // Copy the user list to the response
-  response.mutable_user_list()->CopyFrom(user_list_response);
-  // Send the complete response
-  send_response(client_sock, response);
+  auto frame = std::make_shared<std::string>();
+  if (!append_frame(message, socket_codec(target.sock), *frame))
+  {
+    return false;
+  }
+  post_delivery(reactor, {session, target.generation, std::move(frame), nullptr});
+  return true;
 }
 
-void unregister_user(int client_sock, bool forced = false)
+bool send_to(int client_sock, const google::protobuf::Message &message)
 {
-  std::lock_guard<std::mutex> lock(clients_mutex);
-  chat::Response response;
-
-  if (client_sessions.find(client_sock) != client_sessions.end())
-  {
-    std::string username = client_sessions[client_sock];
-
-    // Erase user data from maps
-    client_sessions.erase(client_sock);
-
-    user_details.erase(username);
-
-    user_status.erase(username);
-
-    last_active.erase(username);
+  return send_to(session_target(client_sock), message);
+}
 
-    // Prepare a response message
-    response.set_operation(chat::Operation::UNREGISTER_USER);
-    response.set_message("User unregistered successfully.");
-    response.set_status_code(chat::StatusCode::OK);
-  }
-  else
+// Envía un frame ya serializado, compartido entre destinatarios
+bool send_frame_to(const SessionTarget &target, const std::shared_ptr<const std::string> &frame)
+{
+  if (target.reactor == nullptr)
   {
-    // User not found or already unregistered, send error response
-    response.set_message("User not found or already unregistered.");
-    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    return false;
   }
-
-  if (!forced)
+  if (target.reactor == current_reactor)
   {
-    send_response(client_sock, response);
+    if (!owned_by_current_reactor(target))
+    {
+      return false;
+    }
+    push_output(*target.session, {frame, frame->data(), frame->size()});
+    return true;
   }
+  post_delivery(target.reactor, {target.session, target.generation, frame, nullptr});
+  return true;
 }
 
+bool send_frame_to(int client_sock, const std::shared_ptr<const std::string> &frame)
+{
+  return send_frame_to(session_target(client_sock), frame);
+}
+
+// Entrega un mensaje entrante a una conexión, por el mismo camino que send_to
+bool deliver_incoming_message(const SessionTarget &target, const std::shared_ptr<const IncomingMessageFrame> &frame)
+{
+  if (target.reactor == nullptr)
+  {
+    return false;
+  }
+  if (target.reactor == current_reactor)
+  {
+    if (!owned_by_current_reactor(target))
+    {
+      return false;
+    }
+    push_incoming_message(*target.session, frame);
+    return true;
+  }
+  post_delivery(target.reactor, {target.session, target.generation, nullptr, frame});
+  return true;
+}
+
+bool deliver_incoming_message(int recipient_sock, const std::shared_ptr<const IncomingMessageFrame> &frame)
+{
+  return deliver_incoming_message(session_target(recipient_sock), frame);
+}
+
+// Id de un usuario por nombre, NO_USER si no existe. Requiere clients_mutex.
+UserId find_user(std::string_view username)
+{
+  auto it = user_ids.find(username);
+  return it == user_ids.end() ? NO_USER : it->second;
+}
+
+// Cambia el estado de un usuario manteniendo el índice por estado. Requiere clients_mutex.
+void set_user_status(UserId id, chat::UserStatus status)
+{
+  std::string_view name = users.names[id];
+  users_by_status[users.statuses[id]].erase(name);
+  users.statuses[id] = status;
+  users_by_status[status].insert(name);
+}
+
+// Encola el cambio de un usuario de este nodo, con su versión, para todos los nodos pares. Requiere clients_mutex.
+void federate_presence(const std::string &username, chat::UserStatus status, bool removed)
+{
+  for (auto &link : peer_links)
+  {
+    std::lock_guard<std::mutex> lock(link->mutex);
+    chat::PresenceEntry *entry = link->pending.add_presence();
+    entry->set_username(username);
+    entry->set_node(node_name);
+    entry->set_status(status);
+    entry->set_version(registry_version);
+    entry->set_removed(removed);
+  }
+}
+
+void unindex_remote_user(const std::string &username)
+{
+  auto it = remote_users.find(username);
+  if (it == remote_users.end())
+  {
+    return;
+  }
+  for (auto &index : remote_by_status)
+  {
+    index.erase(it->first);
+  }
+  remote_users.erase(it);
+  remote_users_version++;
+}
+
+void index_remote_user(const std::string &username, const std::string &node, chat::UserStatus status)
+{
+  unindex_remote_user(username);
+  auto it = remote_users.emplace(username, node).first;
+  remote_by_status[status].insert(it->first);
+  remote_users_version++;
+}
+
+// Un usuario que se muda puede estar vivo en dos tablas por un momento; al dejar una queda visible la otra
+void reindex_remote_user(const std::string &username)
+{
+  for (const auto &table : node_presence)
+  {
+    auto it = table.second.find(username);
+    if (table.first != node_name && it != table.second.end() && !it->second.removed)
+    {
+      index_remote_user(username, table.first, it->second.status);
+      return;
+    }
+  }
+}
+
+// Guarda el cambio de un usuario en la tabla de su nodo y actualiza remote_users. Requiere clients_mutex.
+void store_presence(const std::string &node, const std::string &username, chat::UserStatus status, uint64_t version, bool removed)
+{
+  PresenceRecord &record = node_presence[node][username];
+  record.status = status;
+  record.version = version;
+  record.removed = removed;
+  record.removed_at = removed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+  if (node == node_name)
+  {
+    return;
+  }
+  if (!removed)
+  {
+    index_remote_user(username, node, status);
+    return;
+  }
+  auto it = remote_users.find(username);
+  if (it != remote_users.end() && it->second == node)
+  {
+    unindex_remote_user(username);
+    reindex_remote_user(username);
+  }
+}
+
+// Olvida todo lo que se sabe de un nodo: sus usuarios dejan de ser alcanzables. Requiere clients_mutex.
+void forget_node_presence(const std::string &node)
+{
+  node_clocks.erase(node);
+  auto table = node_presence.find(node);
+  if (table == node_presence.end())
+  {
+    return;
+  }
+  std::map<std::string, PresenceRecord> records = std::move(table->second);
+  node_presence.erase(table);
+  for (const auto &record : records)
+  {
+    auto it = remote_users.find(record.first);
+    if (it != remote_users.end() && it->second == node)
+    {
+      unindex_remote_user(record.first);
+      reindex_remote_user(record.first);
+    }
+  }
+}
+
+/**
+ * Aplica una entrada recibida de un par si es más nueva que la que se tiene. Solo se aceptan nodos con
+ * enlace activo: lo que llegue por otro camino de un nodo caído revivía usuarios que ya no están.
+ * Requiere clients_mutex.
+ */
+void apply_presence_entry(const chat::PresenceEntry &entry)
+{
+  // Un estado fuera del enum indexaría remote_by_status fuera de rango
+  if (entry.node() == node_name || peer_sockets.count(entry.node()) == 0 || !chat::UserStatus_IsValid(entry.status()))
+  {
+    return;
+  }
+  auto &table = node_presence[entry.node()];
+  auto it = table.find(entry.username());
+  if (it != table.end() && it->second.version >= entry.version())
+  {
+    return;
+  }
+  store_presence(entry.node(), entry.username(), entry.status(), entry.version(), entry.removed());
+}
+
+/**
+ * Aplica una parte de la respuesta a un digest. Con replace se descarta lo que se sabía del nodo; las
+ * partes de una respuesta que no empezó con la encarnación conocida se ignoran. Requiere clients_mutex.
+ */
+void apply_gossip(const chat::GossipUpdate &update)
+{
+  const chat::NodeVersion &version = update.node();
+  if (version.node() == node_name || peer_sockets.count(version.node()) == 0)
+  {
+    return;
+  }
+  if (version.replace())
+  {
+    forget_node_presence(version.node());
+    node_clocks[version.node()].incarnation = version.incarnation();
+  }
+  auto clock = node_clocks.find(version.node());
+  if (clock == node_clocks.end() || clock->second.incarnation != version.incarnation())
+  {
+    return;
+  }
+  for (const auto &entry : update.entries())
+  {
+    apply_presence_entry(entry);
+  }
+  clock->second.version = std::max(clock->second.version, version.version());
+}
+
+// Borra las lápidas vencidas; el reloj de cada nodo recuerda hasta qué versión se compactó. Requiere clients_mutex.
+void compact_presence()
+{
+  auto now = std::chrono::steady_clock::now();
+  for (auto &table : node_presence)
+  {
+    uint64_t compacted = 0;
+    for (auto it = table.second.begin(); it != table.second.end();)
+    {
+      bool expired = it->second.removed && now - it->second.removed_at > std::chrono::milliseconds(GOSSIP_TOMBSTONE_TTL_MS);
+      compacted = expired ? std::max(compacted, it->second.version) : compacted;
+      it = expired ? table.second.erase(it) : std::next(it);
+    }
+    auto clock = node_clocks.find(table.first);
+    if (clock != node_clocks.end())
+    {
+      clock->second.compacted = std::max(clock->second.compacted, compacted);
+    }
+  }
+}
+
+/**
+ * Encola el mensaje para el nodo dueño del destinatario o, si node está vacío, para todos los nodos
+ * (broadcast). Devuelve false si no quedó encolado para ningún nodo.
+ */
+bool forward_message(const std::string &node, const ChatMessage &message, const std::string &recipient)
+{
+  size_t size = message.content->size() + message.sender.size() + recipient.size();
+  if (size + 256 > BUFFER_SIZE)
+  {
+    std::cerr << "Message from " << message.sender << " is too large to forward." << std::endl;
+    return false;
+  }
+  bool queued = false;
+  for (auto &link : peer_links)
+  {
+    std::lock_guard<std::mutex> lock(link->mutex);
+    if (!node.empty() && link->node != node)
+    {
+      continue;
+    }
+    if (link->pending_bytes + size > MAX_PEER_PENDING)
+    {
+      std::cerr << "Peer " << link->address << " is not keeping up, dropping forwarded message." << std::endl;
+      continue;
+    }
+    chat::ForwardedMessage *forwarded = link->pending.add_messages();
+    forwarded->set_recipient(recipient);
+    forwarded->set_sender(message.sender);
+    forwarded->set_content(*message.content);
+    link->pending_bytes += size;
+    queued = true;
+  }
+  return queued;
+}
+
+// Dirección con la que este nodo llega al nodo par, vacía si no es un par
+std::string node_address(const std::string &node)
+{
+  for (auto &link : peer_links)
+  {
+    std::lock_guard<std::mutex> lock(link->mutex);
+    if (link->node == node)
+    {
+      return link->address;
+    }
+  }
+  return "";
+}
+
+// Interna el nombre y crea el estado del usuario en un id libre. Requiere clients_mutex.
+UserId add_user(const std::string &username, const std::string &ip, int client_sock, bool ack_mode)
+{
+  UserId id;
+  if (!users.free_ids.empty())
+  {
+    id = users.free_ids.back();
+    users.free_ids.pop_back();
+  }
+  else
+  {
+    id = static_cast<UserId>(users.names.size());
+    users.names.emplace_back();
+    users.ips.emplace_back();
+    users.sockets.push_back(-1);
+    users.statuses.push_back(chat::UserStatus::ONLINE);
+    users.last_active.emplace_back();
+    users.in_use.push_back(0);
+    users.ack_mode.push_back(0);
+  }
+  users.names[id] = username;
+  users.ips[id] = ip;
+  users.sockets[id] = client_sock;
+  users.statuses[id] = chat::UserStatus::ONLINE;
+  users.last_active[id] = std::chrono::steady_clock::now();
+  users.in_use[id] = 1;
+  users.ack_mode[id] = ack_mode;
+
+  std::string_view name = users.names[id];
+  user_ids[name] = id;
+  users_by_name[name] = id;
+  users_by_status[chat::UserStatus::ONLINE].insert(name);
+  socket_session(client_sock)->user = id;
+  return id;
+}
+
+// Olvida el estado de modo ack del emisor: un usuario nuevo con el mismo nombre empieza sin recibos. Requiere clients_mutex.
+void forget_sender_deliveries(const std::string &sender)
+{
+  std::lock_guard<std::mutex> lock(delivery_mutex);
+  outstanding_by_sender.erase(sender);
+  last_id_by_sender.erase(sender);
+  receipt_sent_through.erase(sender);
+  receipt_dirty.erase(sender);
+}
+
+// Quita al usuario de los índices y libera su id. Requiere clients_mutex.
+void remove_user(UserId id)
+{
+  std::string_view name = users.names[id];
+  forget_sender_deliveries(users.names[id]);
+  user_ids.erase(name);
+  users_by_name.erase(name);
+  users_by_status[users.statuses[id]].erase(name);
+  socket_session(users.sockets[id])->user = NO_USER;
+  users.in_use[id] = 0;
+  users.sockets[id] = -1;
+  users.names[id].clear();
+  users.ips[id].clear();
+  users.free_ids.push_back(id);
+}
+
+/**
+ * Registra un cambio en el registro de usuarios y lo envía a los suscriptores de presencia.
+ * Debe llamarse con clients_mutex tomado para que las versiones lleguen en orden.
+ */
+void publish_presence(chat::PresenceEvent event, const std::string &username, chat::UserStatus status)
+{
+  registry_version++;
+  // La versión del registro es también la de este nodo en la réplica del clúster
+  bool removed = event == chat::PresenceEvent::USER_LEFT;
+  store_presence(node_name, username, status, registry_version, removed);
+  node_clocks[node_name].version = registry_version;
+  federate_presence(username, status, removed);
+  if (presence_subscribers.empty())
+  {
+    return;
+  }
+
+  chat::Response response;
+  response.set_operation(chat::Operation::PRESENCE_UPDATE);
+  response.set_status_code(chat::StatusCode::OK);
+  auto *update = response.mutable_presence();
+  update->set_version(registry_version);
+  auto *delta = update->add_deltas();
+  delta->set_event(event);
+  delta->set_version(registry_version);
+  delta->mutable_user()->set_username(username);
+  delta->mutable_user()->set_status(status);
+
+  for (int subscriber : presence_subscribers)
+  {
+    send_to(subscriber, response);
+  }
+}
+
+/**
+ * SUBSCRIBE_PRESENCE: envía una foto del registro y luego solo los cambios
+ */
+void handle_presence_subscription(const chat::Request &request, int client_sock, chat::Operation operation)
+{
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(operation);
+
+  if (session_user(client_sock) == NO_USER)
+  {
+    response.set_message("User is not registered.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response);
+    return;
+  }
+
+  if (request.subscribe_presence().unsubscribe())
+  {
+    presence_subscribers.erase(client_sock);
+    response.set_message("Unsubscribed from presence updates.");
+    response.set_status_code(chat::StatusCode::OK);
+    send_to(client_sock, response);
+    return;
+  }
+
+  // La foto se manda con el mutex tomado, así ningún delta se puede adelantar. Va en partes que entren
+  // en un frame; solo la primera reemplaza la réplica y todas llevan la versión del registro.
+  chat::Response &part = *new_message<chat::Response>();
+  part.set_operation(chat::Operation::PRESENCE_UPDATE);
+  part.set_status_code(chat::StatusCode::OK);
+  auto *update = part.mutable_presence();
+  update->set_version(registry_version);
+  update->set_snapshot(true);
+  bool sent = true;
+  size_t size = 0;
+  for (const auto &user : users_by_name)
+  {
+    if (size + user.first.size() + 16 > BUFFER_SIZE / 2)
+    {
+      sent = sent && send_to(client_sock, part);
+      update->clear_deltas();
+      update->set_snapshot(false);
+      size = 0;
+    }
+    auto *delta = update->add_deltas();
+    delta->set_event(chat::PresenceEvent::USER_JOINED);
+    delta->set_version(registry_version);
+    delta->mutable_user()->set_username(user.first.data(), user.first.size());
+    delta->mutable_user()->set_status(users.statuses[user.second]);
+    size += user.first.size() + 16;
+  }
+  sent = sent && send_to(client_sock, part);
+
+  // Sin la foto completa el cliente no puede responder con su réplica: no queda suscrito
+  if (!sent)
+  {
+    response.set_message("Unable to send the presence snapshot.");
+    response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
+    send_to(client_sock, response);
+    return;
+  }
+  presence_subscribers.insert(client_sock);
+  response.set_message("Subscribed to presence updates.");
+  response.set_status_code(chat::StatusCode::OK);
+  send_to(client_sock, response);
+}
+
+void update_user_status_and_time(int client_sock, chat::UserStatus new_status)
+{
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  UserId id = session_user(client_sock);
+  if (id == NO_USER)
+  {
+    return;
+  }
+  if (users.statuses[id] != new_status)
+  {
+    set_user_status(id, new_status);
+    publish_presence(chat::PresenceEvent::STATUS_CHANGED, users.names[id], new_status);
+  }
+}
+
+/**
+ * UPDATE_STATUS main function
+ */
+void update_status(const UpdateStatusView &status_request, int client_sock, chat::Operation operation)
+{
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(operation);
+  // El estado indexa users_by_status: uno fuera del enum se rechaza antes de tocar el registro
+  if (!chat::UserStatus_IsValid(status_request.new_status))
+  {
+    response.set_message("Invalid status.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response);
+    return;
+  }
+  update_user_status_and_time(client_sock, status_request.new_status);
+  response.set_message("Status updated successfully."); 
+  response.set_status_code(chat::StatusCode::OK);
+  send_to(client_sock, response);
+}
+
+
+int shutdown_fd = -1; // eventfd que el manejador de señales usa para despertar a shutdown_watcher
+std::atomic<bool> shutdown_requested{false};
+
+// Solo hace operaciones seguras dentro de un manejador; una segunda señal termina sin drenar
+void signalHandler(int signum)
+{
+  if (shutdown_requested.exchange(true))
+  {
+    _exit(signum);
+  }
+  uint64_t one = 1;
+  if (write(shutdown_fd, &one, sizeof(one)) < 0)
+  {
+    _exit(signum);
+  }
+}
+
+void shutdown_watcher()
+{
+  uint64_t signals;
+  while (read(shutdown_fd, &signals, sizeof(signals)) < 0 && errno == EINTR)
+  {
+  }
+  std::cout << "\nInterrupt signal received." << std::endl;
+  graceful_shutdown();
+}
+void send_message_to_client(int client_sock, const chat::IncomingMessageResponse& message_response, chat::MessageType type) {
+    chat::Response response;
+    response.set_operation(chat::INCOMING_MESSAGE);
+    response.set_status_code(chat::StatusCode::OK);
+    auto* incoming_message = response.mutable_incoming_message();
+    incoming_message->CopyFrom(message_response);
+    incoming_message->set_type(type);
+    std::string response_str;
+    response.SerializeToString(&response_str);
+    send(client_sock, response_str.c_str(), response_str.size(), 0);
+}
+
+
+// Función para actualizar la inactividad de los usuarios
+void update_inactivity() {
+    while (true)
+    {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        forget_idle_ip_limiters();
+
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        compact_presence();
+        auto now = std::chrono::steady_clock::now();
+
+        // Recorre los arreglos contiguos de actividad y estado, sin buscar por nombre
+        for (UserId id = 0; id < users.last_active.size(); id++)
+        {
+            if (!users.in_use[id])
+            {
+                continue;
+            }
+            const std::string &username = users.names[id];
+            auto last_activity = users.last_active[id];
+
+            // Asegúrate de que el intervalo calculado sea con el mismo tipo de reloj
+            if (std::chrono::duration_cast<std::chrono::seconds>(now - last_activity).count() > AUTO_OFFLINE_SECONDS)
+            {
+                if (users.statuses[id] != chat::UserStatus::OFFLINE)
+                {
+                    // chat::Response response;
+                    // response.set_operation(chat::Operation::UPDATE_STATUS);
+                    // response.set_message("User has been set to OFFLINE due to inactivity."); 
+                    // response.set_status_code(chat::StatusCode::OK);
+                    set_user_status(id, chat::UserStatus::OFFLINE);
+                    publish_presence(chat::PresenceEvent::STATUS_CHANGED, username, chat::UserStatus::OFFLINE);
+                    std::cout << "User " << username << " has been set to OFFLINE due to inactivity." << std::endl;
+                }
+            }
+        }
+    }
+}
+
+
+void send_broadcast_message(const ChatMessage &message, int client_sock) {
+    // El frame es igual para todos los destinatarios: se codifica una vez y el contenido no se copia
+    auto frame = std::make_shared<IncomingMessageFrame>();
+    bool encoded = encode_incoming_message(message, "Broadcast message incoming.", *frame);
+
+    std::lock_guard<std::mutex> lock(clients_mutex);
+
+    std::cout << "Broadcasting message from client socket " << client_sock << std::endl;
+
+    for (UserId id = 0; id < users.sockets.size(); id++) {
+        if (encoded && users.in_use[id] && users.sockets[id] != client_sock) { 
+            deliver_incoming_message(users.sockets[id], frame);
+        }
+    }
+    if (encoded) {
+        forward_message("", message, "");
+    }
+
+    chat::Response &response_to_sender = *new_message<chat::Response>();
+    response_to_sender.set_message(encoded ? "Broadcast message sent successfully." : "Message is too large.");
+    response_to_sender.set_status_code(encoded ? chat::StatusCode::OK : chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response_to_sender);
+}
+
+
+int find_recipient_socket(std::string_view recipient); // Predeclaración de find_recipient_socket
+
+/**
+ * Registra un mensaje directo pendiente de ack y devuelve el id asignado (0 si no aplica).
+ * Los ids se asignan si el emisor o el receptor usan modo ack.
+ */
+uint64_t track_direct_message(const std::string &recipient, ChatMessage &message)
+{
+  bool sender_acks, recipient_acks;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId sender_id = find_user(message.sender);
+    UserId recipient_id = find_user(recipient);
+    sender_acks = sender_id != NO_USER && users.ack_mode[sender_id];
+    recipient_acks = recipient_id != NO_USER && users.ack_mode[recipient_id];
+  }
+  if (!sender_acks && !recipient_acks)
+  {
+    return 0;
+  }
+
+  uint64_t message_id = next_message_id++;
+  std::lock_guard<std::mutex> lock(delivery_mutex);
+  if (recipient_acks)
+  {
+    message.message_id = message_id;
+    pending_deliveries[message_id] = {recipient, message.sender, message, std::chrono::steady_clock::now(), 1};
+    if (sender_acks)
+    {
+      outstanding_by_sender[message.sender].insert(message_id);
+    }
+  }
+  if (sender_acks)
+  {
+    last_id_by_sender[message.sender] = message_id;
+    if (!recipient_acks)
+    {
+      // Sin ack del receptor el mensaje cuenta como entregado al enviarse
+      receipt_dirty.insert(message.sender);
+    }
+  }
+  return message_id;
+}
+
+void send_direct_message(chat::Response &response_to_sender, ChatMessage &message, int client_sock, const SessionTarget &recipient_target, const std::string &recipient)
+{
+  message.type = chat::MessageType::DIRECT;
+  auto frame = std::make_shared<IncomingMessageFrame>();
+  if (!encode_incoming_message(message, "Message incoming.", *frame))
+  {
+    response_to_sender.set_message("Message is too large.");
+    response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response_to_sender);
+    return;
+  }
+  uint64_t message_id = track_direct_message(recipient, message);
+  if (message.message_id != 0)
+  {
+    encode_incoming_message(message, "Message incoming.", *frame);
+  }
+  bool sent = deliver_incoming_message(recipient_target, frame);
+
+  response_to_sender.set_message_id(message_id);
+  if (message.message_id != 0)
+  {
+    // En modo ack un fallo de envío se reintenta, el emisor espera el recibo
+    response_to_sender.set_message("Message queued for delivery.");
+    response_to_sender.set_status_code(chat::StatusCode::OK);
+  }
+  else if (sent)
+  {
+    response_to_sender.set_message("Message sent successfully.");
+    response_to_sender.set_status_code(chat::StatusCode::OK);
+  }
+  else
+  {
+    response_to_sender.set_message("Message could not be delivered.");
+    response_to_sender.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
+  }
+  send_to(client_sock, response_to_sender);
+}
+
+/**
+ * ACK_MESSAGES: el receptor confirma un lote de mensajes directos
+ */
+void handle_ack(const chat::Request &request, int client_sock)
+{
+  std::string username;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId id = session_user(client_sock);
+    if (id == NO_USER)
+    {
+      return;
+    }
+    username = users.names[id];
+  }
+
+  std::lock_guard<std::mutex> lock(delivery_mutex);
+  for (uint64_t message_id : request.ack().message_ids())
+  {
+    auto it = pending_deliveries.find(message_id);
+    if (it == pending_deliveries.end() || it->second.recipient != username)
+    {
+      continue; // Ack duplicado o de otro usuario
+    }
+    auto outstanding = outstanding_by_sender.find(it->second.sender);
+    if (outstanding != outstanding_by_sender.end())
+    {
+      outstanding->second.erase(message_id);
+      receipt_dirty.insert(it->second.sender);
+    }
+    pending_deliveries.erase(it);
+  }
+}
+
+/**
+ * Hilo de entregas en modo ack: agrupa los recibos acumulativos por emisor
+ * y reenvía los mensajes directos que no han sido confirmados a tiempo.
+ */
+void process_deliveries()
+{
+  while (running)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ACK_FLUSH_INTERVAL_MS));
+
+    std::vector<std::pair<std::string, uint64_t>> receipts;
+    std::vector<PendingDelivery> retries;
+    std::vector<std::pair<std::string, uint64_t>> failures;
+    {
+      std::lock_guard<std::mutex> lock(delivery_mutex);
+      for (const auto &sender : receipt_dirty)
+      {
+        auto outstanding = outstanding_by_sender.find(sender);
+        uint64_t through = (outstanding == outstanding_by_sender.end() || outstanding->second.empty())
+                               ? last_id_by_sender[sender]
+                               : *outstanding->second.begin() - 1;
+        if (through > receipt_sent_through[sender])
+        {
+          receipt_sent_through[sender] = through;
+          receipts.emplace_back(sender, through);
+        }
+      }
+      receipt_dirty.clear();
+
+      auto now = std::chrono::steady_clock::now();
+      for (auto it = pending_deliveries.begin(); it != pending_deliveries.end();)
+      {
+        PendingDelivery &pending = it->second;
+        if (now - pending.last_sent < std::chrono::milliseconds(ACK_RETRY_TIMEOUT_MS))
+        {
+          ++it;
+          continue;
+        }
+        if (pending.attempts >= ACK_MAX_ATTEMPTS)
+        {
+          // El emisor recibe un aviso para no contar el mensaje dentro del recibo acumulativo
+          auto outstanding = outstanding_by_sender.find(pending.sender);
+          if (outstanding != outstanding_by_sender.end() && outstanding->second.erase(it->first))
+          {
+            failures.emplace_back(pending.sender, it->first);
+            receipt_dirty.insert(pending.sender);
+          }
+          std::cout << "Dropping message " << it->first << " for " << pending.recipient << " after " << pending.attempts << " attempts." << std::endl;
+          it = pending_deliveries.erase(it);
+          continue;
+        }
+        pending.attempts++;
+        pending.last_sent = now;
+        retries.push_back(pending);
+        ++it;
+      }
+    }
+
+    for (const auto &retry : retries)
+    {
+      auto frame = std::make_shared<IncomingMessageFrame>();
+      if (!encode_incoming_message(retry.message, "Message incoming.", *frame))
+      {
+        continue;
+      }
+      // Si el receptor está desconectado se reintenta en el siguiente ciclo
+      std::lock_guard<std::mutex> lock(clients_mutex);
+      int recipient_sock = find_recipient_socket(retry.recipient);
+      if (recipient_sock != -1)
+      {
+        deliver_incoming_message(recipient_sock, frame);
+      }
+    }
+
+    for (const auto &failure : failures)
+    {
+      chat::Response response;
+      response.set_operation(chat::Operation::SEND_MESSAGE);
+      response.set_message("Message could not be delivered.");
+      response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
+      response.set_message_id(failure.second);
+      std::lock_guard<std::mutex> lock(clients_mutex);
+      int sender_sock = find_recipient_socket(failure.first);
+      if (sender_sock != -1)
+      {
+        send_to(sender_sock, response);
+      }
+    }
+
+    for (const auto &receipt : receipts)
+    {
+      chat::Response response;
+      response.set_operation(chat::Operation::DELIVERY_RECEIPT);
+      response.set_status_code(chat::StatusCode::OK);
+      response.mutable_delivery_receipt()->set_delivered_through(receipt.second);
+      std::lock_guard<std::mutex> lock(clients_mutex);
+      int sender_sock = find_recipient_socket(receipt.first);
+      if (sender_sock != -1)
+      {
+        send_to(sender_sock, response);
+      }
+    }
+  }
+}
+
+
+
+// Socket del usuario por nombre, -1 si no está conectado. Requiere clients_mutex.
+int find_recipient_socket(std::string_view recipient)
+{
+  UserId id = find_user(recipient);
+  return id == NO_USER ? -1 : users.sockets[id];
+}
+
+
+/**
+ * Arma el mensaje a reenviar. El contenido se mueve fuera de la solicitud a un buffer
+ * compartido, así todos los destinatarios usan los mismos bytes.
+ */
+void prepare_chat_message(std::string_view content, int client_sock, ChatMessage &message)
+{
+  message.content = std::make_shared<const std::string>(content);
+  std::lock_guard<std::mutex> lock(clients_mutex); // Lock the clients mutex, for thread safety
+  UserId id = session_user(client_sock);
+  if (id != NO_USER)
+  {
+    message.sender = users.names[id];
+  }
+}
+
+bool add_channel_member(Channel &channel, int client_sock)
+{
+  auto it = std::lower_bound(channel.members.begin(), channel.members.end(), client_sock);
+  if (it != channel.members.end() && *it == client_sock)
+  {
+    return false;
+  }
+  channel.members.insert(it, client_sock);
+  return true;
+}
+
+bool remove_channel_member(Channel &channel, int client_sock)
+{
+  auto it = std::lower_bound(channel.members.begin(), channel.members.end(), client_sock);
+  if (it == channel.members.end() || *it != client_sock)
+  {
+    return false;
+  }
+  channel.members.erase(it);
+  return true;
+}
+
+// Elimina el canal del índice de la sesión y borra el canal si quedó vacío. Requiere channels_mutex.
+void forget_channel_membership(Session &session, const std::string &name)
+{
+  auto &joined = session.channels;
+  joined.erase(std::remove(joined.begin(), joined.end(), name), joined.end());
+  auto channel = channels.find(name);
+  if (channel != channels.end() && channel->second.members.empty())
+  {
+    channels.erase(channel);
+    std::cout << "Channel " << name << " removed, no members left." << std::endl;
+  }
+}
+
+/**
+ * CREATE_CHANNEL, JOIN_CHANNEL y LEAVE_CHANNEL
+ */
+void handle_channel_request(const chat::Request &request, Session &session, chat::Operation operation)
+{
+  int client_sock = session.sock;
+  const std::string &name = request.channel().channel();
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(operation);
+
+  bool registered;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    registered = session_user(client_sock) != NO_USER;
+  }
+
+  if (!registered || name.empty())
+  {
+    response.set_message(registered ? "Channel name is required." : "User is not registered.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(channels_mutex);
+    auto channel = channels.find(name);
+    if (operation == chat::Operation::CREATE_CHANNEL)
+    {
+      if (channel != channels.end())
+      {
+        response.set_message("Channel already exists.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+      }
+      else
+      {
+        // El creador queda como primer miembro
+        add_channel_member(channels[name], client_sock);
+        session.channels.push_back(name);
+        std::cout << "Channel " << name << " created by client socket " << client_sock << std::endl;
+        response.set_message("Channel created successfully.");
+        response.set_status_code(chat::StatusCode::OK);
+      }
+    }
+    else if (channel == channels.end())
+    {
+      response.set_message("Channel not found.");
+      response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    }
+    else if (operation == chat::Operation::JOIN_CHANNEL)
+    {
+      if (add_channel_member(channel->second, client_sock))
+      {
+        session.channels.push_back(name);
+        response.set_message("Joined channel successfully.");
+        response.set_status_code(chat::StatusCode::OK);
+      }
+      else
+      {
+        response.set_message("Already a member of the channel.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+      }
+    }
+    else
+    {
+      if (remove_channel_member(channel->second, client_sock))
+      {
+        forget_channel_membership(session, name);
+        response.set_message("Left channel successfully.");
+        response.set_status_code(chat::StatusCode::OK);
+      }
+      else
+      {
+        response.set_message("Not a member of the channel.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+      }
+    }
+  }
+  send_to(client_sock, response);
+}
+
+// Saca la sesión de todos sus canales al desregistrarse o desconectarse
+void leave_all_channels(Session &session)
+{
+  std::lock_guard<std::mutex> lock(channels_mutex);
+  while (!session.channels.empty())
+  {
+    std::string name = session.channels.back();
+    auto channel = channels.find(name);
+    if (channel != channels.end())
+    {
+      remove_channel_member(channel->second, session.sock);
+    }
+    forget_channel_membership(session, name);
+  }
+}
+
+/**
+ * Envía un mensaje solo a los miembros del canal, el costo depende del tamaño del canal
+ */
+void send_channel_message(ChatMessage &message, const std::string &name, int client_sock, chat::Operation operation)
+{
+  chat::Response &response_to_sender = *new_message<chat::Response>();
+  response_to_sender.set_operation(operation);
+
+  message.type = chat::MessageType::CHANNEL;
+  message.channel = name;
+  auto frame = std::make_shared<IncomingMessageFrame>();
+  if (!encode_incoming_message(message, "Channel message incoming.", *frame))
+  {
+    response_to_sender.set_message("Message is too large.");
+    response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response_to_sender);
+    return;
+  }
+
+  // Los miembros se leen y se entregan con los dos locks: un socket que sigue en el canal es el de la
+  // conexión que se unió, porque la sesión deja sus canales antes de liberarse
+  bool member;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    std::lock_guard<std::mutex> channels_lock(channels_mutex);
+    auto channel = channels.find(name);
+    member = channel != channels.end() && std::binary_search(channel->second.members.begin(), channel->second.members.end(), client_sock);
+    if (member)
+    {
+      for (int member_sock : channel->second.members)
+      {
+        if (member_sock != client_sock)
+        {
+          deliver_incoming_message(member_sock, frame);
+        }
+      }
+    }
+  }
+
+  if (!member)
+  {
+    response_to_sender.set_message("Not a member of the channel.");
+    response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response_to_sender);
+    return;
+  }
+
+  response_to_sender.set_message("Channel message sent successfully.");
+  response_to_sender.set_status_code(chat::StatusCode::OK);
+  send_to(client_sock, response_to_sender);
+}
+
+void handle_send_message(const SendMessageView &send, int client_sock, chat::Operation operation) {
+    std::cout << "Handling send message from client socket " << client_sock << std::endl;
+
+    chat::Response &response_to_sender = *new_message<chat::Response>();
+    response_to_sender.set_operation(operation);
+
+    ChatMessage message;
+    prepare_chat_message(send.content, client_sock, message);
+
+    if (!send.channel.empty()) {
+        std::cout << "Sending channel message to " << send.channel << " from client socket " << client_sock << std::endl;
+        send_channel_message(message, std::string(send.channel), client_sock, operation);
+    } else if (send.recipient.empty()) {
+        std::cout << "Sending broadcast message from client socket " << client_sock << std::endl;
+        send_broadcast_message(message, client_sock);
+    } else {
+        std::cout << "Sending direct message to " << send.recipient << " from client socket " << client_sock << std::endl;
+        // El destino se toma con el lock: si el receptor se desconecta antes de la entrega, el mensaje no
+        // llega a otra conexión que reciba el mismo socket
+        SessionTarget recipient;
+        std::string node;
+        {
+            std::lock_guard<std::mutex> lock(clients_mutex);
+            recipient = session_target(find_recipient_socket(send.recipient));
+            auto remote = remote_users.find(send.recipient);
+            if (recipient.session == nullptr && remote != remote_users.end()) {
+                node = remote->second;
+            }
+        }
+        if (recipient.session != nullptr) {
+            send_direct_message(response_to_sender, message, client_sock, recipient, std::string(send.recipient));
+        } else if (!node.empty()) {
+            // El destinatario es de otro nodo: se entrega allá, sin ids del modo ack
+            bool forwarded = forward_message(node, message, std::string(send.recipient));
+            response_to_sender.set_message(forwarded ? "Message forwarded to node " + node + "." : "Node " + node + " is unreachable.");
+            response_to_sender.set_status_code(forwarded ? chat::StatusCode::OK : chat::StatusCode::INTERNAL_SERVER_ERROR);
+            send_to(client_sock, response_to_sender);
+        } else {
+            std::cerr << "Recipient not found for direct message from socket " << client_sock << std::endl;
+            response_to_sender.set_message("Recipient not found.");
+            response_to_sender.set_status_code(chat::StatusCode::BAD_REQUEST);
+            send_to(client_sock, response_to_sender);
+        }
+    }
+}
+
+
+/**
+ * Destinatarios de una transferencia, con las mismas reglas que SEND_MESSAGE.
+ * Devuelve false y el motivo si no se puede enviar.
+ */
+bool transfer_recipients(const chat::TransferStart &start, int client_sock, std::vector<SessionTarget> &recipients, std::string &error)
+{
+  std::vector<int> sockets;
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  if (!start.channel().empty())
+  {
+    std::lock_guard<std::mutex> channels_lock(channels_mutex);
+    auto channel = channels.find(start.channel());
+    if (channel == channels.end() || !std::binary_search(channel->second.members.begin(), channel->second.members.end(), client_sock))
+    {
+      error = "Not a member of the channel.";
+      return false;
+    }
+    sockets = channel->second.members;
+  }
+  else if (!start.recipient().empty())
+  {
+    int recipient_sock = find_recipient_socket(start.recipient());
+    if (recipient_sock == -1)
+    {
+      error = "Recipient not found.";
+      return false;
+    }
+    sockets.push_back(recipient_sock);
+  }
+  else
+  {
+    for (UserId id = 0; id < users.sockets.size(); id++)
+    {
+      if (users.in_use[id])
+      {
+        sockets.push_back(users.sockets[id]);
+      }
+    }
+  }
+  // Los destinos se toman con clients_mutex: las partes siguientes no llegan a quien reciba después el socket
+  for (int sock : sockets)
+  {
+    SessionTarget target = session_target(sock);
+    if (sock != client_sock && target.session != nullptr)
+    {
+      recipients.push_back(target);
+    }
+  }
+  return true;
+}
+
+// Avisa a los destinatarios que la transferencia no se completará
+void abort_transfer(uint64_t transfer_id, const std::vector<SessionTarget> &recipients)
+{
+  chat::Response notice;
+  notice.set_operation(chat::Operation::TRANSFER_CHUNK);
+  notice.set_message("Transfer aborted.");
+  notice.set_status_code(chat::StatusCode::BAD_REQUEST);
+  notice.mutable_transfer_chunk()->set_transfer_id(transfer_id);
+  for (const SessionTarget &recipient : recipients)
+  {
+    send_to(recipient, notice);
+  }
+  std::cout << "Transfer " << transfer_id << " aborted." << std::endl;
+}
+
+/**
+ * TRANSFER_START: anuncia la transferencia a los destinatarios y da al emisor el crédito inicial
+ */
+void handle_transfer_start(const chat::Request &request, int client_sock)
+{
+  const chat::TransferStart &start = request.transfer_start();
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(chat::Operation::TRANSFER_START);
+
+  std::string sender;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    UserId id = session_user(client_sock);
+    if (id != NO_USER)
+    {
+      sender = users.names[id];
+    }
+  }
+
+  std::vector<SessionTarget> recipients;
+  std::string error;
+  if (sender.empty())
+  {
+    error = "User is not registered.";
+  }
+  else if (start.total_size() == 0 || start.total_size() > MAX_TRANSFER_SIZE)
+  {
+    error = "Invalid transfer size.";
+  }
+  if (!error.empty() || !transfer_recipients(start, client_sock, recipients, error))
+  {
+    response.set_message(error);
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response);
+    return;
+  }
+
+  uint64_t transfer_id = next_transfer_id++;
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex);
+    Transfer &transfer = transfers[transfer_id];
+    transfer.owner = client_sock;
+    transfer.owner_generation = current_session->generation;
+    transfer.recipients = recipients;
+    transfer.total_size = start.total_size();
+  }
+
+  // Los destinatarios reciben el emisor y el tipo en lugar de los campos de ruteo
+  chat::Response &announcement = *new_message<chat::Response>();
+  announcement.set_operation(chat::Operation::TRANSFER_START);
+  announcement.set_message("Transfer incoming.");
+  announcement.set_status_code(chat::StatusCode::OK);
+  chat::TransferStart &incoming = *announcement.mutable_transfer_start();
+  incoming.set_transfer_id(transfer_id);
+  incoming.set_name(start.name());
+  incoming.set_total_size(start.total_size());
+  incoming.set_sender(sender);
+  incoming.set_channel(start.channel());
+  incoming.set_type(!start.channel().empty()    ? chat::MessageType::CHANNEL
+                    : start.recipient().empty() ? chat::MessageType::BROADCAST
+                                                : chat::MessageType::DIRECT);
+  for (const SessionTarget &recipient : recipients)
+  {
+    send_to(recipient, announcement);
+  }
+
+  std::cout << "Transfer " << transfer_id << " of " << start.total_size() << " bytes started by client socket " << client_sock << std::endl;
+  response.set_message("Transfer started.");
+  response.set_status_code(chat::StatusCode::OK);
+  response.mutable_transfer_credit()->set_transfer_id(transfer_id);
+  response.mutable_transfer_credit()->set_chunks(TRANSFER_WINDOW);
+  send_to(client_sock, response);
+}
+
+/**
+ * Una parte ya salió hacia todos sus destinatarios (o la descartaron al cerrarse): cada media ventana
+ * se devuelve el crédito al emisor. Corre donde se suelta la última referencia al frame, a veces con
+ * clients_mutex tomado, así que la sesión del emisor se valida con la generación de la transferencia.
+ */
+void credit_transfer_chunk(uint64_t transfer_id)
+{
+  int owner;
+  uint64_t generation;
+  uint32_t credit;
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex);
+    auto it = transfers.find(transfer_id);
+    if (it == transfers.end() || ++it->second.uncredited < TRANSFER_WINDOW / 2)
+    {
+      return;
+    }
+    owner = it->second.owner;
+    generation = it->second.owner_generation;
+    credit = it->second.uncredited;
+    it->second.uncredited = 0;
+  }
+  SessionTarget target = session_target(owner);
+  if (target.reactor == nullptr || target.generation != generation)
+  {
+    return;
+  }
+  chat::Response response;
+  response.set_operation(chat::Operation::TRANSFER_CREDIT);
+  response.set_status_code(chat::StatusCode::OK);
+  response.mutable_transfer_credit()->set_transfer_id(transfer_id);
+  response.mutable_transfer_credit()->set_chunks(credit);
+  auto frame = std::make_shared<std::string>();
+  if (append_frame(response, socket_codec(owner), *frame))
+  {
+    post_delivery(target.reactor, {target.session, generation, std::move(frame), nullptr});
+  }
+}
+
+/**
+ * TRANSFER_CHUNK: reenvía la parte a los destinatarios. El crédito vuelve al emisor recién cuando la
+ * parte se escribió a todos, así un destinatario lento frena al emisor en lugar de acumular salida.
+ */
+void handle_transfer_chunk(chat::Request &request, int client_sock)
+{
+  chat::TransferChunk &chunk = *request.mutable_transfer_chunk();
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(chat::Operation::TRANSFER_CHUNK);
+
+  std::vector<SessionTarget> recipients;
+  std::string error;
+  bool finished = false;
+  bool aborted = false;
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex);
+    auto it = transfers.find(chunk.transfer_id());
+    if (it == transfers.end() || it->second.owner != client_sock)
+    {
+      error = "Transfer not found.";
+    }
+    else
+    {
+      Transfer &transfer = it->second;
+      uint64_t received = transfer.received + chunk.data().size();
+      if (chunk.sequence() != transfer.next_sequence || chunk.data().size() > TRANSFER_CHUNK_SIZE ||
+          received > transfer.total_size || chunk.last() != (received == transfer.total_size))
+      {
+        error = "Invalid transfer chunk.";
+        aborted = true;
+        recipients = std::move(transfer.recipients);
+        transfers.erase(it);
+      }
+      else
+      {
+        transfer.received = received;
+        transfer.next_sequence++;
+        recipients = transfer.recipients;
+        finished = chunk.last();
+        if (finished)
+        {
+          transfers.erase(it);
+        }
+      }
+    }
+  }
+
+  if (!error.empty())
+  {
+    if (aborted)
+    {
+      abort_transfer(chunk.transfer_id(), recipients);
+    }
+    response.set_message(error);
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response);
+    return;
+  }
+
+  // La parte se serializa una sola vez para todos los destinatarios; al soltarse el frame se devuelve su crédito
+  chat::Response &forward = *new_message<chat::Response>();
+  forward.set_operation(chat::Operation::TRANSFER_CHUNK);
+  forward.set_status_code(chat::StatusCode::OK);
+  forward.mutable_transfer_chunk()->Swap(&chunk);
+  uint64_t transfer_id = forward.transfer_chunk().transfer_id();
+  std::shared_ptr<std::string> frame(new std::string, [transfer_id](std::string *released)
+                                     {
+                                       delete released;
+                                       credit_transfer_chunk(transfer_id);
+                                     });
+  if (serialize_frame(forward, *frame))
+  {
+    for (const SessionTarget &recipient : recipients)
+    {
+      send_frame_to(recipient, frame);
+    }
+  }
+
+  if (finished)
+  {
+    std::cout << "Transfer " << transfer_id << " completed." << std::endl;
+    response.set_message("Transfer completed.");
+    response.set_status_code(chat::StatusCode::OK);
+    send_to(client_sock, response);
+  }
+}
+
+// Cancela las transferencias que envía el socket y lo saca de las que estaba recibiendo
+void forget_transfers(int client_sock)
+{
+  std::vector<std::pair<uint64_t, std::vector<SessionTarget>>> aborted;
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex);
+    for (auto it = transfers.begin(); it != transfers.end();)
+    {
+      auto &recipients = it->second.recipients;
+      if (it->second.owner == client_sock)
+      {
+        aborted.emplace_back(it->first, std::move(recipients));
+        it = transfers.erase(it);
+        continue;
+      }
+      recipients.erase(std::remove_if(recipients.begin(), recipients.end(), [client_sock](const SessionTarget &recipient)
+                                      { return recipient.sock == client_sock; }),
+                       recipients.end());
+      ++it;
+    }
+  }
+  for (const auto &transfer : aborted)
+  {
+    abort_transfer(transfer.first, transfer.second);
+  }
+}
+
+
+/**
+ * Función para manejar el registro de un usuario
+ */
+bool handle_registration(const chat::Request &request, int client_sock) {
+    auto user_request = request.register_user();
+    const auto &username = user_request.username();
+
+    std::lock_guard<std::mutex> lock(clients_mutex);
+
+    std::cout << "Attempting to register username: " << username << std::endl;
+
+    chat::Response &response = *new_message<chat::Response>();
+    response.set_operation(chat::Operation::REGISTER_USER);
+
+    // IP tomada al aceptar la conexión; las de un gateway la traen en el OPEN
+    Session *session = socket_session(client_sock);
+    std::string ip_str = session ? session->ip : "";
+    if (!ip_str.empty()) {
+        std::cout << "IP Address Retrieved: " << ip_str << std::endl;
+    } else {
+        response.set_message("Unable to retrieve IP address.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        send_to(client_sock, response);
+        return false;
+    }
+
+    std::string home = ring.owner(username);
+    if (home != node_name) {
+        std::cout << "User " << username << " belongs to node " << home << ", redirecting." << std::endl;
+        response.set_message("User belongs to node " + home + ".");
+        response.set_status_code(chat::StatusCode::MOVED);
+        response.set_redirect(node_address(home));
+        send_to(client_sock, response);
+        return false;
+    }
+
+    if (find_user(username) != NO_USER || remote_users.count(username) > 0) {
+        std::cout << "Username already taken." << std::endl;
+        response.set_message("Username is already taken.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        send_to(client_sock, response);
+        return false;
+    }
+
+    if (session_user(client_sock) != NO_USER) {
+        response.set_message("Connection already has a registered user.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        send_to(client_sock, response);
+        return false;
+    }
+
+    add_user(username, ip_str, client_sock, user_request.ack_mode());
+    if (session->awaiting_registration) {
+        session->awaiting_registration = false;
+        pending_registrations--;
+    }
+    chat::Codec codec = negotiate_codec(user_request.codecs());
+    publish_presence(chat::PresenceEvent::USER_JOINED, username, chat::UserStatus::ONLINE);
+
+    std::cout << "User registered successfully: " << username << std::endl;
+
+    response.set_message("User registered successfully.");
+    response.set_status_code(chat::StatusCode::OK);
+    response.set_codec(codec);
+    send_to(client_sock, response);
+    // La respuesta de registro viaja sin comprimir, el codec aplica desde el siguiente frame
+    set_socket_codec(client_sock, codec);
+    return true;
+}
+
+void add_user_to_response(UserId id, chat::UserListResponse &response)
+{
+  chat::User *user_proto = response.add_users();
+  // Username concatenated string: <username> (<ip>)
+  user_proto->set_username(users.names[id] + " (" + users.ips[id] + ")");
+  user_proto->set_status(users.statuses[id]);
+}
+
+// Agrega un usuario de este nodo o, si no está, de la réplica del clúster como "<username> (@<nodo>)". Requiere clients_mutex.
+void add_listed_user(std::string_view username, chat::UserListResponse &response)
+{
+  UserId id = find_user(username);
+  if (id != NO_USER)
+  {
+    add_user_to_response(id, response);
+    return;
+  }
+  auto remote = remote_users.find(username);
+  if (remote == remote_users.end())
+  {
+    return;
+  }
+  chat::User *user_proto = response.add_users();
+  user_proto->set_username(remote->first + " (@" + remote->second + ")");
+  user_proto->set_status(node_presence.at(remote->second).at(remote->first).status);
+}
+
+void rebuild_user_list_cache(chat::Operation operation); // Predeclaración de rebuild_user_list_cache
+
+/**
+ * Devuelve la lista completa de usuarios ya serializada (y comprimida con el codec de la
+ * conexión). Solo se vuelve a armar cuando cambió el registro o la réplica de los otros nodos.
+ * Requiere clients_mutex.
+ */
+std::shared_ptr<const std::string> cached_user_list(chat::Operation operation, chat::Codec codec)
+{
+  if (!user_list_cache || user_list_cache_version != registry_version || user_list_cache_remote_version != remote_users_version)
+  {
+    rebuild_user_list_cache(operation);
+  }
+  if (!user_list_cache || codec == chat::Codec::NO_COMPRESSION || user_list_cache->size() < COMPRESSION_THRESHOLD)
+  {
+    return user_list_cache;
+  }
+
+  // La versión comprimida también se arma una sola vez por versión del registro
+  auto &compressed = user_list_cache_compressed[codec];
+  if (!compressed)
+  {
+    auto frame = std::make_shared<std::string>();
+    if (!compress_frame(codec, *user_list_cache, *frame))
+    {
+      frame = nullptr;
+    }
+    compressed = frame ? frame : user_list_cache;
+  }
+  return compressed;
+}
+
+void rebuild_user_list_cache(chat::Operation operation)
+{
+  for (auto &compressed : user_list_cache_compressed)
+  {
+    compressed.reset();
+  }
+  user_list_cache.reset();
+
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(operation);
+  response.set_message("All users returned successfully.");
+  response.set_status_code(chat::StatusCode::OK);
+  auto *user_list_response = response.mutable_user_list();
+  user_list_response->set_type(chat::UserListType::ALL);
+  for (const auto &user : users_by_name)
+  {
+    add_user_to_response(user.second, *user_list_response);
+  }
+  for (const auto &user : remote_users)
+  {
+    if (find_user(user.first) == NO_USER)
+    {
+      add_listed_user(user.first, *user_list_response);
+    }
+  }
+
+  auto frame = std::make_shared<std::string>();
+  if (serialize_frame(response, *frame))
+  {
+    user_list_cache = frame;
+  }
+  user_list_cache_version = registry_version;
+  user_list_cache_remote_version = remote_users_version;
+}
+
+bool is_paginated(const chat::UserListRequest &request)
+{
+  return !request.cursor().empty() || !request.prefix().empty() || request.filter_status() || request.limit() != 0;
+}
+
+/**
+ * Recorre un índice ordenado por nombre desde el cursor y junta a lo sumo limit nombres con el
+ * prefijo pedido. El costo es O(log n + tamaño de página). Requiere clients_mutex.
+ */
+template <typename Index, typename NameOf>
+void collect_user_names(const Index &index, NameOf name_of, const chat::UserListRequest &request, size_t limit, std::vector<std::string_view> &names)
+{
+  std::string_view prefix = request.prefix();
+  std::string_view cursor = request.cursor();
+  auto it = (cursor.empty() || cursor < prefix) ? index.lower_bound(prefix) : index.upper_bound(cursor);
+  for (size_t count = 0; it != index.end() && count < limit; ++it, count++)
+  {
+    std::string_view name = name_of(*it);
+    if (name.substr(0, prefix.size()) != prefix)
+    {
+      break; // Fuera del rango del prefijo
+    }
+    names.push_back(name);
+  }
+}
+
+/**
+ * GET_USERS paginado y filtrado por prefijo y estado
+ */
+void send_user_page(const chat::Request &request, int client_sock, chat::Operation operation)
+{
+  const auto &page_request = request.get_users();
+  size_t limit = page_request.limit() == 0 ? USER_PAGE_SIZE : std::min<size_t>(page_request.limit(), MAX_USER_PAGE_SIZE);
+
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(operation);
+  // El filtro indexa users_by_status y remote_by_status, solo se aceptan estados del enum
+  if (page_request.filter_status() && !chat::UserStatus_IsValid(page_request.status()))
+  {
+    response.set_message("Invalid status filter.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    send_to(client_sock, response);
+    return;
+  }
+  auto *page = response.mutable_user_list();
+  page->set_type(chat::UserListType::ALL);
+  {
+    // La página mezcla los usuarios de este nodo con los de la réplica, cada índice aporta hasta limit + 1
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    std::vector<std::string_view> names;
+    if (page_request.filter_status())
+    {
+      auto name_of = [](std::string_view username) { return username; };
+      collect_user_names(users_by_status[page_request.status()], name_of, page_request, limit + 1, names);
+      collect_user_names(remote_by_status[page_request.status()], name_of, page_request, limit + 1, names);
+    }
+    else
+    {
+      auto name_of = [](const auto &user) { return std::string_view(user.first); };
+      collect_user_names(users_by_name, name_of, page_request, limit + 1, names);
+      collect_user_names(remote_users, name_of, page_request, limit + 1, names);
+    }
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+    if (names.size() > limit)
+    {
+      names.resize(limit);
+      page->set_next_cursor(std::string(names.back()));
+    }
+    for (std::string_view name : names)
+    {
+      add_listed_user(name, *page);
+    }
+  }
+  response.set_message("User page returned successfully.");
+  response.set_status_code(chat::StatusCode::OK);
+  send_to(client_sock, response);
+}
+
+/**
+ * GET_USERS 
+ */
+void handle_get_users(const chat::Request &request, int client_sock, chat::Operation operation)
+{
+  if (request.get_users().username().empty())
+  {
+    if (!is_paginated(request.get_users()))
+    {
+      // Return all connected users from the cached snapshot, shared with the reactors that write it
+      std::shared_ptr<const std::string> frame;
+      {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        frame = cached_user_list(operation, socket_codec(client_sock));
+      }
+      if (frame)
+      {
+        send_frame_to(client_sock, frame);
+        std::cout << "All users returned successfully." << std::endl;
+        return;
+      }
+      // The full list does not fit in a frame: answer with the first page and a cursor
+    }
+    send_user_page(request, client_sock, operation);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(clients_mutex);
+
+  chat::Response &response = *new_message<chat::Response>();
+  response.set_operation(operation);
+
+  chat::UserListResponse &user_list_response = *response.mutable_user_list();
+
+  user_list_response.set_type(chat::UserListType::SINGLE);
+  // Return only the specified user
+  add_listed_user(request.get_users().username(), user_list_response);
+  if (user_list_response.users_size() > 0)
+  {
+    std::cout << "User returned successfully: " << request.get_users().username() << std::endl;
+    response.set_message("User returned successfully.");
+    response.set_status_code(chat::StatusCode::OK);
+  }
+  else
+  {
+    std::cout << "User not found: " << request.get_users().username() << std::endl;
+    response.set_message("User not found.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+  }
+
+  // Send the complete response
+  send_to(client_sock, response);
+}
+
+void unregister_user(Session &session, bool forced = false)
+{
+  int client_sock = session.sock;
+  leave_all_channels(session);
+  forget_transfers(client_sock);
+  std::lock_guard<std::mutex> lock(clients_mutex);
+  chat::Response &response = *new_message<chat::Response>();
+
+  UserId id = session_user(client_sock);
+  if (id != NO_USER)
+  {
+    std::string username = users.names[id];
+
+    // Erase user data and release the id
+    remove_user(id);
+
+    presence_subscribers.erase(client_sock);
+
+    publish_presence(chat::PresenceEvent::USER_LEFT, username, chat::UserStatus::OFFLINE);
+
+    // Prepare a response message
+    response.set_operation(chat::Operation::UNREGISTER_USER);
+    response.set_message("User unregistered successfully.");
+    response.set_status_code(chat::StatusCode::OK);
+  }
+  else
+  {
+    // User not found or already unregistered, send error response
+    response.set_message("User not found or already unregistered.");
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+  }
+
+  if (!forced)
+  {
+    send_to(client_sock, response);
+  }
+}
+
+/**
+ * Toma los tokens de la solicitud del límite del usuario y del de su IP. Las partes de una transferencia
+ * aceptada no cuentan, su ritmo ya lo controla el crédito; un broadcast cuesta más porque llega a todos.
+ */
+bool within_rate_limit(Session &session, const RequestView &view, const chat::Request &request)
+{
+  if (view.operation == chat::Operation::TRANSFER_CHUNK)
+  {
+    std::lock_guard<std::mutex> lock(transfers_mutex);
+    auto it = transfers.find(request.transfer_chunk().transfer_id());
+    if (it != transfers.end() && it->second.owner == session.sock)
+    {
+      return true;
+    }
+  }
+  // Los lotes de un nodo ya autenticado juntan a muchos usuarios. peer_node solo cambia en esta misma cadena
+  if (view.operation == chat::Operation::PEER_BATCH && !session.peer_node.empty())
+  {
+    return true;
+  }
+  bool broadcast = view.operation == chat::Operation::SEND_MESSAGE && view.send_message.recipient.empty() && view.send_message.channel.empty();
+  double cost = broadcast ? BROADCAST_RATE_COST : 1;
+  auto now = std::chrono::steady_clock::now();
+  // La IP se consulta primero: si la rechaza, la solicitud no gasta tokens del usuario
+  std::lock_guard<std::mutex> lock(session.ip_limiter->mutex);
+  if (!session.ip_limiter->bucket.available(cost, now) || !session.rate_limit.take(cost, now))
+  {
+    return false;
+  }
+  return session.ip_limiter->bucket.take(cost, now);
+}
+
+// Entrega a los usuarios de este nodo un mensaje que llegó de otro nodo
+void deliver_forwarded_message(const chat::ForwardedMessage &forwarded) {
+    ChatMessage message;
+    message.sender = forwarded.sender();
+    message.content = std::make_shared<const std::string>(forwarded.content());
+    bool broadcast = forwarded.recipient().empty();
+    message.type = broadcast ? chat::MessageType::BROADCAST : chat::MessageType::DIRECT;
+    auto frame = std::make_shared<IncomingMessageFrame>();
+    if (!encode_incoming_message(message, broadcast ? "Broadcast message incoming." : "Message incoming.", *frame)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    if (broadcast) {
+        for (UserId id = 0; id < users.sockets.size(); id++) {
+            if (users.in_use[id]) {
+                deliver_incoming_message(users.sockets[id], frame);
+            }
+        }
+        return;
+    }
+    int recipient_sock = find_recipient_socket(forwarded.recipient());
+    if (recipient_sock == -1) {
+        std::cerr << "Forwarded message for " << forwarded.recipient() << " dropped, the user is not on this node." << std::endl;
+        return;
+    }
+    deliver_incoming_message(recipient_sock, frame);
+}
+
+/**
+ * Responde el digest de un par con lo que le falta de cada nodo que este conoce mejor, en partes que
+ * entren en un frame. Si el par no tiene el nodo, lo tiene de otra encarnación o ya se compactaron
+ * lápidas que no vio, la respuesta reemplaza su tabla. Requiere clients_mutex.
+ */
+void answer_digest(const chat::PeerBatch &batch, int client_sock) {
+    std::unordered_map<std::string_view, const chat::NodeVersion *> digest;
+    for (const auto &version : batch.digest()) {
+        digest[version.node()] = &version;
+    }
+    for (const auto &clock : node_clocks) {
+        const std::string &node = clock.first;
+        auto known = digest.find(node);
+        const chat::NodeVersion *peer = known == digest.end() ? nullptr : known->second;
+        bool same = peer != nullptr && peer->incarnation() == clock.second.incarnation;
+        if (node == batch.node() || (same && peer->version() >= clock.second.version)) {
+            continue;
+        }
+        bool replace = !same || peer->version() < clock.second.compacted;
+        uint64_t since = replace ? 0 : peer->version();
+
+        chat::Response &response = *new_message<chat::Response>();
+        response.set_operation(chat::Operation::PEER_BATCH);
+        response.set_message(node_name);
+        response.set_status_code(chat::StatusCode::OK);
+        chat::GossipUpdate *update = response.mutable_gossip();
+        chat::NodeVersion *version = update->mutable_node();
+        version->set_node(node);
+        version->set_incarnation(clock.second.incarnation);
+        version->set_replace(replace);
+        size_t size = 0;
+        for (const auto &record : node_presence[node]) {
+            if (record.second.version <= since || (replace && record.second.removed)) {
+                continue;
+            }
+            if (size + record.first.size() + node.size() + 32 > BUFFER_SIZE / 2) {
+                send_to(client_sock, response);
+                update->clear_entries();
+                version->set_replace(false);
+                size = 0;
+            }
+            chat::PresenceEntry *entry = update->add_entries();
+            entry->set_username(record.first);
+            entry->set_node(node);
+            entry->set_status(record.second.status);
+            entry->set_version(record.second.version);
+            entry->set_removed(record.second.removed);
+            size += record.first.size() + node.size() + 32;
+        }
+        // La versión va solo en la última parte: el par no la da por alcanzada hasta tener todo
+        version->set_version(clock.second.version);
+        send_to(client_sock, response);
+    }
+}
+
+// Compara el secreto sin cortar en el primer byte distinto, así el tiempo de la respuesta no lo revela
+bool secret_matches(const std::string &offered) {
+    if (link_secret.empty() || offered.size() != link_secret.size()) {
+        return false;
+    }
+    unsigned char difference = 0;
+    for (size_t i = 0; i < offered.size(); i++) {
+        difference |= static_cast<unsigned char>(offered[i] ^ link_secret[i]);
+    }
+    return difference == 0;
+}
+
+/**
+ * PEER_BATCH: cambios de presencia, digest y mensajes de otro nodo. El primer lote del enlace trae la
+ * foto completa de sus usuarios y el secreto del clúster, y se responde con el nombre de este nodo; un
+ * digest se responde con answer_digest y los demás lotes no se responden. Hasta que la foto se acepta,
+ * la conexión es un cliente más (límites de solicitudes y de registros pendientes); si no se acepta,
+ * se rechaza y se cierra.
+ */
+void handle_peer_batch(const chat::Request &request, Session &session) {
+    const chat::PeerBatch &batch = request.peer_batch();
+    int client_sock = session.sock;
+    bool authenticated = !batch.snapshot() || (secret_matches(batch.secret()) && !batch.node().empty() && batch.node() != node_name);
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        authenticated = authenticated && (batch.snapshot() || (!session.peer_node.empty() && session.peer_node == batch.node()));
+    }
+    if (!authenticated) {
+        std::cerr << "Refused peer link from " << batch.node() << " on socket " << client_sock << "." << std::endl;
+        chat::Response &response = *new_message<chat::Response>();
+        response.set_operation(chat::Operation::PEER_BATCH);
+        response.set_message("Peer link not authenticated.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        send_to(client_sock, response);
+        post_control(session, SessionControl::DISCONNECT);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        if (batch.snapshot()) {
+            std::cout << "Node " << batch.node() << " linked on socket " << client_sock << " with " << batch.presence_size() << " users." << std::endl;
+            forget_node_presence(batch.node());
+            peer_sockets[batch.node()] = client_sock;
+            session.peer_node = batch.node();
+            if (session.awaiting_registration) {
+                session.awaiting_registration = false;
+                pending_registrations--;
+            }
+        }
+        for (const auto &entry : batch.presence()) {
+            apply_presence_entry(entry);
+        }
+        // Los cambios del par llegan en orden: su reloj avanza con cada lote y la foto fija la encarnación
+        auto clock = node_clocks.find(batch.node());
+        if (batch.has_clock()) {
+            NodeClock &snapshot = node_clocks[batch.node()];
+            snapshot.incarnation = batch.clock().incarnation();
+            snapshot.version = std::max(snapshot.version, batch.clock().version());
+        } else if (clock != node_clocks.end() && batch.presence_size() > 0) {
+            clock->second.version = std::max(clock->second.version, batch.presence(batch.presence_size() - 1).version());
+        }
+        if (batch.digest_size() > 0) {
+            answer_digest(batch, client_sock);
+        }
+    }
+    if (batch.snapshot()) {
+        chat::Response &response = *new_message<chat::Response>();
+        response.set_operation(chat::Operation::PEER_BATCH);
+        response.set_message(node_name);
+        response.set_status_code(chat::StatusCode::OK);
+        send_to(client_sock, response);
+    }
+    for (const auto &forwarded : batch.messages()) {
+        deliver_forwarded_message(forwarded);
+    }
+}
+
+/**
+ * Cliente local que pasa sus frames a memoria compartida: el memfd llegó pegado a la solicitud. El
+ * reactor cambia de transporte antes de escribir la respuesta, que ya va por los anillos; si se
+ * rechaza, la respuesta va por el socket y la conexión se cierra.
+ */
+void open_shared_memory(Session &session) {
+    int client_sock = session.sock;
+    int memfd = session.passed_fd.exchange(-1);
+    bool registered;
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        registered = session.user != NO_USER;
+    }
+    std::unique_ptr<ShmChannel> channel;
+    if (memfd >= 0 && session.local && !registered && !session.shm_opened) {
+        channel = map_shm_channel(memfd);
+    } else if (memfd >= 0) {
+        close(memfd);
+    }
+
+    chat::Response &response = *new_message<chat::Response>();
+    response.set_operation(chat::Operation::OPEN_SHARED_MEMORY);
+    if (!channel) {
+        response.set_message("Shared memory needs a local connection without a registered user and a valid channel.");
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        send_to(client_sock, response);
+        post_control(session, SessionControl::DISCONNECT);
+        return;
+    }
+    session.shm_opened = true;
+    session.shm_pending = std::move(channel);
+    post_control(session, SessionControl::ATTACH_SHARED_MEMORY);
+    response.set_message("Shared memory transport ready.");
+    response.set_status_code(chat::StatusCode::OK);
+    send_to(client_sock, response);
+}
+
+/**
+ * Atiende una solicitud completa de la conexión. Devuelve false si no se pudo interpretar.
+ */
+bool handle_request(Session &session, std::string_view payload) {
+    int client_sock = session.sock;
+    // Todo lo que se crea para atender la solicitud vive en la arena y se libera en un solo Reset
+    google::protobuf::Arena &arena = session.arena;
+
+    // SEND_MESSAGE y UPDATE_STATUS se decodifican a mano sobre el buffer; el resto pasa por protobuf
+    RequestView view;
+    chat::Request &request = *new_message<chat::Request>();
+    if (!decode_request_view(payload, view)) {
+        if (!request.ParseFromArray(payload.data(), payload.size())) {
+            std::cerr << "Failed to parse message from client. Closing connection." << std::endl;
+            arena.Reset();
+            return false;
+        }
+        request_view(request, view);
+    }
+
+    if (!within_rate_limit(session, view, request)) {
+        chat::Response &response = *new_message<chat::Response>();
+        response.set_operation(view.operation);
+        response.set_message("Too many requests, slow down.");
+        response.set_status_code(chat::StatusCode::RATE_LIMITED);
+        send_to(client_sock, response);
+        arena.Reset();
+        return true;
+    }
+
+     {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        UserId id = session_user(client_sock);
+        if (id != NO_USER) {
+            users.last_active[id] = std::chrono::steady_clock::now();
+        }
+    }
+
+    switch (view.operation) {
+        case chat::Operation::REGISTER_USER:
+            if (!handle_registration(request, client_sock)) {
+                std::cerr << "Registration failed for client." << std::endl;
+            }
+            break;
+        case chat::Operation::SEND_MESSAGE:
+             handle_send_message(view.send_message, client_sock, chat::Operation::SEND_MESSAGE);
+            break;
+        case chat::Operation::UPDATE_STATUS:
+             update_status(view.update_status, client_sock, chat::Operation::UPDATE_STATUS);
+            break;
+        case chat::Operation::GET_USERS:
+             handle_get_users(request, client_sock, chat::Operation::GET_USERS);
+             break;
+        case chat::Operation::UNREGISTER_USER:
+            unregister_user(session);
+             break;
+        case chat::Operation::ACK_MESSAGES:
+            handle_ack(request, client_sock);
+            break;
+        case chat::Operation::CREATE_CHANNEL:
+        case chat::Operation::JOIN_CHANNEL:
+        case chat::Operation::LEAVE_CHANNEL:
+            handle_channel_request(request, session, request.operation());
+            break;
+        case chat::Operation::SUBSCRIBE_PRESENCE:
+            handle_presence_subscription(request, client_sock, chat::Operation::SUBSCRIBE_PRESENCE);
+            break;
+        case chat::Operation::TRANSFER_START:
+            handle_transfer_start(request, client_sock);
+            break;
+        case chat::Operation::TRANSFER_CHUNK:
+            handle_transfer_chunk(request, client_sock);
+            break;
+        case chat::Operation::PEER_BATCH:
+            handle_peer_batch(request, session);
+            break;
+        case chat::Operation::OPEN_SHARED_MEMORY:
+            open_shared_memory(session);
+            break;
+        default:
+            chat::Response &response = *new_message<chat::Response>();
+            response.set_message("request type DESCONOCIDO.");
+            response.set_status_code(chat::StatusCode::BAD_REQUEST);
+            send_to(client_sock, response);
+            break;
+    }
+    arena.Reset();
+    return true;
+}
+
+/**
+ * Limpia los datos de la sesión (canales, transferencias, usuario) y le pide al reactor dueño que cierre
+ * el socket. Corre al final de la cadena de la sesión, después de sus últimas solicitudes.
+ */
+void forget_session(Session &session) {
+    int client_sock = session.sock;
+    leave_all_channels(session);
+    forget_transfers(client_sock);
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    presence_subscribers.erase(client_sock);
+    auto peer = peer_sockets.find(session.peer_node);
+    if (peer != peer_sockets.end() && peer->second == client_sock) {
+        // Se cayó el enlace del nodo: sus usuarios dejan de ser alcanzables hasta que vuelva a conectarse
+        std::cout << "Node " << session.peer_node << " unlinked." << std::endl;
+        forget_node_presence(session.peer_node);
+        peer_sockets.erase(peer);
+    }
+    UserId id = session_user(client_sock);
+    if (id != NO_USER) {
+        std::string username = users.names[id];
+        remove_user(id);
+        publish_presence(chat::PresenceEvent::USER_LEFT, username, chat::UserStatus::OFFLINE);
+    }
+    post_control(session, SessionControl::CLOSE);
+}
+
+/**
+ * Atiende en orden las solicitudes encoladas de la sesión. Es la única tarea de la sesión en el pool:
+ * termina cuando inbox queda vacío y la siguiente lectura del reactor la vuelve a encolar.
+ */
+void run_session(void *context) {
+    Session &session = *static_cast<Session *>(context);
+    current_session = &session;
+    while (true) {
+        bool resume;
+        {
+            std::lock_guard<std::mutex> lock(session.inbox_mutex);
+            if (session.inbox.empty()) {
+                if (!session.closing) {
+                    session.scheduled = false;
+                    current_session = nullptr;
+                    return;
+                }
+                break;
+            }
+            session.inbox.swap(session.batch);
+            resume = session.paused;
+            session.paused = false;
+        }
+        if (resume) {
+            post_control(session, SessionControl::RESUME_READING);
+        }
+
+        bool failed = false;
+        std::string_view batch = session.batch;
+        while (!batch.empty() && !failed) {
+            uint32_t length;
+            memcpy(&length, batch.data(), sizeof(length));
+            failed = !handle_request(session, batch.substr(sizeof(length), length));
+            batch.remove_prefix(sizeof(length) + length);
+        }
+        session.batch.clear();
+        if (session.batch.capacity() > MAX_PENDING_INPUT) {
+            std::string().swap(session.batch);
+        }
+        if (failed) {
+            std::cerr << "Failed to read message from client. Closing connection." << std::endl;
+            std::lock_guard<std::mutex> lock(session.inbox_mutex);
+            session.closing = true;
+            break;
+        }
+    }
+    current_session = nullptr;
+    forget_session(session);
+}
+
+// Registro de la sesión en el epoll del reactor según si se está leyendo y si espera para escribir
+void update_session_events(Session &session) {
+    if (session.gateway != nullptr) {
+        // Una conexión del gateway que no se lee frena la lectura de todo su enlace
+        Session &link = *session.gateway;
+        link.streams_paused = std::any_of(link.streams.begin(), link.streams.end(), [](const auto &stream) { return !stream.second->reading; });
+        update_session_events(link);
+        return;
+    }
+    if (session.detached) {
+        return;
+    }
+    epoll_event event = {};
+    bool wait_input = session.reading && !session.streams_paused;
+    if (session.shm) {
+        // Con memoria compartida el aviso de que el cliente hizo lugar en el anillo también llega como EPOLLIN
+        wait_input = wait_input || session.want_write;
+    } else if (session.want_write) {
+        event.events |= EPOLLOUT;
+    }
+    if (wait_input) {
+        event.events |= EPOLLIN;
+    }
+    event.data.ptr = &session;
+    Reactor *reactor = session.reactor;
+    if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_MOD, session.sock, &event) < 0) {
+        perror("epoll_ctl failed");
+    }
+}
+
+// Deja de vigilar la conexión; lo que quede en su salida se intenta escribir una vez más al cerrarla
+void detach_session(Session &session) {
+    if (!session.detached) {
+        Reactor *reactor = session.reactor;
+        epoll_ctl(reactor->epoll_fd, EPOLL_CTL_DEL, session.sock, nullptr);
+        session.detached = true;
+    }
+}
+
+// Pide el cierre de la conexión: la limpieza va en la cadena de la sesión, detrás de lo ya encolado
+void request_close(Session &session) {
+    detach_session(session);
+    bool schedule;
+    {
+        std::lock_guard<std::mutex> lock(session.inbox_mutex);
+        if (session.closing) {
+            return;
+        }
+        session.closing = true;
+        schedule = !session.scheduled;
+        session.scheduled = true;
+    }
+    if (schedule) {
+        request_pool->submit({run_session, &session});
+    }
+}
+
+void flush_session(Session &session);
+
+/**
+ * Cierra el socket y devuelve la sesión al pool. Solo la llama el reactor dueño, con la sesión ya
+ * limpia o sin solicitudes atendidas.
+ */
+void close_session(Session &session) {
+    int client_sock = session.sock;
+    detach_session(session);
+    if (!session.streams.empty()) {
+        // Primero se cierran las conexiones del gateway; la última en cerrarse cierra el enlace
+        session.close_deferred = true;
+        for (auto &stream : session.streams) {
+            stream.second->stream_closed = true;
+            request_close(*stream.second);
+        }
+        return;
+    }
+    flush_session(session);
+    auto &dirty = current_reactor->dirty;
+    dirty.erase(std::remove(dirty.begin(), dirty.end(), &session), dirty.end());
+    Session *link = session.gateway;
+    open_connections--;
+    if (link != nullptr) {
+        link->streams.erase(session.stream);
+        if (!session.stream_closed) {
+            push_stream_frame(*link, session.stream, StreamKind::CLOSE);
+        }
+    }
+    if (session.awaiting_registration) {
+        pending_registrations--;
+    }
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        release_session(session);
+    }
+    set_socket_codec(client_sock, chat::Codec::NO_COMPRESSION);
+    if (link != nullptr) {
+        if (link->streams.empty() && link->close_deferred) {
+            close_session(*link);
+        }
+        return;
+    }
+    // El socket se cierra al final para que su descriptor no se reutilice antes de limpiar la sesión
+    close(client_sock);
+}
+
+/**
+ * Encola en la cadena de la sesión cada solicitud completa de data y devuelve los bytes usados. Los
+ * frames STREAM de un gateway quedan en streams para atenderlos fuera del lock de inbox.
+ */
+size_t receive_frames(Session &session, std::string_view data, std::vector<std::string_view> &streams) {
+    size_t consumed = 0;
+    bool invalid = false;
+    bool schedule = false;
+    bool paused;
+    int pings = 0;
+    {
+        std::lock_guard<std::mutex> lock(session.inbox_mutex);
+        while (true) {
+            std::string_view payload;
+            size_t frame_size;
+            FrameStatus status = parse_frame(data.substr(consumed), payload, frame_size);
+            if (status == FrameStatus::INCOMPLETE) {
+                break;
+            }
+            if (status == FrameStatus::INVALID || (status == FrameStatus::STREAM && session.gateway != nullptr)) {
+                invalid = true;
+                break;
+            }
+            // Los heartbeats se atienden en el reactor, no ocupan la cadena de la sesión
+            if (status == FrameStatus::PING || status == FrameStatus::PONG) {
+                pings += status == FrameStatus::PING;
+                consumed += frame_size;
+                continue;
+            }
+            if (status == FrameStatus::STREAM) {
+                streams.push_back(payload);
+            } else if (!session.closing) {
+                uint32_t length = payload.size();
+                session.inbox.append(reinterpret_cast<const char *>(&length), sizeof(length));
+                session.inbox.append(payload);
+            }
+            consumed += frame_size;
+        }
+        if (!session.inbox.empty() && !session.scheduled) {
+            session.scheduled = schedule = true;
+        }
+        if (session.inbox.size() > MAX_PENDING_INPUT) {
+            session.paused = true;
+        }
+        paused = session.paused;
+    }
+    if (schedule) {
+        request_pool->submit({run_session, &session});
+    }
+    for (int i = 0; i < pings; i++) {
+        push_control_frame(session, PONG_FRAME);
+    }
+    if (invalid) {
+        std::cerr << "Failed to read message from client. Closing connection." << std::endl;
+        request_close(session);
+        return consumed;
+    }
+    if (paused && session.reading) {
+        session.reading = false;
+        update_session_events(session);
+    }
+    return consumed;
+}
+
+// Arma frames con los bytes que llegaron; solo el resto de un frame partido se copia a receive_buffer
+void receive_bytes(Session &session, std::string_view data, std::vector<std::string_view> &streams) {
+    bool buffered = !session.receive_buffer.empty();
+    if (buffered) {
+        session.receive_buffer.append(data);
+        data = session.receive_buffer;
+    }
+    size_t consumed = receive_frames(session, data, streams);
+    if (buffered) {
+        session.receive_buffer.erase(0, consumed);
+    } else {
+        session.receive_buffer.assign(data.substr(consumed));
+    }
+}
+
+/**
+ * Conexión nueva de un cliente del gateway, atendida por el reactor del enlace. Cuenta como una conexión
+ * más del servidor: se rechaza con el servidor lleno, con demasiados registros pendientes (así un gateway
+ * no frena accept para todos) o con el enlace en MAX_STREAMS_PER_GATEWAY_LINK conexiones.
+ */
+void open_stream(Session &link, uint32_t stream, const std::string &ip) {
+    bool full = open_connections >= MAX_CONNECTIONS || pending_registrations >= MAX_PENDING_REGISTRATIONS ||
+                link.streams.size() >= MAX_STREAMS_PER_GATEWAY_LINK;
+    int stream_sock = full || link.streams.count(stream) > 0 ? -1 : acquire_stream_sock();
+    if (stream_sock < 0) {
+        std::cerr << "Gateway stream " << stream << " on socket " << link.sock << " refused." << std::endl;
+        push_stream_frame(link, stream, StreamKind::CLOSE);
+        return;
+    }
+    Session &session = acquire_session(stream_sock, *current_reactor, ip);
+    open_connections++;
+    session.gateway = &link;
+    session.stream = stream;
+    session.detached = true; // No está en el epoll: lo que llega y lo que sale pasa por el enlace
+    session.awaiting_registration = true;
+    pending_registrations++;
+    link.streams[stream] = &session;
+}
+
+/**
+ * Frame STREAM de un gateway: abre, alimenta o cierra una de las conexiones que multiplexa. El primero
+ * de la conexión tiene que ser LINK con el secreto del servidor: recién ahí pasa a ser el enlace de un
+ * gateway y deja de contar como registro pendiente. Sin él se cierra.
+ */
+void handle_stream_frame(Session &link, std::string_view payload) {
+    uint32_t stream;
+    StreamKind kind;
+    std::string_view data;
+    if (!read_stream_header(payload, stream, kind, data)) {
+        std::cerr << "Invalid stream frame on socket " << link.sock << ", closing connection." << std::endl;
+        request_close(link);
+        return;
+    }
+    if (!link.gateway_link || kind == StreamKind::LINK) {
+        bool linked = !link.gateway_link && kind == StreamKind::LINK && secret_matches(std::string(data));
+        {
+            std::lock_guard<std::mutex> lock(clients_mutex);
+            // Un usuario registrado o un nodo par no pasan a ser gateways
+            linked = linked && link.awaiting_registration;
+            if (linked) {
+                link.awaiting_registration = false;
+                pending_registrations--;
+            }
+        }
+        if (!linked) {
+            std::cerr << "Refused gateway link on socket " << link.sock << ", closing connection." << std::endl;
+            request_close(link);
+            return;
+        }
+        std::cout << "Gateway linked on socket " << link.sock << "." << std::endl;
+        link.gateway_link = true;
+        return;
+    }
+    auto it = link.streams.find(stream);
+    if (kind == StreamKind::OPEN) {
+        open_stream(link, stream, std::string(data));
+    } else if (it == link.streams.end()) {
+        // Conexión que este lado ya cerró (o que no pasó en una actualización): el gateway también la cierra
+        if (kind == StreamKind::DATA) {
+            push_stream_frame(link, stream, StreamKind::CLOSE);
+        }
+    } else if (kind == StreamKind::CLOSE) {
+        it->second->stream_closed = true;
+        request_close(*it->second);
+    } else {
+        std::vector<std::string_view> nested; // Queda vacío: un cliente no puede mandar frames STREAM
+        receive_bytes(*it->second, data, nested);
+    }
+}
+
+// Lee del socket. Un cliente local puede mandar un descriptor con los datos (el memfd de OPEN_SHARED_MEMORY)
+ssize_t receive_chunk(Session &session, char *data, size_t size) {
+    if (!session.local) {
+        return recv(session.sock, data, size, MSG_DONTWAIT);
+    }
+    struct iovec part = {data, size};
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    struct msghdr header = {};
+    header.msg_iov = &part;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+    // Los descriptores que no entran en control los cierra el kernel
+    ssize_t bytesRead = recvmsg(session.sock, &header, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    struct cmsghdr *message = bytesRead > 0 ? CMSG_FIRSTHDR(&header) : nullptr;
+    if (message != nullptr && message->cmsg_level == SOL_SOCKET && message->cmsg_type == SCM_RIGHTS) {
+        int fd;
+        memcpy(&fd, CMSG_DATA(message), sizeof(int));
+        int previous = session.passed_fd.exchange(fd);
+        if (previous >= 0) {
+            close(previous);
+        }
+    }
+    return bytesRead;
+}
+
+/**
+ * Cliente por memoria compartida: descarta los avisos del socket y lee el anillo hasta vaciarlo. Al
+ * final marca que el servidor duerme, así el cliente avisa con el próximo frame que escriba.
+ */
+void read_shared_memory(Session &session, std::string &chunk) {
+    while (true) {
+        ssize_t bytesRead = recv(session.sock, &chunk[0], chunk.size(), MSG_DONTWAIT);
+        if (bytesRead > 0 || (bytesRead < 0 && errno == EINTR)) {
+            continue;
+        }
+        if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        if (bytesRead < 0) {
+            perror("recv failed");
+        } else {
+            std::cerr << "Connection closed by peer." << std::endl;
+        }
+        request_close(session);
+        return;
+    }
+
+    ShmRing &ring = session.shm->to_server;
+    // Una sesión pausada no marca que duerme: la vuelve a leer resume_reading
+    while (session.reading && !session.detached) {
+        size_t size = ring.read(&chunk[0], chunk.size());
+        if (size == 0) {
+            if (ring.prepare_consumer_wait()) {
+                break;
+            }
+            continue;
+        }
+        session.heard_tick = current_reactor->heartbeat_tick;
+        if (ring.take_producer_waiting()) {
+            ring.wake_producer();
+        }
+        std::vector<std::string_view> streams; // Un cliente no puede mandar frames STREAM
+        receive_bytes(session, std::string_view(chunk.data(), size), streams);
+        if (!streams.empty()) {
+            std::cerr << "Stream frame from a local client on socket " << session.sock << ", closing connection." << std::endl;
+            request_close(session);
+        }
+    }
+    // El aviso también llega cuando el cliente hizo lugar en el anillo de salida
+    if (session.want_write && !session.detached) {
+        flush_session(session);
+    }
+}
+
+/**
+ * Lee lo que llegó a la conexión y encola cada solicitud completa en la cadena de la sesión; los
+ * handlers corren en el pool, así una solicitud cara no frena las lecturas del reactor.
+ */
+void read_session(Session &session) {
+    thread_local std::string chunk(FRAME_HEADER_SIZE + BUFFER_SIZE, '\0');
+    if (session.shm) {
+        read_shared_memory(session, chunk);
+        return;
+    }
+    ssize_t bytesRead = receive_chunk(session, &chunk[0], chunk.size());
+    if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+        return;
+    }
+    if (bytesRead <= 0) {
+        if (bytesRead < 0) {
+            perror("recv failed");
+        } else {
+            std::cerr << "Connection closed by peer." << std::endl;
+        }
+        request_close(session);
+        return;
+    }
+    session.heard_tick = current_reactor->heartbeat_tick;
+
+    // Los frames STREAM apuntan a chunk o a receive_buffer, que no cambian hasta la próxima lectura
+    std::vector<std::string_view> streams;
+    bool buffered = !session.receive_buffer.empty();
+    std::string_view data(chunk.data(), bytesRead);
+    if (buffered) {
+        session.receive_buffer.append(data);
+        data = session.receive_buffer;
+    }
+    size_t consumed = receive_frames(session, data, streams);
+    for (std::string_view payload : streams) {
+        handle_stream_frame(session, payload);
+    }
+    if (buffered) {
+        session.receive_buffer.erase(0, consumed);
+    } else {
+        session.receive_buffer.assign(data.substr(consumed));
+    }
+}
+
+/**
+ * Salida de una conexión del gateway: pasa al enlace en frames STREAM. Los frames compartidos entre
+ * destinatarios no se copian, solo se les antepone el encabezado.
+ */
+void flush_stream(Session &session) {
+    Session &link = *session.gateway;
+    for (const OutboundPiece &piece : session.outbox) {
+        const char *data = piece.owner ? piece.data : session.write_buffer.data() + session.write_buffer_sent;
+        for (size_t offset = 0; offset < piece.size && !link.broken; offset += BUFFER_SIZE) {
+            size_t size = std::min(piece.size - offset, BUFFER_SIZE);
+            append_stream_header(link.write_buffer, session.stream, StreamKind::DATA, size);
+            push_output(link, {nullptr, nullptr, FRAME_HEADER_SIZE + STREAM_HEADER_SIZE});
+            if (piece.owner) {
+                push_output(link, {piece.owner, data + offset, size});
+            } else {
+                link.write_buffer.append(data + offset, size);
+                push_output(link, {nullptr, nullptr, size});
+            }
+        }
+        if (!piece.owner) {
+            session.write_buffer_sent += piece.size;
+        }
+    }
+    session.outbox.clear();
+    session.write_buffer.clear();
+    session.write_buffer_sent = 0;
+    session.pending_output = 0;
+}
+
+/**
+ * Salida de un cliente por memoria compartida: se copia al anillo y se despierta al cliente solo si
+ * duerme. Con el anillo lleno queda pendiente hasta que el cliente avise por el socket que leyó.
+ */
+void flush_shared_memory(Session &session) {
+    ShmRing &ring = session.shm->to_client;
+    bool written_any = false;
+    while (!session.outbox.empty() && !output_frozen) {
+        OutboundPiece &piece = session.outbox.front();
+        const char *data = piece.owner ? piece.data + session.piece_sent : session.write_buffer.data() + session.write_buffer_sent;
+        size_t written = ring.write(data, piece.size - session.piece_sent);
+        if (written == 0) {
+            if (ring.prepare_producer_wait()) {
+                break;
+            }
+            continue;
+        }
+        written_any = true;
+        session.pending_output -= written;
+        session.piece_sent += written;
+        if (!piece.owner) {
+            session.write_buffer_sent += written;
+        }
+        if (session.piece_sent == piece.size) {
+            session.outbox.pop_front();
+            session.piece_sent = 0;
+        }
+    }
+    if (session.write_buffer_sent == session.write_buffer.size()) {
+        session.write_buffer.clear();
+        session.write_buffer_sent = 0;
+    }
+    if (written_any && ring.take_consumer_waiting()) {
+        ring.wake_consumer();
+    }
+    bool want_write = !session.outbox.empty();
+    if (want_write != session.want_write) {
+        session.want_write = want_write;
+        update_session_events(session);
+    }
+}
+
+/**
+ * Escribe la salida pendiente de la sesión con writev, juntando varios frames por llamada. Si el socket
+ * se llena, la sesión queda registrada con EPOLLOUT hasta vaciarse.
+ */
+void flush_session(Session &session) {
+    if (session.gateway != nullptr) {
+        flush_stream(session);
+        return;
+    }
+    if (session.shm) {
+        flush_shared_memory(session);
+        return;
+    }
+    while (!session.outbox.empty() && !output_frozen) {
+        struct iovec parts[MAX_WRITE_PARTS];
+        int count = 0;
+        size_t owned = session.write_buffer_sent;
+        for (auto it = session.outbox.begin(); it != session.outbox.end() && count < MAX_WRITE_PARTS; ++it) {
+            size_t skip = count == 0 ? session.piece_sent : 0;
+            const char *data = it->owner ? it->data + skip : session.write_buffer.data() + owned;
+            if (!it->owner) {
+                owned += it->size - skip;
+            }
+            parts[count++] = {const_cast<char *>(data), it->size - skip};
+        }
+
+        struct msghdr header = {};
+        header.msg_iov = parts;
+        header.msg_iovlen = count;
+        ssize_t written = sendmsg(session.sock, &header, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            perror("send failed");
+            break_session(session);
+            break;
+        }
+
+        session.pending_output -= written;
+        size_t remaining = written;
+        while (remaining > 0) {
+            OutboundPiece &piece = session.outbox.front();
+            size_t take = std::min(remaining, piece.size - session.piece_sent);
+            session.piece_sent += take;
+            if (!piece.owner) {
+                session.write_buffer_sent += take;
+            }
+            remaining -= take;
+            if (session.piece_sent == piece.size) {
+                session.outbox.pop_front();
+                session.piece_sent = 0;
+            }
+        }
+        if (session.write_buffer_sent == session.write_buffer.size()) {
+            session.write_buffer.clear();
+            session.write_buffer_sent = 0;
+        }
+    }
+
+    bool want_write = !session.outbox.empty();
+    if (want_write != session.want_write) {
+        session.want_write = want_write;
+        update_session_events(session);
+    }
+}
+
+// Escribe las sesiones que recibieron salida durante la vuelta de epoll
+void flush_dirty(Reactor &reactor) {
+    // Por índice: la salida de una conexión del gateway marca a su enlace mientras se recorre la lista
+    for (size_t i = 0; i < reactor.dirty.size(); i++) {
+        Session *session = reactor.dirty[i];
+        session->dirty = false;
+        if (!session->want_write) {
+            flush_session(*session);
+        }
+    }
+    reactor.dirty.clear();
+}
+
+// Deja de vigilar o vuelve a vigilar el socket de escucha; mientras tanto las conexiones esperan en el backlog
+void set_accepting(Reactor &reactor, bool accepting) {
+    epoll_event event = {};
+    if (accepting) {
+        event.events = EPOLLIN;
+    }
+    event.data.ptr = &reactor.listen_fd;
+    if (epoll_ctl(reactor.epoll_fd, EPOLL_CTL_MOD, reactor.listen_fd, &event) < 0) {
+        perror("epoll_ctl failed");
+        return;
+    }
+    if (local_listen_fd >= 0) {
+        // EPOLLEXCLUSIVE no admite EPOLL_CTL_MOD: el socket local se saca y se vuelve a agregar
+        event.events = EPOLLIN | EPOLLEXCLUSIVE;
+        event.data.ptr = &local_listen_fd;
+        if (epoll_ctl(reactor.epoll_fd, accepting ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, local_listen_fd, &event) < 0) {
+            perror("epoll_ctl failed");
+        }
+    }
+    reactor.accepting = accepting;
+    std::cerr << (accepting ? "Resuming" : "Pausing") << " accept on reactor listener " << reactor.listen_fd
+              << " (" << open_connections << " connections, " << pending_registrations << " pending registrations)" << std::endl;
+}
+
+/**
+ * Con el servidor lleno la conexión recibe una respuesta clara en lugar de quedar colgada. Cerrar con
+ * bytes del cliente sin leer manda un RST que puede descartar la respuesta antes de que la lea: primero
+ * se cierra la escritura y se descarta lo que ya llegó, sin esperar más para no frenar al reactor.
+ */
+void reject_connection(int client_sock) {
+    chat::Response response;
+    response.set_operation(chat::Operation::REGISTER_USER);
+    response.set_message("Server is full, try again later.");
+    response.set_status_code(chat::StatusCode::SERVICE_UNAVAILABLE);
+    send_response(client_sock, response);
+    shutdown(client_sock, SHUT_WR);
+    char discard[BUFFER_SIZE];
+    if (recv(client_sock, discard, sizeof(discard), MSG_DONTWAIT) < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        perror("Reject drain failed");
+    }
+    close(client_sock);
+}
+
+// Clave de un cliente local para los límites por IP: el uid del proceso que se conectó
+std::string local_peer(int client_sock) {
+    struct ucred credentials = {};
+    socklen_t size = sizeof(credentials);
+    if (getsockopt(client_sock, SOL_SOCKET, SO_PEERCRED, &credentials, &size) < 0) {
+        return "local";
+    }
+    return "local:" + std::to_string(credentials.uid);
+}
+
+// Acepta todas las conexiones pendientes de un socket de escucha: el del reactor o el local
+void accept_connections(Reactor &reactor, int listen_fd) {
+    while (running) {
+        if (admission_paused()) {
+            set_accepting(reactor, false);
+            return;
+        }
+        struct sockaddr_storage address;
+        socklen_t address_size = sizeof(address);
+        int client_sock = accept4(listen_fd, (struct sockaddr *)&address, &address_size, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_sock < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("Accept failed");
+            }
+            return;
+        }
+        if (client_sock >= stream_sock_base || open_connections >= MAX_CONNECTIONS) {
+            std::cerr << "Server is full, rejecting connection." << std::endl;
+            reject_connection(client_sock);
+            continue;
+        }
+
+        open_connections++;
+        pending_registrations++;
+        bool local = address.ss_family == AF_UNIX;
+        Session &session = acquire_session(client_sock, reactor, local ? local_peer(client_sock) : inet_ntoa(reinterpret_cast<sockaddr_in *>(&address)->sin_addr));
+        session.local = local;
+        session.awaiting_registration = true;
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.ptr = &session;
+        if (epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, client_sock, &event) < 0) {
+            perror("epoll_ctl failed");
+            close_session(session);
+        }
+    }
+}
+
+// Vuelve a leer la conexión. Un cliente por memoria compartida no avisa hasta que el servidor marque que duerme: se lee su anillo ya
+void resume_reading(Session &session) {
+    session.reading = !draining;
+    update_session_events(session);
+    if (session.shm && session.reading) {
+        read_session(session);
+    }
+}
+
+// El cliente ya espera la respuesta en los anillos: lo que quedaba para el socket (a lo sumo un PING) se descarta
+void attach_shared_memory(Session &session) {
+    flush_session(session);
+    session.outbox.clear();
+    session.write_buffer.clear();
+    session.write_buffer_sent = 0;
+    session.piece_sent = 0;
+    session.pending_output = 0;
+    session.want_write = false;
+    session.shm = std::move(session.shm_pending);
+    resume_reading(session);
+}
+
+// Pasa a la salida de cada conexión los frames que otros hilos dejaron en el buzón del reactor
+void pop_deliveries(Reactor &reactor) {
+    Delivery delivery;
+    while (reactor.deliveries.pop(delivery)) {
+        Session &session = *delivery.session;
+        if (session.generation != delivery.generation) {
+            continue;
+        }
+        if (delivery.control == SessionControl::CLOSE) {
+            close_session(session);
+        } else if (delivery.control == SessionControl::DISCONNECT) {
+            request_close(session);
+        } else if (delivery.control == SessionControl::RESUME_READING) {
+            resume_reading(session);
+        } else if (delivery.control == SessionControl::ATTACH_SHARED_MEMORY) {
+            attach_shared_memory(session);
+        } else if (delivery.message) {
+            push_incoming_message(session, delivery.message);
+        } else {
+            const std::string &frame = *delivery.frame;
+            push_output(session, {std::move(delivery.frame), frame.data(), frame.size()});
+        }
+    }
+}
+
+void drain_deliveries(Reactor &reactor) {
+    uint64_t wakeups;
+    if (read(reactor.wake_fd, &wakeups, sizeof(wakeups)) < 0 && errno != EAGAIN) {
+        perror("wake read failed");
+    }
+    // Se baja antes de vaciar el buzón: un push posterior vuelve a escribir en wake_fd
+    reactor.wake_pending = false;
+    pop_deliveries(reactor);
+}
+
+// Sesiones abiertas que atiende el reactor. Toma clients_mutex para recorrer el pool.
+std::vector<Session *> reactor_sessions(Reactor &reactor) {
+    std::vector<Session *> owned;
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    for (Session &session : session_pool) {
+        if (session.sock >= 0 && session.reactor == &reactor) {
+            owned.push_back(&session);
+        }
+    }
+    return owned;
+}
+
+/**
+ * Heartbeats: a cada conexión de la que no llegó nada durante el último intervalo le manda un PING, y
+ * cierra las que siguen calladas después de HEARTBEAT_MISSED_LIMIT intervalos (peers caídos o conexiones
+ * medio abiertas). Las que no se están leyendo cuentan como vivas, su silencio no es del cliente.
+ * También cierra las que no registraron un usuario en REGISTRATION_TIMEOUT_MS, aunque respondan los PING:
+ * ocupan lugar en pending_registrations, que al llenarse frena accept para todos.
+ */
+void check_heartbeats(Reactor &reactor) {
+    uint64_t expirations;
+    if (read(reactor.heartbeat_fd, &expirations, sizeof(expirations)) < 0) {
+        return;
+    }
+    reactor.heartbeat_tick += expirations;
+    if (draining) {
+        return;
+    }
+    std::vector<Session *> sessions = reactor_sessions(reactor);
+    std::vector<Session *> unregistered;
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        for (Session *session : sessions) {
+            if (session->awaiting_registration &&
+                reactor.heartbeat_tick - session->accepted_tick >= static_cast<uint64_t>(REGISTRATION_TIMEOUT_MS / HEARTBEAT_INTERVAL_MS)) {
+                unregistered.push_back(session);
+            }
+        }
+    }
+    for (Session *session : unregistered) {
+        std::cerr << "Client on socket " << session->sock << " did not register in time, closing connection." << std::endl;
+        request_close(*session);
+    }
+    for (Session *session : sessions) {
+        if (!session->reading || session->detached || session->broken) {
+            session->heard_tick = reactor.heartbeat_tick;
+            continue;
+        }
+        uint64_t silent = reactor.heartbeat_tick - session->heard_tick;
+        if (silent >= HEARTBEAT_MISSED_LIMIT) {
+            std::cerr << "Client on socket " << session->sock << " missed " << silent << " heartbeats, closing connection." << std::endl;
+            request_close(*session);
+        } else if (silent > 0) {
+            push_control_frame(*session, PING_FRAME);
+        }
+    }
+}
+
+/**
+ * Al drenar, el reactor deja de leer sus conexiones (y vuelve a leerlas si el drenado se cancela) y
+ * avisa en quiet_round cuándo ya escribió todo lo que le encolaron antes de la vuelta pedida.
+ */
+void update_drain_state(Reactor &reactor) {
+    // Se publica al final de una vuelta: las escrituras que empezaron antes de ver output_frozen ya terminaron
+    reactor.frozen = output_frozen.load();
+    bool stop = draining;
+    if (stop != reactor.reading_stopped) {
+        for (Session *session : reactor_sessions(reactor)) {
+            if (stop) {
+                session->reading = false;
+                update_session_events(*session);
+            } else {
+                resume_reading(*session);
+            }
+        }
+        reactor.reading_stopped = stop;
+    }
+    if (!stop) {
+        return;
+    }
+    uint64_t round = drain_round;
+    pop_deliveries(reactor);
+    flush_dirty(reactor);
+    for (Session *session : reactor_sessions(reactor)) {
+        if (!session->outbox.empty() && !session->broken) {
+            return;
+        }
+    }
+    reactor.quiet_round = round;
+}
+
+void run_reactor(Reactor &reactor) {
+    current_reactor = &reactor;
+    epoll_event events[MAX_EPOLL_EVENTS];
+    while (running) {
+        int count = epoll_wait(reactor.epoll_fd, events, MAX_EPOLL_EVENTS, reactor.accepting ? -1 : ACCEPT_RETRY_MS);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("epoll_wait failed");
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            void *source = events[i].data.ptr;
+            if (source == &reactor.listen_fd) {
+                accept_connections(reactor, reactor.listen_fd);
+            } else if (source == &local_listen_fd) {
+                accept_connections(reactor, local_listen_fd);
+            } else if (source == &reactor.wake_fd) {
+                drain_deliveries(reactor);
+            } else if (source == &reactor.heartbeat_fd) {
+                check_heartbeats(reactor);
+            } else {
+                Session &session = *static_cast<Session *>(source);
+                if (output_frozen) {
+                    // El socket ya es del proceso nuevo, que lee lo que llegue; si el cliente colgó, se suelta el descriptor
+                    if (events[i].events & (EPOLLHUP | EPOLLERR)) {
+                        request_close(session);
+                    }
+                    continue;
+                }
+                if (events[i].events & EPOLLOUT) {
+                    flush_session(session);
+                }
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    read_session(session);
+                }
+            }
+        }
+        // Las respuestas y entregas de toda la vuelta salen juntas, un writev por conexión
+        flush_dirty(reactor);
+        if (draining || reactor.reading_stopped) {
+            update_drain_state(reactor);
+        }
+        if (!reactor.accepting && !admission_paused()) {
+            set_accepting(reactor, true);
+        }
+    }
+}
+
+// Socket de escucha propio (SO_REUSEPORT: el kernel reparte las conexiones entre reactores), -1 si falla
+int open_listener(int port) {
+    int listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd < 0) {
+        perror("Socket creation failed");
+        return -1;
+    }
+
+    int opt = 1;
+    if (setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt)) ||
+        setsockopt(listen_fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt))) {
+        perror("setsockopt failed");
+        close(listen_fd);
+        return -1;
+    }
+
+    struct sockaddr_in address;
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = INADDR_ANY;
+    address.sin_port = htons(port);
+
+    if (bind(listen_fd, (struct sockaddr *)&address, sizeof(address)) < 0) {
+        perror("Bind failed");
+        close(listen_fd);
+        return -1;
+    }
+
+    if (listen(listen_fd, LISTEN_BACKLOG) < 0) {
+        perror("Listen failed");
+        close(listen_fd);
+        return -1;
+    }
+    return listen_fd;
+}
+
+// Epoll, eventfd y timerfd de heartbeats del reactor sobre un socket de escucha propio o recibido en una actualización
+bool setup_reactor(Reactor &reactor, int listen_fd) {
+    reactor.listen_fd = listen_fd;
+    reactor.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    reactor.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    reactor.heartbeat_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (reactor.epoll_fd < 0 || reactor.wake_fd < 0 || reactor.heartbeat_fd < 0) {
+        perror("epoll setup failed");
+        return false;
+    }
+    struct itimerspec interval = {};
+    interval.it_interval.tv_sec = HEARTBEAT_INTERVAL_MS / 1000;
+    interval.it_interval.tv_nsec = (HEARTBEAT_INTERVAL_MS % 1000) * 1000000L;
+    interval.it_value = interval.it_interval;
+    timerfd_settime(reactor.heartbeat_fd, 0, &interval, nullptr);
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = &reactor.listen_fd;
+    epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, reactor.listen_fd, &event);
+    event.data.ptr = &reactor.wake_fd;
+    epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, reactor.wake_fd, &event);
+    event.data.ptr = &reactor.heartbeat_fd;
+    epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, reactor.heartbeat_fd, &event);
+    return true;
+}
+
+void wake_reactors() {
+    uint64_t one = 1;
+    for (auto &reactor : reactors) {
+        if (write(reactor->wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+            perror("wake failed");
+        }
+    }
+}
+
+// Espera hasta que se cumpla la condición o venza el plazo del drenado
+template <typename Condition>
+bool wait_until(std::chrono::steady_clock::time_point deadline, Condition condition) {
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+// Ninguna sesión abierta tiene solicitudes encoladas o en curso en el pool
+bool chains_idle() {
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    for (Session &session : session_pool) {
+        if (session.sock < 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> inbox_lock(session.inbox_mutex);
+        if (session.scheduled) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Deja de aceptar y de leer conexiones y espera a que las cadenas atiendan lo que ya había llegado
+bool stop_serving(std::chrono::steady_clock::time_point deadline) {
+    draining = true;
+    wake_reactors();
+    return wait_until(deadline, [] {
+        for (auto &reactor : reactors) {
+            if (!reactor->reading_stopped) {
+                return false;
+            }
+        }
+        return chains_idle();
+    });
+}
+
+// Espera a que los reactores escriban todo lo que se les encoló hasta ahora
+bool wait_flushed(std::chrono::steady_clock::time_point deadline) {
+    uint64_t round = ++drain_round;
+    wake_reactors();
+    return wait_until(deadline, [round] {
+        for (auto &reactor : reactors) {
+            if (reactor->quiet_round < round) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+// Vuelve a aceptar y leer conexiones si la actualización no se completó
+void resume_serving() {
+    output_frozen = false;
+    draining = false;
+    wake_reactors();
+}
+
+std::vector<int> open_sockets() {
+    std::vector<int> sockets;
+    std::lock_guard<std::mutex> lock(clients_mutex);
+    for (Session &session : session_pool) {
+        if (session.sock >= 0) {
+            sockets.push_back(session.sock);
+        }
+    }
+    return sockets;
+}
+
+std::string upgrade_path; // Socket de control de este proceso, se borra al apagarse
+int upgrade_fd = -1;      // Socket de control; se cierra antes de salir tras una actualización, así el proceso nuevo liga la ruta
+
 /**
- * Función para manejar la conexión de un cliente
+ * Apagado ordenado: deja de aceptar y de leer, atiende las solicitudes que ya llegaron, avisa a cada
+ * cliente cuándo reconectarse y espera (hasta DRAIN_TIMEOUT_MS) a que todo eso se escriba.
  */
-void handle_client(int client_sock) {
-    bool running = true; 
-    while (running) {
-        chat::Request request;
-        if (!receive_request(client_sock, request)) { // Función para recibir una solicitud
-            std::cerr << "Failed to read message from client. Closing connection." << std::endl;
-            break;
+void graceful_shutdown() {
+    static std::atomic<bool> started{false};
+    if (started.exchange(true)) {
+        return;
+    }
+    std::cout << "Draining connections before shutting down..." << std::endl;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(DRAIN_TIMEOUT_MS);
+    bool drained = stop_serving(deadline);
+
+    chat::Response notice;
+    notice.set_operation(chat::Operation::SERVER_SHUTDOWN);
+    notice.set_status_code(chat::StatusCode::OK);
+    notice.set_message("Server is shutting down, reconnect in " + std::to_string(RECONNECT_HINT_MS) + " ms.");
+    notice.mutable_server_shutdown()->set_reconnect_after_ms(RECONNECT_HINT_MS);
+    for (int client_sock : open_sockets()) {
+        send_to(client_sock, notice);
+    }
+    if (!drained || !wait_flushed(deadline)) {
+        std::cerr << "Drain timed out, closing the remaining connections." << std::endl;
+    }
+
+    running = false;
+    close_listeners();
+    unlink(upgrade_path.c_str());
+    unlink(local_path.c_str());
+    std::cout << "Server terminated." << std::endl;
+    // _exit: los reactores siguen corriendo y los destructores globales no deben tocar su estado
+    _exit(0);
+}
+
+/**
+ * Socket Unix de escucha en path. Una ruta que ya existe solo se borra si nadie responde en ella: un
+ * segundo servidor en el mismo puerto no le quita el socket al que está corriendo. -1 si falla.
+ */
+int open_unix_listener(const std::string &path, int flags, int backlog) {
+    if (path.empty()) {
+        return -1;
+    }
+    struct sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    bool live = probe >= 0 && connect(probe, (struct sockaddr *)&address, sizeof(address)) == 0;
+    if (probe >= 0) {
+        close(probe);
+    }
+    if (live) {
+        std::cerr << "Another server is listening on " << path << "." << std::endl;
+        return -1;
+    }
+    unlink(path.c_str());
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | flags, 0);
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(listen_fd, backlog) < 0) {
+        perror("Unix socket setup failed");
+        if (listen_fd >= 0) {
+            close(listen_fd);
         }
+        return -1;
+    }
+    return listen_fd;
+}
 
-         {
-            std::lock_guard<std::mutex> lock(clients_mutex);
-            if (client_sessions.count(client_sock)) {
-                last_active[client_sessions[client_sock]] = std::chrono::steady_clock::now();
+// Descriptor como SCM_RIGHTS, acompañado de un byte porque sendmsg necesita datos
+bool send_descriptor(int conn, int fd) {
+    char byte = 0;
+    struct iovec part = {&byte, 1};
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    struct msghdr header = {};
+    header.msg_iov = &part;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+    struct cmsghdr *message = CMSG_FIRSTHDR(&header);
+    message->cmsg_level = SOL_SOCKET;
+    message->cmsg_type = SCM_RIGHTS;
+    message->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(message), &fd, sizeof(int));
+    return sendmsg(conn, &header, MSG_NOSIGNAL) == 1;
+}
+
+int receive_descriptor(int conn) {
+    char byte;
+    struct iovec part = {&byte, 1};
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    struct msghdr header = {};
+    header.msg_iov = &part;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+    if (recvmsg(conn, &header, MSG_CMSG_CLOEXEC) != 1) {
+        return -1;
+    }
+    struct cmsghdr *message = CMSG_FIRSTHDR(&header);
+    if (message == nullptr || message->cmsg_level != SOL_SOCKET || message->cmsg_type != SCM_RIGHTS) {
+        return -1;
+    }
+    int fd;
+    memcpy(&fd, CMSG_DATA(message), sizeof(int));
+    return fd;
+}
+
+/**
+ * Actualización en caliente, lado del proceso que sale: deja de servir, vacía las salidas y pasa los
+ * sockets de escucha y de cada conexión, con el estado de su sesión, al proceso nuevo. Las
+ * transferencias en curso se cancelan y los reintentos del modo ack pendientes no se pasan.
+ */
+void hand_over(int conn) {
+    std::cout << "Handing connections over to a new server process..." << std::endl;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(DRAIN_TIMEOUT_MS);
+    // Un proceso nuevo colgado no deja al servidor congelado: cada envío o espera de respuesta tiene plazo
+    struct timeval timeout = {DRAIN_TIMEOUT_MS / 1000, (DRAIN_TIMEOUT_MS % 1000) * 1000};
+    if (setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) < 0 ||
+        setsockopt(conn, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) < 0) {
+        perror("Upgrade socket timeout failed");
+        return;
+    }
+    if (!stop_serving(deadline)) {
+        std::cerr << "Upgrade aborted: requests still in progress." << std::endl;
+        resume_serving();
+        return;
+    }
+    for (int client_sock : open_sockets()) {
+        forget_transfers(client_sock);
+    }
+    if (!wait_flushed(deadline)) {
+        std::cerr << "Upgrade aborted: outbound queues did not drain." << std::endl;
+        resume_serving();
+        return;
+    }
+    for (auto &reactor : reactors) {
+        reactor->frozen = false;
+    }
+    output_frozen = true;
+    wake_reactors();
+    bool frozen = wait_until(deadline, [] {
+        for (auto &reactor : reactors) {
+            if (!reactor->frozen) {
+                return false;
             }
         }
+        return true;
+    });
+    if (!frozen) {
+        std::cerr << "Upgrade aborted: reactors did not stop writing." << std::endl;
+        resume_serving();
+        return;
+    }
 
-        switch (request.operation()) {
-            case chat::Operation::REGISTER_USER:
-                if (!handle_registration(request, client_sock)) {
-                    std::cerr << "Registration failed for client." << std::endl;
+    struct HandedSession {
+        chat::UpgradeRecord record;
+        int sock;
+        std::string pending_input;
+        int shm_fd; // memfd de los anillos de un cliente local, -1 si usa el socket
+    };
+    std::vector<HandedSession> handed;
+    uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        std::lock_guard<std::mutex> channels_lock(channels_mutex);
+        version = registry_version;
+        for (Session &session : session_pool) {
+            // Las conexiones de un gateway no tienen descriptor que pasar: al cerrarse el enlace el gateway reconecta
+            if (session.sock < 0 || session.gateway != nullptr || session.gateway_link) {
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> inbox_lock(session.inbox_mutex);
+                if (session.closing) {
+                    continue;
                 }
-                break;
-            case chat::Operation::SEND_MESSAGE:
-                 handle_send_message(request, client_sock, chat::Operation::SEND_MESSAGE);
-                break;
-            case chat::Operation::UPDATE_STATUS:
-                 update_status(request, client_sock, chat::Operation::UPDATE_STATUS);
-                break;
-            case chat::Operation::GET_USERS:
-                 handle_get_users(request, client_sock, chat::Operation::GET_USERS);
-                 break;
-            case chat::Operation::UNREGISTER_USER:
-                unregister_user(client_sock);
-                 break;
-            default:
-                chat::Response response;
-                response.set_message("request type DESCONOCIDO.");
-                response.set_status_code(chat::StatusCode::BAD_REQUEST);
-                send_response(client_sock, response);
-                break;
+            }
+            HandedSession entry{{}, session.sock, session.receive_buffer, session.shm ? session.shm->fd : -1};
+            auto *state = entry.record.mutable_session();
+            if (session.user != NO_USER) {
+                state->set_username(users.names[session.user]);
+                state->set_status(users.statuses[session.user]);
+                state->set_ack_mode(users.ack_mode[session.user]);
+            }
+            state->set_codec(socket_codec(session.sock));
+            state->set_presence(presence_subscribers.count(session.sock) > 0);
+            for (const auto &channel : session.channels) {
+                state->add_channels(channel);
+            }
+            state->set_pending_input(session.receive_buffer.size());
+            state->set_ip(session.ip);
+            if (!session.peer_node.empty()) {
+                state->set_peer_node(session.peer_node);
+            }
+            state->set_shared_memory(entry.shm_fd >= 0);
+            handed.push_back(std::move(entry));
         }
     }
 
-    // Cerrar la conexión y limpiar los datos de sesión
-    close(client_sock);
+    bool sent = true;
+    chat::UpgradeRecord listener;
+    listener.set_listener(true);
+    for (auto &reactor : reactors) {
+        sent = sent && send_response(conn, listener) && send_descriptor(conn, reactor->listen_fd);
+    }
+    for (const auto &entry : handed) {
+        sent = sent && send_response(conn, entry.record) && send_descriptor(conn, entry.sock) &&
+               (entry.shm_fd < 0 || send_descriptor(conn, entry.shm_fd)) &&
+               (entry.pending_input.empty() || send_frame(conn, entry.pending_input));
+    }
+    chat::UpgradeRecord done;
+    done.mutable_done()->set_registry_version(version);
+    done.mutable_done()->set_incarnation(incarnation);
+    chat::UpgradeRecord reply;
+    if (!sent || !send_response(conn, done) || !receive_request(conn, reply) || !reply.has_done()) {
+        std::cerr << "Upgrade aborted: the new process did not take over." << std::endl;
+        resume_serving();
+        return;
+    }
+
+    // El socket de control se cierra antes que conn: cuando el proceso nuevo ve el EOF, la ruta ya está libre
+    close(upgrade_fd);
+    std::cout << "Upgrade complete, " << handed.size() << " connections handed over. Exiting." << std::endl;
+    _exit(0);
+}
+
+/**
+ * Socket de control donde un proceso iniciado con --upgrade pide las conexiones de este. Solo las
+ * entrega a un proceso del mismo usuario que las pide con un registro request: una conexión que solo
+ * prueba si el socket está vivo no frena al servidor.
+ */
+void serve_upgrades() {
+    while (true) {
+        int conn = accept4(upgrade_fd, NULL, NULL, SOCK_CLOEXEC);
+        if (conn < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("Upgrade accept failed");
+            return;
+        }
+        struct ucred peer = {};
+        socklen_t peer_size = sizeof(peer);
+        struct timeval timeout = {DRAIN_TIMEOUT_MS / 1000, (DRAIN_TIMEOUT_MS % 1000) * 1000};
+        chat::UpgradeRecord record;
+        if (getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &peer, &peer_size) < 0 || peer.uid != getuid()) {
+            std::cerr << "Upgrade refused: the new process belongs to another user." << std::endl;
+        } else if (setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0 &&
+                   receive_request(conn, record) && record.has_request()) {
+            hand_over(conn);
+        }
+        close(conn);
+    }
+}
+
+// Recrea una sesión recibida en la actualización sobre uno de los reactores
+void restore_session(const chat::UpgradeSession &state, int client_sock, std::string pending_input, std::unique_ptr<ShmChannel> shm, Reactor &reactor) {
+    Session &session = acquire_session(client_sock, reactor, state.ip());
+    open_connections++;
+    session.receive_buffer = std::move(pending_input);
+    int domain = AF_INET;
+    socklen_t domain_size = sizeof(domain);
+    getsockopt(client_sock, SOL_SOCKET, SO_DOMAIN, &domain, &domain_size);
+    session.local = domain == AF_UNIX;
+    session.shm_opened = shm != nullptr;
+    session.shm = std::move(shm);
+    set_socket_codec(client_sock, state.codec());
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        if (!state.peer_node().empty()) {
+            session.peer_node = state.peer_node();
+            peer_sockets[state.peer_node()] = client_sock;
+        } else if (state.username().empty()) {
+            session.awaiting_registration = true;
+            pending_registrations++;
+        } else {
+            UserId id = add_user(state.username(), state.ip(), client_sock, state.ack_mode());
+            set_user_status(id, state.status());
+            store_presence(node_name, state.username(), state.status(), registry_version, false);
+        }
+        if (state.presence()) {
+            presence_subscribers.insert(client_sock);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex);
+        for (const auto &name : state.channels()) {
+            add_channel_member(channels[name], client_sock);
+            session.channels.push_back(name);
+        }
+    }
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = &session;
+    if (epoll_ctl(reactor.epoll_fd, EPOLL_CTL_ADD, client_sock, &event) < 0) {
+        perror("epoll_ctl failed");
+    }
+    if (session.shm) {
+        // El cliente pudo escribir en el anillo sin avisar mientras el proceso anterior drenaba
+        post_control(session, SessionControl::RESUME_READING);
+    }
+}
+
+/**
+ * Actualización en caliente, lado del proceso nuevo: recibe los sockets de escucha (uno por reactor)
+ * y las conexiones con su estado. Solo responde done cuando ya es dueño de todo; si algo falla
+ * termina sin tocar los sockets y el proceso anterior sigue sirviendo.
+ */
+bool take_over(int port) {
+    std::string path = private_socket_path(UPGRADE_SOCKET_FORMAT, port, false);
+    int conn = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    struct sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    if (path.empty() || conn < 0 || connect(conn, (struct sockaddr *)&address, sizeof(address)) < 0) {
+        perror("No running server to upgrade from");
+        return false;
+    }
+    chat::UpgradeRecord request;
+    request.set_request(true);
+    if (!send_response(conn, request)) {
+        std::cerr << "Upgrade failed: could not reach the running server." << std::endl;
+        return false;
+    }
+
+    struct ReceivedSession {
+        chat::UpgradeSession state;
+        int sock;
+        std::string pending_input;
+        std::unique_ptr<ShmChannel> shm;
+    };
+    std::vector<ReceivedSession> received;
+    chat::UpgradeRecord record;
+    while (receive_request(conn, record) && !record.has_done()) {
+        int fd = receive_descriptor(conn);
+        if (fd < 0) {
+            std::cerr << "Upgrade failed: missing descriptor." << std::endl;
+            return false;
+        }
+        if (record.has_listener()) {
+            reactors.push_back(std::make_unique<Reactor>());
+            if (!setup_reactor(*reactors.back(), fd)) {
+                return false;
+            }
+            continue;
+        }
+        std::unique_ptr<ShmChannel> shm;
+        if (record.session().shared_memory()) {
+            int memfd = receive_descriptor(conn);
+            shm = memfd >= 0 ? map_shm_channel(memfd) : nullptr;
+            if (!shm) {
+                std::cerr << "Upgrade failed: missing shared memory of a local client." << std::endl;
+                return false;
+            }
+        }
+        std::string pending_input(record.session().pending_input(), '\0');
+        if (!pending_input.empty() && recv(conn, &pending_input[0], pending_input.size(), MSG_WAITALL) != static_cast<ssize_t>(pending_input.size())) {
+            std::cerr << "Upgrade failed: incomplete session state." << std::endl;
+            return false;
+        }
+        received.push_back({record.session(), fd, std::move(pending_input), std::move(shm)});
+    }
+    if (!record.has_done() || reactors.empty()) {
+        std::cerr << "Upgrade failed: the running server did not hand over its state." << std::endl;
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        registry_version = record.done().registry_version();
+        incarnation = record.done().incarnation();
+    }
+    for (size_t i = 0; i < received.size(); i++) {
+        restore_session(received[i].state, received[i].sock, std::move(received[i].pending_input), std::move(received[i].shm), *reactors[i % reactors.size()]);
+    }
+    {
+        // Las lápidas no pasan al proceso nuevo: un par atrasado recibe la tabla completa en vez de cambios
+        std::lock_guard<std::mutex> lock(clients_mutex);
+        node_clocks[node_name] = {incarnation, registry_version, registry_version};
+    }
+    if (!send_response(conn, record)) {
+        std::cerr << "Upgrade failed: could not confirm the takeover." << std::endl;
+        return false;
+    }
+    // El proceso anterior cierra su socket de control y sale: con su EOF la ruta se puede volver a ligar
+    struct timeval timeout = {DRAIN_TIMEOUT_MS / 1000, (DRAIN_TIMEOUT_MS % 1000) * 1000};
+    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    char byte;
+    while (recv(conn, &byte, sizeof(byte), 0) > 0) {
+    }
+    close(conn);
+    std::cout << "Took over " << received.size() << " connections from the previous server." << std::endl;
+    return true;
+}
+
+/**
+ * Socket Unix para los clientes de la misma máquina. Lo vigilan todos los reactores y EPOLLEXCLUSIVE
+ * despierta a uno solo por conexión. Vive en el directorio privado del usuario, así que solo se
+ * conectan sus procesos. No pasa en una actualización: el proceso nuevo abre el suyo en la misma ruta,
+ * por eso no se prueba si el anterior sigue respondiendo.
+ */
+bool open_local_listener(int port) {
+    local_path = private_socket_path(LOCAL_SOCKET_FORMAT, port, true);
+    if (local_path.empty()) {
+        std::cerr << "Local socket setup failed: no private socket directory." << std::endl;
+        return false;
+    }
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    struct sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, local_path.c_str(), sizeof(address.sun_path) - 1);
+    unlink(local_path.c_str());
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(listen_fd, LISTEN_BACKLOG) < 0) {
+        perror("Local socket setup failed");
+        if (listen_fd >= 0) {
+            close(listen_fd);
+        }
+        return false;
+    }
+    local_listen_fd = listen_fd;
+    for (auto &reactor : reactors) {
+        epoll_event event = {};
+        event.events = EPOLLIN | EPOLLEXCLUSIVE;
+        event.data.ptr = &local_listen_fd;
+        epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, local_listen_fd, &event);
+    }
+    return true;
+}
+
+// Conecta con un nodo par dado como host:puerto, -1 si no está disponible
+int connect_peer(const std::string &address) {
+    size_t colon = address.rfind(':');
+    if (colon == std::string::npos) {
+        return -1;
+    }
+    struct addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *result;
+    if (getaddrinfo(address.substr(0, colon).c_str(), address.substr(colon + 1).c_str(), &hints, &result) != 0) {
+        return -1;
+    }
+    int sock = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (sock >= 0 && connect(sock, result->ai_addr, result->ai_addrlen) < 0) {
+        close(sock);
+        sock = -1;
+    }
+    freeaddrinfo(result);
+    return sock;
+}
+
+// Manda el lote en tantos PEER_BATCH como hagan falta para que cada uno entre en un frame
+bool send_peer_batch(int sock, chat::PeerBatch &batch) {
+    chat::Request request;
+    request.set_operation(chat::Operation::PEER_BATCH);
+    chat::PeerBatch &part = *request.mutable_peer_batch();
+    part.set_node(node_name);
+    part.set_snapshot(batch.snapshot());
+    part.set_secret(batch.secret());
+    size_t size = 0;
+    // Solo la primera parte de una foto reemplaza la tabla del nodo, las siguientes la completan
+    auto flush = [&]() {
+        bool sent = send_response(sock, request);
+        part.clear_presence();
+        part.clear_messages();
+        part.clear_digest();
+        part.set_snapshot(false);
+        part.clear_secret();
+        size = 0;
+        return sent;
+    };
+    for (auto &entry : *batch.mutable_presence()) {
+        size_t entry_size = entry.username().size() + entry.node().size() + 32;
+        if (size + entry_size > BUFFER_SIZE / 2 && !flush()) {
+            return false;
+        }
+        size += entry_size;
+        part.add_presence()->Swap(&entry);
+    }
+    for (auto &message : *batch.mutable_messages()) {
+        size_t message_size = message.content().size() + message.sender().size() + message.recipient().size() + 16;
+        if (size > 0 && size + message_size > BUFFER_SIZE / 2 && !flush()) {
+            return false;
+        }
+        size += message_size;
+        part.add_messages()->Swap(&message);
+    }
+    // El reloj y el digest van en la última parte, cuando el par ya tiene todos los cambios
+    for (auto &version : *batch.mutable_digest()) {
+        size_t version_size = version.node().size() + 32;
+        if (size + version_size > BUFFER_SIZE / 2 && !flush()) {
+            return false;
+        }
+        size += version_size;
+        part.add_digest()->Swap(&version);
+    }
+    if (batch.has_clock()) {
+        part.mutable_clock()->Swap(batch.mutable_clock());
+    }
+    return flush();
+}
+
+// Avisa al usuario que su sesión pasó a otro nodo y cierra la conexión. Requiere clients_mutex.
+void move_session(UserId id, const std::string &node) {
+    int client_sock = users.sockets[id];
+    Session *session = socket_session(client_sock);
+    if (session == nullptr) {
+        return;
+    }
+    chat::Response response;
+    response.set_operation(chat::Operation::SESSION_MOVED);
+    response.set_status_code(chat::StatusCode::OK);
+    response.set_message("Your session moved to node " + node + ", register again there.");
+    response.set_redirect(node_address(node));
+    send_to(client_sock, response);
+    post_control(*session, SessionControl::DISCONNECT);
+}
+
+/**
+ * Un nodo entra o sale del anillo. Al entrar solo cambian de dueño los usuarios de los rangos que
+ * ahora le tocan a él, y solo esas sesiones se mudan; al salir, los usuarios de este nodo se quedan.
+ */
+void update_ring(const std::string &node, bool joined) {
     std::lock_guard<std::mutex> lock(clients_mutex);
-    if (client_sessions.count(client_sock)) {
-        std::string username = client_sessions[client_sock];
-        user_details.erase(username);
-        client_sessions.erase(client_sock);
+    if (joined == ring.contains(node)) {
+        return;
+    }
+    if (joined) {
+        ring.add_node(node);
+    } else {
+        ring.remove_node(node);
+    }
+    size_t moved = 0;
+    for (UserId id = 0; joined && id < users.names.size(); id++) {
+        if (users.in_use[id] && ring.owner(users.names[id]) == node) {
+            move_session(id, node);
+            moved++;
+        }
+    }
+    std::cout << "Node " << node << (joined ? " joined" : " left") << " the ring, " << moved << " sessions moved." << std::endl;
+}
+
+// Atiende lo que llega por el enlace: los PING del nodo par y la respuesta con su nombre. False si se cortó.
+bool read_peer_link(PeerLink &link, int sock, std::string &input) {
+    char chunk[4096];
+    ssize_t bytesRead = recv(sock, chunk, sizeof(chunk), MSG_DONTWAIT);
+    if (bytesRead == 0 || (bytesRead < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+        return false;
+    }
+    if (bytesRead > 0) {
+        input.append(chunk, bytesRead);
+    }
+    size_t consumed = 0;
+    while (true) {
+        std::string_view payload;
+        size_t frame_size;
+        FrameStatus status = parse_frame(std::string_view(input).substr(consumed), payload, frame_size);
+        if (status == FrameStatus::INCOMPLETE) {
+            break;
+        }
+        if (status == FrameStatus::INVALID) {
+            return false;
+        }
+        consumed += frame_size;
+        if (status == FrameStatus::PING) {
+            struct iovec pong = {const_cast<char *>(PONG_FRAME), FRAME_HEADER_SIZE};
+            if (!send_frame_parts(sock, &pong, 1)) {
+                return false;
+            }
+        } else if (status == FrameStatus::READY) {
+            chat::Response response;
+            if (!response.ParseFromArray(payload.data(), payload.size())) {
+                return false;
+            }
+            if (response.operation() != chat::Operation::PEER_BATCH || response.status_code() != chat::StatusCode::OK) {
+                std::cerr << "Peer " << link.address << " refused the link: " << response.message() << std::endl;
+                return false;
+            }
+            if (response.has_gossip()) {
+                std::lock_guard<std::mutex> lock(clients_mutex);
+                apply_gossip(response.gossip());
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> lock(link.mutex);
+                if (link.named && link.node != response.message()) {
+                    std::cerr << "Peer " << link.address << " answered as node " << response.message() << ", expected " << link.node << "." << std::endl;
+                    return false;
+                }
+                if (link.node != response.message()) {
+                    link.node = response.message();
+                    std::cout << "Peer " << link.address << " is node " << link.node << "." << std::endl;
+                }
+                link.up = true;
+            }
+            update_ring(response.message(), true);
+        }
+    }
+    input.erase(0, consumed);
+    return true;
+}
+
+// El par sigue sin enlace: pasado el plazo de gracia sale del anillo (update_ring no hace nada si ya salió)
+void check_peer_down(PeerLink &link, std::chrono::steady_clock::time_point down_since) {
+    if (std::chrono::steady_clock::now() - down_since < std::chrono::milliseconds(NODE_DOWN_GRACE_MS)) {
+        return;
+    }
+    std::string node;
+    {
+        std::lock_guard<std::mutex> lock(link.mutex);
+        node = link.node;
+    }
+    if (!node.empty()) {
+        update_ring(node, false);
+    }
+}
+
+/**
+ * Hilo del enlace con un nodo par: se conecta a su puerto de clientes, le manda la foto de los usuarios
+ * de este nodo y después, cada PEER_BATCH_INTERVAL_MS, lo que se juntó en pending. Si el enlace se corta
+ * se reconecta; los mensajes del lote que se estaba enviando se pierden.
+ */
+void run_peer_link(PeerLink &link) {
+    auto down_since = std::chrono::steady_clock::now(); // Desde cuándo el par no responde en un enlace
+    while (running) {
+        int sock = connect_peer(link.address);
+        if (sock < 0) {
+            check_peer_down(link, down_since);
+            std::this_thread::sleep_for(std::chrono::milliseconds(PEER_RETRY_MS));
+            continue;
+        }
+        std::cout << "Connected to peer " << link.address << std::endl;
+
+        chat::PeerBatch batch;
+        {
+            // La foto reemplaza a los cambios de presencia que se juntaron mientras no había enlace
+            std::lock_guard<std::mutex> lock(clients_mutex);
+            std::lock_guard<std::mutex> link_lock(link.mutex);
+            batch.set_snapshot(true);
+            batch.set_secret(link_secret);
+            for (const auto &record : node_presence[node_name]) {
+                if (record.second.removed) {
+                    continue;
+                }
+                chat::PresenceEntry *entry = batch.add_presence();
+                entry->set_username(record.first);
+                entry->set_node(node_name);
+                entry->set_status(record.second.status);
+                entry->set_version(record.second.version);
+            }
+            batch.mutable_clock()->set_node(node_name);
+            batch.mutable_clock()->set_incarnation(incarnation);
+            batch.mutable_clock()->set_version(registry_version);
+            link.pending.clear_presence();
+            batch.mutable_messages()->Swap(link.pending.mutable_messages());
+            link.pending_bytes = 0;
+        }
+        std::string input;
+        bool linked = send_peer_batch(sock, batch);
+        auto next_gossip = std::chrono::steady_clock::now() + std::chrono::milliseconds(GOSSIP_INTERVAL_MS);
+        while (linked && running) {
+            struct pollfd watch = {sock, POLLIN, 0};
+            if (poll(&watch, 1, PEER_BATCH_INTERVAL_MS) > 0) {
+                linked = read_peer_link(link, sock, input);
+            }
+            batch.Clear();
+            {
+                std::lock_guard<std::mutex> lock(link.mutex);
+                batch.Swap(&link.pending);
+                link.pending_bytes = 0;
+            }
+            // Anti-entropía: cada tanto el par recibe el vector de versiones y contesta lo que falte
+            if (std::chrono::steady_clock::now() >= next_gossip) {
+                next_gossip += std::chrono::milliseconds(GOSSIP_INTERVAL_MS);
+                std::lock_guard<std::mutex> lock(clients_mutex);
+                for (const auto &clock : node_clocks) {
+                    chat::NodeVersion *version = batch.add_digest();
+                    version->set_node(clock.first);
+                    version->set_incarnation(clock.second.incarnation);
+                    version->set_version(clock.second.version);
+                }
+            }
+            if (linked && (batch.presence_size() > 0 || batch.messages_size() > 0 || batch.digest_size() > 0)) {
+                linked = send_peer_batch(sock, batch);
+            }
+        }
+        close(sock);
+        std::cerr << "Lost link to peer " << link.address << ", reconnecting." << std::endl;
+        {
+            std::lock_guard<std::mutex> lock(link.mutex);
+            if (link.up) {
+                link.up = false;
+                down_since = std::chrono::steady_clock::now();
+            }
+        }
+        check_peer_down(link, down_since);
+        std::this_thread::sleep_for(std::chrono::milliseconds(PEER_RETRY_MS));
     }
 }
 
 int main(int argc, char *argv[]) {
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <port> <server_name>\n";
+    bool upgrade = false;
+    bool valid = argc >= 3;
+    for (int i = 3; i < argc && valid; i++) {
+        std::string option = argv[i];
+        if (option == "--upgrade") {
+            upgrade = true;
+        } else if (option == "--peer" && i + 1 < argc) {
+            // [nombre@]host:puerto: con el nombre el par está en el anillo desde el arranque
+            std::string peer = argv[++i];
+            size_t at = peer.find('@');
+            peer_links.push_back(std::make_unique<PeerLink>());
+            peer_links.back()->address = at == std::string::npos ? peer : peer.substr(at + 1);
+            if (at != std::string::npos) {
+                peer_links.back()->node = peer.substr(0, at);
+                peer_links.back()->named = true;
+                valid = at > 0;
+            }
+        } else if (option == "--secret" && i + 1 < argc) {
+            link_secret = argv[++i];
+        } else {
+            valid = false;
+        }
+    }
+    // Los pares solo aceptan un enlace que presente el secreto del clúster
+    if (!valid || (!peer_links.empty() && link_secret.empty())) {
+        std::cerr << "Usage: " << argv[0] << " <port> <server_name> [--upgrade] [--secret <secret> [--peer [<name>@]<host:port>]...]\n";
         return 1;
     }
 
     int port = std::stoi(argv[1]);
     std::string server_name = argv[2];
-
-    server_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (server_fd == 0) {
-        perror("Socket creation failed");
-        return 1;
+    node_name = server_name;
+    ring.add_node(node_name);
+    for (auto &link : peer_links) {
+        if (link->named && link->node != node_name) {
+            ring.add_node(link->node);
+        }
     }
+    incarnation = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    node_clocks[node_name].incarnation = incarnation;
 
-    int opt = 1;
-    if (setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt))) {
-        perror("setsockopt failed");
-        return 1;
+    // Una entrada por descriptor posible más las conexiones de gateways; la tabla no cambia de tamaño mientras corren los reactores
+    struct rlimit descriptors;
+    size_t descriptor_limit = 1024;
+    if (getrlimit(RLIMIT_NOFILE, &descriptors) == 0 && descriptors.rlim_cur != RLIM_INFINITY) {
+        descriptor_limit = descriptors.rlim_cur;
     }
+    stream_sock_base = next_stream_sock = descriptor_limit;
+    socket_sessions = std::vector<std::atomic<Session *>>(descriptor_limit + MAX_GATEWAY_STREAMS);
 
-    struct sockaddr_in address;
-    address.sin_family = AF_INET;
-    address.sin_addr.s_addr = INADDR_ANY;
-    address.sin_port = htons(port);
+    request_pool = std::make_unique<TaskPool>(WORKER_THREADS > 0 ? WORKER_THREADS : std::max(1u, std::thread::hardware_concurrency()));
 
-    if (bind(server_fd, (struct sockaddr *)&address, sizeof(address)) < 0) {
-        perror("Bind failed");
-        return 1;
+    // Con --upgrade los sockets de escucha y las conexiones vienen del servidor que está corriendo
+    if (upgrade) {
+        if (!take_over(port)) {
+            return 1;
+        }
+    } else {
+        unsigned reactor_count = REACTOR_THREADS > 0 ? REACTOR_THREADS : std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < reactor_count; i++) {
+            reactors.push_back(std::make_unique<Reactor>());
+            int listen_fd = open_listener(port);
+            if (listen_fd < 0 || !setup_reactor(*reactors.back(), listen_fd)) {
+                return 1;
+            }
+        }
     }
 
-    if (listen(server_fd, 10) < 0) {
-        perror("Listen failed");
-        return 1;
+    std::cout << server_name << " listening on port " << port << " (" << reactors.size() << " reactors)" << std::endl;
+    // Sin el socket local el servidor sigue atendiendo por TCP
+    if (open_local_listener(port)) {
+        std::cout << "Local clients on " << local_path << std::endl;
     }
-
-    std::cout << server_name << " listening on port " << port << std::endl;
     std::cout << "Write 'exit' to terminate the server." << std::endl;
 
     std::thread(update_inactivity).detach();
+    std::thread(process_deliveries).detach();
+    std::string control_path = private_socket_path(UPGRADE_SOCKET_FORMAT, port, true);
+    upgrade_fd = open_unix_listener(control_path, 0, 1);
+    if (upgrade_fd >= 0) {
+        upgrade_path = control_path;
+        std::thread(serve_upgrades).detach();
+    } else {
+        std::cerr << "Hot upgrade disabled: no control socket." << std::endl;
+    }
+    for (auto &link : peer_links) {
+        std::thread(run_peer_link, std::ref(*link)).detach();
+    }
 
     // Start the termination handler thread
     std::thread terminator(terminationHandler);
     terminator.detach();
-    // Configuración del manejador de señales
+    // Configuración del manejador de señales: SIGINT y SIGTERM drenan las conexiones antes de salir
+    shutdown_fd = eventfd(0, EFD_CLOEXEC);
+    std::thread(shutdown_watcher).detach();
     signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);
 
-    while (running) {
-        int client_sock = accept(server_fd, NULL, NULL);
-        if (client_sock < 0) {
-            if (!running) break; // Salir si el servidor está cerrando
-            perror("Accept failed");
-            continue;
-        }
-
-        std::thread client_thread(handle_client, client_sock);
-        client_thread.detach();
+    for (auto &reactor : reactors) {
+        reactor->thread = std::thread(run_reactor, std::ref(*reactor));
+    }
+    for (auto &reactor : reactors) {
+        reactor->thread.join();
     }
 
     // Limpiar
-    close(server_fd);
+    close_listeners();
     std::cout << "Server closed successfully." << std::endl;
     return 0;
 }